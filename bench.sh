@@ -0,0 +1,242 @@
+#!/bin/bash
+
+set -euo pipefail
+
+# Preprocessor scaling benchmarks. Normally invoked via `make bench`.
+# Usage: `./bench.sh <compiler>...`, where each compiler can have extra flags attached with commas, e.g. `g++-12,-fms-extensions`.
+# For every compiler, shape and size, runs the compiler with `-E` and `-c` on a generated file, and reports the wall time and the peak RSS.
+# Results are printed and additionally written to `bench_output.txt`.
+
+# The sequence lengths to test. Override e.g. with `BENCH_SIZES="1000 10000" make bench`.
+SIZES="${BENCH_SIZES:-1000 10000 100000 1000000}"
+# The usage shapes to test, see `gen_shape` below.
+SHAPES="${BENCH_SHAPES:-stateless simple state fast counter counter_inc until bigstate accumulate nested seq_size zip args iterate iterate10000}"
+# The values of `SF_MAX_DEPTH` for measuring the cost of including the header alone. Set to empty to skip.
+DEPTHS="${BENCH_DEPTHS-0 8 16 32 64}"
+# The compiler modes to test.
+MODES="${BENCH_MODES:--E -c}"
+# Extra flags for every run. E.g. GCC's `-E` is quadratic on long expansions unless you pass `-ftrack-macro-expansion=0`.
+FLAGS="${BENCH_FLAGS:-}"
+# The directory with the header to benchmark, useful for comparing against a different version.
+INCLUDE="${BENCH_INCLUDE:-include}"
+# Per-run time limit, in seconds. Runs that exceed it are reported as `timeout`, and larger sizes of the same shape are skipped.
+TIMEOUT="${BENCH_TIMEOUT:-120}"
+
+OUTPUT=bench_output.txt
+
+if [[ $# -eq 0 ]]; then
+    echo "Usage: $0 <compiler>..." >&2
+    exit 1
+fi
+
+TMP="$(mktemp -d)"
+trap 'rm -rf "$TMP"' EXIT
+
+# Runs the command passed as arguments, prints `<wall seconds> <peak rss KiB> <exit code>`.
+# The RSS is taken from the children rusage, which covers the compiler proper (`cc1plus` and such), not just the driver.
+measure()
+{
+    python3 - "$@" <<'EOF'
+import resource, subprocess, sys, time
+start = time.monotonic()
+code = subprocess.call(sys.argv[1:], stdout=subprocess.DEVNULL)
+elapsed = time.monotonic() - start
+# `ru_maxrss` is in KiB on Linux, but in bytes on MacOS.
+rss = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+if sys.platform == 'darwin':
+    rss //= 1024
+print(f'{elapsed:.2f} {rss} {code}')
+EOF
+}
+
+# Prints `(e0)(e1)...` with `$1` elements.
+gen_seq()
+{
+    seq 0 $(($1-1)) | awk '{printf "(e%d)", $1} END {print ""}'
+}
+
+# Prints a sequence of `(gi, (ej)(ej+1)...)` groups with `$1` elements in total, for nested loops.
+gen_nested_seq()
+{
+    seq 0 $(($1-1)) | awk -v group=100 '
+        $1 % group == 0 {if ($1) printf ")"; printf "(g%d,", $1 / group}
+        {printf "(e%d)", $1}
+        END {print ")"}'
+}
+
+# Writes the test file for shape `$1` and size `$2` to `$3`.
+gen_shape()
+{
+    {
+        echo '#include "macro_sequence_for.h"'
+        case "$1" in
+          stateless)
+            # A stateless body, like `DECL` without the value.
+            echo '#define BODY(n, d, x) int x;'
+            echo "#define SEQ $(gen_seq "$2")"
+            echo 'SF_FOR_EACH(BODY, SF_NULL, SF_NULL,, SEQ)'
+            ;;
+          simple)
+            # Same as `stateless`, but using the dedicated stateless loop.
+            echo '#define BODY(n, x) int x;'
+            echo "#define SEQ $(gen_seq "$2")"
+            echo 'SF_FOR_EACH_SIMPLE(BODY, SEQ)'
+            ;;
+          state)
+            # The state is passed through unchanged, like `DECL`.
+            echo '#define BODY(n, d, x) int x = d;'
+            echo "#define SEQ $(gen_seq "$2")"
+            echo 'SF_FOR_EACH(BODY, SF_STATE, SF_NULL, 42, SEQ)'
+            ;;
+          fast)
+            # Same as `state`, but using `SF_FOR_EACH_FAST`.
+            echo '#define BODY(n, d, x) int x = d;'
+            echo "#define SEQ $(gen_seq "$2")"
+            echo 'SF_FOR_EACH_FAST(BODY, SF_STATE, SF_NULL, 42, SEQ)'
+            ;;
+          counter)
+            # The growing state from the `MAKE_FLAGS` example.
+            echo '#define BODY(n, d, x) x = d,'
+            echo '#define STEP(n, d, x) d+1'
+            echo '#define FINAL(n, d) _count = d'
+            echo "#define SEQ $(gen_seq "$2")"
+            echo 'enum E {SF_FOR_EACH(BODY, STEP, FINAL, 0, SEQ)};'
+            ;;
+          counter_inc)
+            # Same as `counter`, but using `SF_STATE_INC`.
+            echo '#define BODY(n, d, x) x = SF_COUNTER(d),'
+            echo '#define FINAL(n, d) _count = SF_COUNTER(d)'
+            echo "#define SEQ $(gen_seq "$2")"
+            echo 'enum E {SF_FOR_EACH(BODY, SF_STATE_INC, FINAL, (0), SEQ)};'
+            ;;
+          until)
+            # A search stopping in the middle of the sequence, like `state` otherwise.
+            echo '#define BODY(n, d, x) int x = d;'
+            echo '#define STEP(n, d, x) CHECK(STOP_##x), d'
+            echo '#define CHECK(...) SECOND(__VA_ARGS__, 0,)'
+            echo '#define SECOND(x, y, ...) y'
+            echo "#define STOP_e$(($2 / 2)) ~, 1"
+            echo "#define SEQ $(gen_seq "$2")"
+            echo 'SF_FOR_EACH_UNTIL(BODY, STEP, SF_NULL, 42, SEQ)'
+            ;;
+          bigstate)
+            # A large state passed through unchanged, e.g. a config blob used with `SF_STATE_EXPAND`.
+            echo '#define BODY(n, d, x) int x;'
+            echo "#define CONFIG ($(seq 0 99 | awk '{printf "%sc%d", ($1 ? "," : ""), $1}'))"
+            echo "#define SEQ $(gen_seq "$2")"
+            echo 'SF_FOR_EACH(BODY, SF_STATE, SF_NULL, CONFIG, SEQ)'
+            ;;
+          accumulate)
+            # A state accumulating all the elements, used only by the final function.
+            echo '#define BODY(n, d, x) int x;'
+            echo '#define STEP(n, d, x) d(x)'
+            echo '#define FINAL(n, d) int final = sizeof(#d);'
+            echo "#define SEQ $(gen_seq "$2")"
+            echo 'SF_FOR_EACH(BODY, STEP, FINAL,, SEQ)'
+            ;;
+          nested)
+            # Nested loops, like `ARRAYS`, in groups of 100 elements.
+            echo '#define BODY(n, d, name, values) int name[] = {SF_FOR_EACH0(BODY0, SF_NULL, SF_NULL,, values)};'
+            echo '#define BODY0(n, d, x) 0,'
+            echo "#define SEQ $(gen_nested_seq "$2")"
+            echo 'SF_FOR_EACH(BODY, SF_NULL, SF_NULL,, SEQ)'
+            ;;
+          seq_size)
+            # `SF_SEQ_SIZE`, carrying a counter through a dedicated loop.
+            echo "#define SEQ $(gen_seq "$2")"
+            echo 'int size = SF_SEQ_SIZE(SEQ);'
+            ;;
+          zip)
+            # `SF_FOR_EACH_ZIP` over two sequences of the same length, the second one carried in the state.
+            echo '#define BODY(n, d, x, y) int x = y;'
+            echo "#define SEQ $(gen_seq "$2")"
+            echo "#define SEQ2 $(seq 0 $(($2-1)) | awk '{printf "(%d)", $1} END {print ""}')"
+            echo 'SF_FOR_EACH_ZIP(BODY, SF_STATE, SF_NULL,, SEQ, SEQ2)'
+            ;;
+          args)
+            # `SF_FOR_EACH_ARGS` over a comma-separated list, like `state` otherwise. The size is capped at `SF_MAX_ARGS` (the default one).
+            echo '#define BODY(n, d, x) int x = d;'
+            echo "#define LIST $(seq 0 $(($2 < 4096 ? $2-1 : 4095)) | awk '{printf "%se%d", ($1 ? "," : ""), $1} END {print ""}')"
+            echo 'SF_FOR_EACH_ARGS(BODY, SF_STATE, SF_NULL, 42, LIST)'
+            ;;
+          iterate|iterate10000)
+            # `SF_ITERATE` with the default chunk size (or with 10000), like `counter_inc` otherwise.
+            [[ $1 == iterate10000 ]] && echo '#define SF_ITERATE_CHUNK 10000'
+            echo "#define SF_ITERATE_SEQ $(gen_seq "$2")"
+            echo '#define SF_ITERATE_M(n, d, x) x = SF_COUNTER(d),'
+            echo '#define SF_ITERATE_S SF_STATE_INC'
+            echo '#define SF_ITERATE_F(n, d) _count = SF_COUNTER(d)'
+            echo '#define SF_ITERATE_D (0)'
+            echo 'enum E {'
+            echo '#include SF_ITERATE'
+            echo '};'
+            ;;
+          *)
+            echo "Unknown shape: $1" >&2
+            exit 1
+            ;;
+        esac
+    } >"$3"
+}
+
+: >"$OUTPUT"
+report()
+{
+    echo "$*" | tee -a "$OUTPUT"
+}
+
+report "$(printf '%-32s %-10s %-8s %-4s %10s %14s' compiler shape size mode wall_s peak_rss_kib)"
+
+for compiler in "$@"
+do
+    compiler="${compiler//,/ }"
+    for shape in $SHAPES
+    do
+        for mode in $MODES
+        do
+            for size in $SIZES
+            do
+                file="$TMP/$shape-$size.cpp"
+                [[ -f "$file" ]] || gen_shape "$shape" "$size" "$file"
+
+                # Unquoted `$compiler` and `$FLAGS` to split the flags.
+                read -r time rss code < <(measure timeout "$TIMEOUT" $compiler $FLAGS -std=c++20 -I"$INCLUDE" "$mode" "$file" -o "$TMP/out")
+                # The RSS of a killed or failed run is meaningless, so it's not printed.
+                if [[ $code -eq 124 ]]; then
+                    time=timeout
+                    rss=-
+                elif [[ $code -ne 0 ]]; then
+                    time=error
+                    rss=-
+                fi
+                report "$(printf '%-32s %-10s %-8s %-4s %10s %14s' "$compiler" "$shape" "$size" "$mode" "$time" "$rss")"
+
+                # Larger sizes would only take longer.
+                [[ $code -eq 0 ]] || break
+            done
+        done
+    done
+
+    # The cost of including the header with different depths, with nothing else in the file.
+    # This is short, so we take the best of 5 runs to reduce noise. The size column is the depth here.
+    for mode in $MODES
+    do
+        for depth in $DEPTHS
+        do
+            file="$TMP/include-$depth.cpp"
+            printf '#define SF_MAX_DEPTH %s\n#include "macro_sequence_for.h"\n' "$depth" >"$file"
+            best=
+            for ((i=0; i<5; i++))
+            do
+                read -r time rss code < <(measure timeout "$TIMEOUT" $compiler $FLAGS -std=c++20 -I"$INCLUDE" "$mode" "$file" -o "$TMP/out")
+                if [[ $code -ne 0 ]]; then
+                    best=error
+                    rss=-
+                    break
+                fi
+                [[ $best ]] && awk "BEGIN {exit !($time >= $best)}" || best=$time
+            done
+            report "$(printf '%-32s %-10s %-8s %-4s %10s %14s' "$compiler" include "$depth" "$mode" "$best" "$rss")"
+        done
+    done
+done
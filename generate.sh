@@ -5,23 +5,62 @@ set -euxo pipefail
 # Generates the header file, adding the appropriate boilerplate.
 # See `macro_sequence_for.codegen_input.h` for the details on what is being generated.
 
-# The max level of loop nesting. (The number of iterations is always unlimited.)
-N=8
+# The max level of loop nesting (`SF_MAX_DEPTH_LIMIT`). (The number of iterations is always unlimited.)
+N=64
+# The default nesting level, when the user doesn't define `SF_MAX_DEPTH`.
+DEFAULT_DEPTH=8
+# The max number of digits in counters (`SF_STATE_INC`).
+D=10
+# The max number of sequences in `SF_FOR_EACH_ZIP` (`SF_MAX_ZIP`).
+Z=11
+# The number of steps in `SF_FOR_EACH_ARGS`, each converting 16 elements. The max number of elements (`SF_MAX_ARGS`) is `16*A`.
+A=256
 
 INPUT=macro_sequence_for.codegen_input.h
 OUTPUT=include/macro_sequence_for.h
+# The directory for the per-level files, relative to the header.
+LEVELS_DIR=macro_sequence_for
 
 mkdir -p "$(dirname "$OUTPUT")"
+rm -rf "$(dirname "$OUTPUT")/$LEVELS_DIR"
+mkdir "$(dirname "$OUTPUT")/$LEVELS_DIR"
 
 # The base part, aka the -1th nesting level.
 # `-e '$d'` deletes the last line, which is the `#endif` of the include guard.
-sed -e '$d' -e 's/xx//g' -e 's/yy/0/g' -e 's/SF_MAX_DEPTH 0/SF_MAX_DEPTH '"$N"'/' "$INPUT" | grep -vE '^//\?\?' >"$OUTPUT"
+sed -e '$d' -e 's/xx//g' -e 's/yy/0/g' -e 's/zz//g' -e 's/ww/0/g' -e 's/qq//g' -e 's/vv/0/g' -e 's/kk//g' -e 's/jj/0/g' -e 's/SF_MAX_DEPTH 0/SF_MAX_DEPTH '"$DEFAULT_DEPTH"'/' -e 's/SF_MAX_DEPTH_LIMIT 0/SF_MAX_DEPTH_LIMIT '"$N"'/' -e 's/SF_MAX_COUNTER_DIGITS 1/SF_MAX_COUNTER_DIGITS '"$D"'/' -e 's/SF_MAX_ZIP 2/SF_MAX_ZIP '"$Z"'/' -e 's/ZIP_COL0(\.\.\.)/ZIP_COL'"$((Z-2))"'(...)/' -e 's/SF_MAX_ARGS 16/SF_MAX_ARGS '"$((16*A))"'/' "$INPUT" | grep -vE '^//\?\?' >"$OUTPUT"
 
-# Boilerplate for nesting levels `0..N-1`.
+# Boilerplate for nesting levels `0..N-1`, in separate files. The `SF_TRACE` conditional is copied too, since it redefines some of the per-level macros.
+# The header includes only the first `SF_MAX_DEPTH` of them.
 for ((i=0; $i<$N; i=$(($i+1))))
 do
-    echo "// $i" >>"$OUTPUT"
-    grep '#define \w*xx\w*' "$INPUT" | sed -e 's/xx/'"$i"'/g' -e 's/yy/'"$((i+1))"'/g' >>"$OUTPUT"
+    LEVEL="$LEVELS_DIR/level_$i.h"
+    echo "#if SF_MAX_DEPTH > $i"$'\n'"#include \"$LEVEL\""$'\n#endif' >>"$OUTPUT"
+    {
+        echo "// Nesting level $i for \"$(basename "$OUTPUT")\", generated by \`generate.sh\`. Don't include directly."
+        grep -E '^#(define|undef) \w*xx\w*|^#(ifdef|endif)\b.*\bSF_TRACE\b' "$INPUT" | sed -e 's/xx/'"$i"'/g' -e 's/yy/'"$((i+1))"'/g'
+    } >"$(dirname "$OUTPUT")/$LEVEL"
+done
+
+# Boilerplate for counter digit positions `0..D-2`. The base part has the position ``, for the total of `D`.
+echo $'\n// Generated boilerplate for counters:' >>"$OUTPUT"
+for ((i=0; $i<$D-1; i=$(($i+1))))
+do
+    grep '#define \w*zz\w*' "$INPUT" | sed -e 's/zz/'"$i"'/g' -e 's/ww/'"$((i+1))"'/g' >>"$OUTPUT"
+done
+
+# Boilerplate for the `SF_FOR_EACH_ZIP` sequence positions `0..Z-3`. The base part has the position ``, for the total of `Z-1`,
+#   plus the first sequence that is iterated directly.
+echo $'\n// Generated boilerplate for `SF_FOR_EACH_ZIP`:' >>"$OUTPUT"
+for ((i=0; $i<$Z-2; i=$(($i+1))))
+do
+    grep '#define \w*qq\w*' "$INPUT" | sed -e 's/qq/'"$i"'/g' -e 's/vv/'"$((i+1))"'/g' >>"$OUTPUT"
+done
+
+# Boilerplate for the steps of `SF_FOR_EACH_ARGS` `0..A-2`. The base part has the step ``, for the total of `A`.
+echo $'\n// Generated boilerplate for `SF_FOR_EACH_ARGS`:' >>"$OUTPUT"
+for ((i=0; $i<$A-1; i=$(($i+1))))
+do
+    grep '#define \w*kk\w*' "$INPUT" | sed -e 's/kk/'"$i"'/g' -e 's/jj/'"$((i+1))"'/g' >>"$OUTPUT"
 done
 
 # Lastly, close the include guard.
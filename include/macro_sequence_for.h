@@ -38,21 +38,136 @@
 // Use `SF_FOR_EACHi(...)` for nested loops, where `i` can either be hardcoded,
 //   or come from the `n` argument of the outer loop, in which case you
 //   can use `SF_CAT(SF_FOR_EACH, n)(...)`.
-#define SF_FOR_EACH(m, s, f, d, seq) IMPL_SEQFOR_FOR(m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_ANNOTATE_SEQ_END(IMPL_SEQFOR_ANNOTATE_SEQ_A seq)) )
+#define SF_FOR_EACH(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH, 0) IMPL_SEQFOR_IDENTITY( IMPL_SEQFOR_FOR_GUIDE_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+
+// A stateless loop over a sequence of the form `(a)(b)(c)`. The elements can contain commas.
+// `m` is the loop body, invoked as `m(n, ...)`, where `...` is one of the elements, and `n` is the same as in `SF_FOR_EACH`.
+// Same as `SF_FOR_EACH(m', SF_NULL, SF_NULL,, seq)` (where `m'` ignores the state), but faster, since there's no state to carry around.
+// Use `SF_FOR_EACH_SIMPLEi(...)` for nested loops, same as with `SF_FOR_EACHi`.
+#define SF_FOR_EACH_SIMPLE(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE, 0) IMPL_SEQFOR_IDENTITY( IMPL_SEQFOR_SIMPLE_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+
+// Same as `SF_FOR_EACH`, but `s` can't emit text (it must return only the new state, with no commas at the top level).
+// This lets the loop skip re-splitting the result of `s`, which saves two macro expansions per iteration, each receiving the whole state.
+#define SF_FOR_EACH_FAST(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST, 0) IMPL_SEQFOR_IDENTITY( IMPL_SEQFOR_FAST_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+
+// A loop that can stop early. Same as `SF_FOR_EACH`, except that `s` must return `b, d` (optionally followed by `, ...` to emit text, as usual),
+//   where `b` is `0` to continue the loop, or `1` to stop it. When stopped, `f(n, d)` is called as usual,
+//   and the remaining elements are skipped without calling `m` and `s` on them.
+#define SF_FOR_EACH_UNTIL(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL, 0) IMPL_SEQFOR_IDENTITY( IMPL_SEQFOR_UNTIL_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+
+// A loop over two or more sequences in lockstep. Same as `SF_FOR_EACH_FAST` (`s` can't emit text), except that `m` and `s` receive one element from each sequence,
+//   e.g. `m(n, d, a, x)` for `seq = (a)(b)` and `seq2 = (x)(y)`. Elements with commas are passed as is, so they look like several elements.
+// If the lengths differ, the loop stops at the end of the shortest sequence, and `f(n, d)` is called as usual.
+// Only `seq` is consumed as a guide. The other sequences are carried as a part of the loop state, which makes it `O(n^2)`
+//   in the total length of those, but still linear in the number of macro expansions. In practice, it's slow past a thousand elements.
+// The max number of sequences is `SF_MAX_ZIP`. More sequences make the loop expand to an undeclared name.
+#define SF_FOR_EACH_ZIP(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP, 0) IMPL_SEQFOR_IDENTITY( IMPL_SEQFOR_ZIP_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+
+// A loop over a comma-separated list, e.g. `__VA_ARGS__`. Same as `SF_FOR_EACH`, except that the elements are `...` rather than a sequence.
+// Every argument is an element (including the empty ones), except that an empty list has no elements.
+// The list is converted to a guide (see the pipelines below) 16 elements at a time, and every such step passes the rest of the list
+//   through a few macros, so the conversion costs `O(n)` tokens per element on top of the loop itself, with a small constant factor.
+// The max number of elements is `SF_MAX_ARGS`, unlike the loops over sequences.
+#define SF_FOR_EACH_ARGS(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS, 0) IMPL_SEQFOR_IDENTITY( IMPL_SEQFOR_FOR_GUIDE_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
 
 // Various useful macros, to be passed as arguments to `SF_FOR_EACH`.
 #define SF_NULL(...) // A no-op.
 #define SF_STATE(...) IMPL_SEQFOR_STATE(__VA_ARGS__,) // Returns the second argument. As the step and/or final function, returns the state unchanged.
 #define SF_STATE_EXPAND(...) IMPL_SEQFOR_STATE_EXPAND(__VA_ARGS__,) // Same as `SF_STATE()`, but additionally expands the parentheses, as they are so common in the state.
+#define SF_STATE_INC(...) IMPL_SEQFOR_STATE_INC(__VA_ARGS__,) // Increments the state, which must be a counter (see below). Use it as the step function.
+
+// Counters, for use as the loop state.
+// A counter is a parenthesized list of decimal digits, least significant first. E.g. `(0)` is zero, and `(2,1)` is twelve.
+// Unlike `d+1`, incrementing it doesn't make it longer (except for the new digits), so it's cheap to carry through a long loop.
+// `SF_COUNTER(d)` converts a counter to a single decimal literal, e.g. `(2,1)` -> `12`.
+// The max number of digits is `SF_MAX_COUNTER_DIGITS`.
+#define SF_COUNTER(c) IMPL_SEQFOR_COUNTER(IMPL_SEQFOR_COUNTER_EXPAND c)
+
+// Sequence algorithms. Same as the loops, they accept sequences of any length, and the elements can contain commas.
+// `SF_SEQ_SIZE(seq)` returns the number of elements, as a decimal literal.
+// `SF_SEQ_ELEM(i, seq)` returns the element at index `i`, or nothing if it's out of range. `i` is a counter, e.g. `(0)` or `(2,1)`.
+// `SF_SEQ_TO_ARGS(seq)` converts `(a)(b)(c)` to `a, b, c`.
+// `SF_SEQ_REVERSE(seq)` reverses the sequence. Unlike the rest, it's quadratic, since it has to carry the reversed part as the loop state.
+// `SF_SEQ_MAP(m, seq)` returns `(m(n, a))(m(n, b))...`, where `n` is the same as in `SF_FOR_EACH`.
+// `SF_SEQ_FILTER(p, seq)` returns only the elements for which `p(n, x)` returns `1` (as opposed to `0`).
+// Use `SF_SEQ_MAPi(...)` and `SF_SEQ_FILTERi(...)` in nested loops, same as with `SF_FOR_EACHi`.
+// The other ones don't call any user macros, and work at any nesting level as is.
+#define SF_SEQ_SIZE(seq) IMPL_SEQFOR_SEQ_IDENTITY( IMPL_SEQFOR_SIZE_A IMPL_SEQFOR_LPAREN (0), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_ELEM(i, seq) IMPL_SEQFOR_SEQ_IDENTITY( IMPL_SEQFOR_ELEM_A IMPL_SEQFOR_LPAREN i, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_TO_ARGS(seq) IMPL_SEQFOR_TO_ARGS_END(IMPL_SEQFOR_TO_ARGS_A seq)
+#define SF_SEQ_REVERSE(seq) IMPL_SEQFOR_SEQ_IDENTITY( IMPL_SEQFOR_REVERSE_A IMPL_SEQFOR_LPAREN , IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_MAP(m, seq) IMPL_SEQFOR_IDENTITY( IMPL_SEQFOR_MAP_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER(p, seq) IMPL_SEQFOR_IDENTITY( IMPL_SEQFOR_FILTER_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+
+// Pipelines. Every loop first converts the sequence to the internal "guide" form, which costs one macro expansion per element.
+// When one stage feeds another, you can skip this conversion by passing the guide around instead of the sequence.
+// `SF_GUIDE(seq)` converts a sequence to a guide, and `SF_GUIDE_ARGS(...)` converts a comma-separated list (same as in `SF_FOR_EACH_ARGS`). `SF_SEQ_MAP_G(m, g)` and `SF_SEQ_FILTER_G(p, g)` accept a guide and return a guide.
+// Every other loop and algorithm has a `_G` variation accepting a guide instead of a sequence, e.g. `SF_FOR_EACH_G(m, s, f, d, g)`.
+// A guide has unbalanced parentheses, so it must be written directly as the argument of a `_G` macro,
+//   and can't go through the parameters of your own macros. E.g. `SF_SEQ_SIZE_G(SF_SEQ_FILTER_G(p, SF_GUIDE(seq)))`.
+// To emit a guide from your own loop, emit `SF_GUIDE_ELEM(x)` for every element, and then `SF_GUIDE_END`.
+#define SF_GUIDE(seq) IMPL_SEQFOR_TO_GUIDE_A seq
+#define SF_GUIDE_ARGS(...) IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)
+#define SF_GUIDE_ELEM(...) IMPL_SEQFOR_RPAREN __VA_ARGS__ IMPL_SEQFOR_RPAREN
+#define SF_GUIDE_END IMPL_SEQFOR_TO_GUIDE_A
+#define SF_FOR_EACH_G(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G, 0) IMPL_SEQFOR_FOR_GUIDE_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G, 0) IMPL_SEQFOR_SIMPLE_A(m, g) )
+#define SF_FOR_EACH_FAST_G(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G, 0) IMPL_SEQFOR_FAST_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G, 0) IMPL_SEQFOR_UNTIL_A(m, s, f, d, g) )
+#define SF_SEQ_SIZE_G(g) IMPL_SEQFOR_SIZE_A((0), g) )
+#define SF_SEQ_ELEM_G(i, g) IMPL_SEQFOR_ELEM_A(i, g) )
+#define SF_SEQ_TO_ARGS_G(g) IMPL_SEQFOR_TO_ARGS_G_A(g) )
+#define SF_SEQ_REVERSE_G(g) IMPL_SEQFOR_REVERSE_A(, g) )
+#define SF_SEQ_MAP_G(m, g) IMPL_SEQFOR_MAP_G_A(m, g) )
+#define SF_SEQ_FILTER_G(p, g) IMPL_SEQFOR_FILTER_G_A(p, g) )
+
+// Tracing. Define `SF_TRACE` before including this header to find out which loops are expensive to preprocess.
+// In this mode, every `SF_FOR_EACH...` loop (including the `_G` ones, but not the sequence algorithms) emits `_Pragma("sf_trace ...")` markers,
+//   which show up as `#pragma sf_trace ...` lines in the `-E` output: `begin <macro> <n> <file> <line>` before the loop,
+//   `iter` before every call of `m`, and `end <d>` after the call of `f` (with `d` being the final state, empty for `SF_FOR_EACH_SIMPLE`).
+// Pipe the `-E` output to `trace_report.py` to get a per-call-site report.
+// The markers become a part of the loop output, so in this mode you can't pass that output to other macros (e.g. as a sequence or a guide),
+//   or stringize it. Without `SF_TRACE`, the loops are unaffected, except for an empty macro call at the start of each loop.
+
+// File iteration. Same as `SF_FOR_EACH(m, s, f, d, seq)`, but the output is produced a chunk of elements at a time,
+//   by re-including a header for every chunk, so the preprocessor doesn't hold the output of the whole loop in memory at once. Usage:
+//     #define SF_ITERATE_SEQ (a)(b)(c)
+//     #define SF_ITERATE_M(n, d, x) ...
+//     #include SF_ITERATE
+// `SF_ITERATE_S(n, d, x)`, `SF_ITERATE_F(n, d)` and `SF_ITERATE_D` are optional, and default to `SF_STATE`, `SF_NULL` and nothing respectively.
+// Same as in `SF_FOR_EACH_FAST`, `s` can't emit text. `n` is `0`, same as in `SF_FOR_EACH`.
+// `SF_ITERATE_CHUNK` is the number of elements per chunk, one of `1`, `10`, `100`, `1000` (the default), `10000`. The max number of chunks is 10000, a longer sequence is an error.
+// All those macros are undefined at the end, so you can define them again for the next loop.
+// Macros can't store the state between the inclusions, so every chunk walks the whole sequence, calling only `s` for the preceding elements.
+//   This makes it `O(n^2 / chunk)` in time, and the memory is still proportional to `n` (with a smaller factor, since `m` is called
+//   only for one chunk). So this only pays off for huge sequences where `m` emits a lot, and the chunk should be as large as you can afford.
+// With GCC, this needs `-ftrack-macro-expansion=0`, otherwise it remembers every expansion until the end of the TU, which makes the memory usage worse, not better.
+#define SF_ITERATE "macro_sequence_for_iterate.h"
 
 // Concatenate two identifiers.
 #define SF_CAT(x, y) SF_CAT_(x, y)
 #define SF_CAT_(x, y) x##y
 
-// The max loop nesting level. This is baked in at the code generation time, adjust it in `generate.sh`.
-// The actual number of supporting nesting levels is `N+1`, with name suffixes ``, `0`, `1`, ..., `N-1`.
-// The most nested loop will report `N` as the next available level.
+// The max loop nesting level. You can define it before including this header, up to `SF_MAX_DEPTH_LIMIT`, otherwise it defaults to 8.
+// The actual number of supporting nesting levels is `SF_MAX_DEPTH+1`, with name suffixes ``, `0`, `1`, ..., `SF_MAX_DEPTH-1`.
+// The most nested loop will report `SF_MAX_DEPTH` as the next available level.
+// Every level costs some time to parse, so only the requested ones are loaded, from `macro_sequence_for/level_<i>.h` next to this header.
+// Only the first inclusion of this header in a TU determines the depth.
+#ifndef SF_MAX_DEPTH
 #define SF_MAX_DEPTH 8
+#endif
+
+// The max value of `SF_MAX_DEPTH`. This is baked in at the code generation time, adjust it in `generate.sh`.
+#define SF_MAX_DEPTH_LIMIT 64
+
+// The max number of digits in a counter (see `SF_STATE_INC`). This is baked in at the code generation time, adjust it in `generate.sh`.
+#define SF_MAX_COUNTER_DIGITS 10
+
+// The max number of sequences in `SF_FOR_EACH_ZIP`. This is baked in at the code generation time, adjust it in `generate.sh`.
+#define SF_MAX_ZIP 11
+
+// The max number of elements in `SF_FOR_EACH_ARGS` and `SF_GUIDE_ARGS`. This is baked in at the code generation time, adjust it in `generate.sh`.
+#define SF_MAX_ARGS 4096
 
 
 // Implementation:
@@ -61,123 +176,971 @@
 #error The standard-conformant MSVC preprocessor is required, enable it with `/Zc:preprocessor`.
 #endif
 
-// Same as `SF_FOR_EACH`, but the list is spelled differently, as described in `IMPL_SEQFOR_FOR_GUIDE_A`.
-#define IMPL_SEQFOR_FOR(m, s, f, d, guide) IMPL_SEQFOR_IDENTITY( IMPL_SEQFOR_FOR_GUIDE_A IMPL_SEQFOR_LPAREN m, s, f, d, guide )
+#if SF_MAX_DEPTH < 0 || SF_MAX_DEPTH > SF_MAX_DEPTH_LIMIT
+#error `SF_MAX_DEPTH` is out of range, adjust `SF_MAX_DEPTH_LIMIT` in `generate.sh` if you need more levels.
+#endif
 
 // Various helpers.
 #define IMPL_SEQFOR_NULL(...)
 #define IMPL_SEQFOR_IDENTITY(...) __VA_ARGS__
 #define IMPL_SEQFOR_LPAREN (
+#define IMPL_SEQFOR_RPAREN )
 #define IMPL_SEQFOR_CAT(x, y) IMPL_SEQFOR_CAT_(x,y)
 #define IMPL_SEQFOR_CAT_(x, y) x##y
+#define IMPL_SEQFOR_NONEMPTY(...) __VA_OPT__(1)
 // Implementation of `SF_STATE`.
 #define IMPL_SEQFOR_STATE(n, d, ...) d
 #define IMPL_SEQFOR_STATE_EXPAND(n, d, ...) IMPL_SEQFOR_STATE_EXPAND_IDENTITY d
 #define IMPL_SEQFOR_STATE_EXPAND_IDENTITY(...) __VA_ARGS__ // I believe this one doesn't need to be unique per recursion depth.
+// Implementation of `SF_STATE_INC`.
+#define IMPL_SEQFOR_STATE_INC(n, d, ...) (IMPL_SEQFOR_INC d)
+
+// Implementation of counters.
+// `IMPL_SEQFOR_INC(x, ...)` increments the counter digits `x, ...`, where `x` is the digit at position ``.
+// `IMPL_SEQFOR_INC_DIGIT_x` expands to the next digit, and to `1` after it if there's a carry. An empty `x` is a new digit.
+// The next position is invoked by `IMPL_SEQFOR_INC__` itself, rather than by `IMPL_SEQFOR_INC_CARRY_1`, to avoid recursion.
+#define IMPL_SEQFOR_INC(x, ...) IMPL_SEQFOR_INC_(IMPL_SEQFOR_INC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_INC_(...) IMPL_SEQFOR_INC__(__VA_ARGS__)
+#define IMPL_SEQFOR_INC__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_INC0)(__VA_ARGS__)
+#define IMPL_SEQFOR_INC_CARRY_(next) IMPL_SEQFOR_INC_REST
+#define IMPL_SEQFOR_INC_CARRY_1(next) , next
+#define IMPL_SEQFOR_INC_REST(...) __VA_OPT__(,) __VA_ARGS__
+#define IMPL_SEQFOR_INC_DIGIT_ 1,
+#define IMPL_SEQFOR_INC_DIGIT_0 1,
+#define IMPL_SEQFOR_INC_DIGIT_1 2,
+#define IMPL_SEQFOR_INC_DIGIT_2 3,
+#define IMPL_SEQFOR_INC_DIGIT_3 4,
+#define IMPL_SEQFOR_INC_DIGIT_4 5,
+#define IMPL_SEQFOR_INC_DIGIT_5 6,
+#define IMPL_SEQFOR_INC_DIGIT_6 7,
+#define IMPL_SEQFOR_INC_DIGIT_7 8,
+#define IMPL_SEQFOR_INC_DIGIT_8 9,
+#define IMPL_SEQFOR_INC_DIGIT_9 0, 1
+// `IMPL_SEQFOR_LIT(acc, x, ...)` pastes the digits `x, ...` in the reverse order, then appends `acc`.
+#define IMPL_SEQFOR_COUNTER(...) IMPL_SEQFOR_LIT(, __VA_ARGS__)
+#define IMPL_SEQFOR_COUNTER_EXPAND(...) __VA_ARGS__
+#define IMPL_SEQFOR_LIT(acc, x, ...) IMPL_SEQFOR_LIT_FIRST(__VA_OPT__(IMPL_SEQFOR_LIT0(x##acc, __VA_ARGS__),) x##acc)
+#define IMPL_SEQFOR_LIT_FIRST(x, ...) x
+// `IMPL_SEQFOR_DEC(x, ...)` decrements a nonzero counter, same as `IMPL_SEQFOR_INC`. The length stays the same, so it can end up with leading zeros.
+#define IMPL_SEQFOR_DEC(x, ...) IMPL_SEQFOR_DEC_(IMPL_SEQFOR_DEC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_DEC_(...) IMPL_SEQFOR_DEC__(__VA_ARGS__)
+#define IMPL_SEQFOR_DEC__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_DEC0)(__VA_ARGS__)
+#define IMPL_SEQFOR_DEC_DIGIT_0 9, 1
+#define IMPL_SEQFOR_DEC_DIGIT_1 0,
+#define IMPL_SEQFOR_DEC_DIGIT_2 1,
+#define IMPL_SEQFOR_DEC_DIGIT_3 2,
+#define IMPL_SEQFOR_DEC_DIGIT_4 3,
+#define IMPL_SEQFOR_DEC_DIGIT_5 4,
+#define IMPL_SEQFOR_DEC_DIGIT_6 5,
+#define IMPL_SEQFOR_DEC_DIGIT_7 6,
+#define IMPL_SEQFOR_DEC_DIGIT_8 7,
+#define IMPL_SEQFOR_DEC_DIGIT_9 8,
+// `IMPL_SEQFOR_IS_ZERO(x, ...)` returns `1` if all the digits are zero (leading zeros are allowed), or `0` otherwise.
+// Same as above, `IMPL_SEQFOR_IS_ZERO_x` returns the next position to check, and an empty `x` means we ran out of digits.
+#define IMPL_SEQFOR_IS_ZERO(x, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_IS_ZERO_, x)(IMPL_SEQFOR_IS_ZERO0)(__VA_ARGS__)
+#define IMPL_SEQFOR_IS_ZERO_(next) 1 IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_IS_ZERO_0(next) next
+#define IMPL_SEQFOR_IS_ZERO_1(next) 0 IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_IS_ZERO_2(next) 0 IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_IS_ZERO_3(next) 0 IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_IS_ZERO_4(next) 0 IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_IS_ZERO_5(next) 0 IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_IS_ZERO_6(next) 0 IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_IS_ZERO_7(next) 0 IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_IS_ZERO_8(next) 0 IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_IS_ZERO_9(next) 0 IMPL_SEQFOR_NULL
+
+// Implementation of `SF_FOR_EACH_ZIP`.
+// `IMPL_SEQFOR_ZIP_SPLIT(c...)` splits the sequences `c...` into `0, (tails...), heads...`, or returns `1, ()` if any of them is empty, or `2, ()` if there are too many of them.
+// `IMPL_SEQFOR_ZIP_COL(t, h, c, ...)` handles the sequence `c` at position ``, where `t` and `h` are the tails and heads
+//   collected so far, each starting with an extra comma. Same as `IMPL_SEQFOR_INC`, the next position is returned rather than called.
+#define IMPL_SEQFOR_ZIP_SPLIT(...) IMPL_SEQFOR_ZIP_COL((), (), __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL(t, h, c, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ZIP_HAS_, IMPL_SEQFOR_NONEMPTY(c))(IMPL_SEQFOR_ZIP_COL_)(t, h, IMPL_SEQFOR_ZIP_POP c, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL_(...) IMPL_SEQFOR_ZIP_COL__(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL__(t, h, x, c, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP_NEXT_, __VA_OPT__(1))(IMPL_SEQFOR_ZIP_COL0)((IMPL_SEQFOR_ZIP_EXPAND t, c), (IMPL_SEQFOR_ZIP_EXPAND h, IMPL_SEQFOR_ZIP_EXPAND x) __VA_OPT__(,) __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_HAS_(next) IMPL_SEQFOR_ZIP_STOP
+#define IMPL_SEQFOR_ZIP_HAS_1(next) next
+#define IMPL_SEQFOR_ZIP_NEXT_(next) IMPL_SEQFOR_ZIP_DONE
+#define IMPL_SEQFOR_ZIP_NEXT_1(next) next
+#define IMPL_SEQFOR_ZIP_STOP(...) 1, ()
+// The position after the last one. `generate.sh` renumbers it to match `SF_MAX_ZIP`.
+#define IMPL_SEQFOR_ZIP_COL9(...) 2, ()
+#define IMPL_SEQFOR_ZIP_DONE(t, h) 0, (IMPL_SEQFOR_ZIP_DROP_FIRST t) IMPL_SEQFOR_ZIP_EXPAND h
+#define IMPL_SEQFOR_ZIP_POP(...) (__VA_ARGS__),
+#define IMPL_SEQFOR_ZIP_EXPAND(...) __VA_ARGS__
+#define IMPL_SEQFOR_ZIP_DROP_FIRST(x, ...) __VA_ARGS__
 
-// `IMPL_SEQFOR_ANNOTATE_SEQ_END(IMPL_SEQFOR_ANNOTATE_SEQ_A seq)` converts `seq` from e.g. `(a)(b)(c)` to `()(a)()(b)()(c)(0)`.
-#define IMPL_SEQFOR_ANNOTATE_SEQ_A(...) ()(__VA_ARGS__)IMPL_SEQFOR_ANNOTATE_SEQ_B
-#define IMPL_SEQFOR_ANNOTATE_SEQ_B(...) ()(__VA_ARGS__)IMPL_SEQFOR_ANNOTATE_SEQ_A
-#define IMPL_SEQFOR_ANNOTATE_SEQ_A_END
-#define IMPL_SEQFOR_ANNOTATE_SEQ_B_END
-#define IMPL_SEQFOR_ANNOTATE_SEQ_END(x) IMPL_SEQFOR_ANNOTATE_SEQ_END_(x)(0)
-#define IMPL_SEQFOR_ANNOTATE_SEQ_END_(x) x##_END
+// Implementation of `SF_FOR_EACH_ARGS`, converting `a, b, c` to a guide, `)a))b))c)IMPL_SEQFOR_TO_GUIDE_A`.
+// A comma-separated list can't be consumed one element at a time like a sequence, since the rest of the list is always an argument
+//   of the same macro call. So `IMPL_SEQFOR_ARGS_STEP(...)` converts the first 16 elements at once, and passes the rest to the next step,
+//   which is a different macro to avoid recursion. Hence the limit on the number of elements.
+// The next step is called by `IMPL_SEQFOR_ARGS_STEP` itself (as the name returned by `_NEXT_1`), to avoid nesting it in the shared macros.
+#define IMPL_SEQFOR_ARGS_TO_GUIDE(...) __VA_OPT__(IMPL_SEQFOR_ARGS_STEP(__VA_ARGS__)) IMPL_SEQFOR_TO_GUIDE_A
+#define IMPL_SEQFOR_ARGS_STEP(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP0)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_CHUNK(...) IMPL_SEQFOR_ARGS_CHUNK_(IMPL_SEQFOR_ARGS_MORE(__VA_ARGS__), __VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_CHUNK_(c, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ARGS_HEAD_, c)(__VA_ARGS__) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ARGS_NEXT_, c)
+#define IMPL_SEQFOR_ARGS_NEXT_0(next) IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_ARGS_NEXT_1(next) next
+// `_HEAD_1` converts the first 16 elements of a longer list. `_HEAD_0` converts a list of 16 elements or less, using `_ELEMi` for the last `i+1` elements.
+#define IMPL_SEQFOR_ARGS_HEAD_1(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, ...) )a))b))c))d))e))f))g))h))i))j))k))l))m))n))o))p)
+#define IMPL_SEQFOR_ARGS_HEAD_0(...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ARGS_ELEM, IMPL_SEQFOR_ARGS_PICK(__VA_ARGS__, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_DROP(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, ...) __VA_ARGS__
+#define IMPL_SEQFOR_ARGS_PICK(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, x, ...) x
+// `IMPL_SEQFOR_ARGS_MORE(...)` returns `1` if there are more than 16 elements, or `0` otherwise.
+// We can't look at the 17th element directly, since it can be anything. So we pick it twice, padding the list with empty elements
+//   and with `1`s respectively, and check if the results are empty. They only differ if the element is missing.
+#define IMPL_SEQFOR_ARGS_MORE(...) IMPL_SEQFOR_ARGS_MORE_(IMPL_SEQFOR_ARGS_PICK(__VA_ARGS__,,,,,,,,,,,,,,,,,), IMPL_SEQFOR_ARGS_PICK(__VA_ARGS__, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1))
+#define IMPL_SEQFOR_ARGS_MORE_(x, y) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ARGS_MORE_X_, IMPL_SEQFOR_NONEMPTY(x))(y)
+#define IMPL_SEQFOR_ARGS_MORE_X_1(y) 1
+#define IMPL_SEQFOR_ARGS_MORE_X_(y) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ARGS_MORE_Y_, IMPL_SEQFOR_NONEMPTY(y))()
+#define IMPL_SEQFOR_ARGS_MORE_Y_1() 0
+#define IMPL_SEQFOR_ARGS_MORE_Y_() 1
+#define IMPL_SEQFOR_ARGS_ELEM15(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM14(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM14(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM13(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM13(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM12(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM12(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM11(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM11(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM10(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM10(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM9(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM9(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM8(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM8(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM7(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM7(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM6(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM6(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM5(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM5(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM4(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM4(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM3(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM3(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM2(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM2(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM1(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM1(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM0(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM0(x) )x)
 
-// `IMPL_SEQFOR_TO_GUIDE_A seq` converts `seq` from e.g. `(a)(b)(c)` to `a)b)c)IMPL_SEQFOR_TO_GUIDE_A` (or ...`_B`).
-// We call the resulting sequence `a)b)c)` a "guide".
-#define IMPL_SEQFOR_TO_GUIDE_A(...) __VA_ARGS__)IMPL_SEQFOR_TO_GUIDE_B
-#define IMPL_SEQFOR_TO_GUIDE_B(...) __VA_ARGS__)IMPL_SEQFOR_TO_GUIDE_A
+// `IMPL_SEQFOR_TO_GUIDE_A seq` converts `seq` from e.g. `(a)(b)(c)` to `)a))b))c)IMPL_SEQFOR_TO_GUIDE_A` (or ...`_B`), in a single pass.
+// We call the resulting sequence a "guide". The trailing `IMPL_SEQFOR_TO_GUIDE_{A,B}` acts as the terminator,
+//   see `IMPL_SEQFOR_FOR_GUIDE_A` below.
+// This used to be done in two passes, `(a)(b)` -> `()(a)()(b)(0)` -> `)a))b)0)`, which rescanned every element twice.
+#define IMPL_SEQFOR_TO_GUIDE_A(...) )__VA_ARGS__)IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_TO_GUIDE_B(...) )__VA_ARGS__)IMPL_SEQFOR_TO_GUIDE_A
 
-// Usage: `IMPL_SEQFOR_FOR_GUIDE_A(m,s,d,`, followed by a sequence of 0+ blocks of the form `)x)`, followed by `0)`, finally followed by arbitrary junk.
+// `IMPL_SEQFOR_SKIP_A(` followed by the rest of a guide discards it, along with the extra `)` after it. Used to stop loops early.
+// This needs two small macros per remaining element, and doesn't carry the loop state.
+#define IMPL_SEQFOR_SKIP_A(e) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_SKIP_A_ IMPL_SEQFOR_SKIP_B
+#define IMPL_SEQFOR_SKIP_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SKIP_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SKIP_B(...) IMPL_SEQFOR_SKIP_A(
+
+// Usage: `IMPL_SEQFOR_FOR_GUIDE_A(m,s,f,d,`, followed by a sequence of 0+ blocks of the form `)x)`,
+//   followed by `IMPL_SEQFOR_TO_GUIDE_{A,B}) )` (as produced by `IMPL_SEQFOR_TO_GUIDE_A`, plus one extra `)`).
 // For each `)x)` in the sequence, expands to `m(r,d,x)`, then modifies `d` to contain `s(r,d,x)`, where `r` is the next available loop nesting level.
-#define IMPL_SEQFOR_FOR_GUIDE_A(m, s, f, d, e) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FOR_GUIDE_A_, e)(m, s, f, d)
-#define IMPL_SEQFOR_FOR_GUIDE_A_(m, s, f, d) IMPL_SEQFOR_FOR_GUIDE_B(m, s, f, d,
-#define IMPL_SEQFOR_FOR_GUIDE_A_0(m, s, f, d) f(0, d) IMPL_SEQFOR_NULL(
+// Every macro here receives the whole state, so every one of them costs `O(|d|)` per iteration. Hence we try to keep their number low:
+//   `_A` pastes the guide element `e` directly with `##` (rather than through `IMPL_SEQFOR_CAT_`, which would be one more call per iteration),
+//   and the result is an object-like macro naming the next step, which then picks up the `(m, s, f, d,` left by `_A`.
+//   The other loops below do the same.
+#define IMPL_SEQFOR_FOR_GUIDE_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE_A_ IMPL_SEQFOR_FOR_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE_END
+#define IMPL_SEQFOR_FOR_GUIDE_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE_END
+#define IMPL_SEQFOR_FOR_GUIDE_END(m, s, f, d, ...) f(0, d)
 #define IMPL_SEQFOR_FOR_GUIDE_B(m, s, f, d, ...) m(0, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE_B_0(m, s, f, s(0, d, __VA_ARGS__))
 #define IMPL_SEQFOR_FOR_GUIDE_B_0(...) IMPL_SEQFOR_FOR_GUIDE_B_1(__VA_ARGS__)
 #define IMPL_SEQFOR_FOR_GUIDE_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE_A(m, s, f, d,
 
+// Same as `IMPL_SEQFOR_FOR_GUIDE_A`, but for `SF_FOR_EACH_FAST`. `_B` passes `s(...)` unexpanded as the new state,
+//   and it gets expanded as an argument of `_A`.
+#define IMPL_SEQFOR_FAST_A(m, s, f, d, e) IMPL_SEQFOR_FAST_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST_A_ IMPL_SEQFOR_FAST_B
+#define IMPL_SEQFOR_FAST_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE_END
+#define IMPL_SEQFOR_FAST_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE_END
+#define IMPL_SEQFOR_FAST_B(m, s, f, d, ...) m(0, d, __VA_ARGS__) IMPL_SEQFOR_FAST_A(m, s, f, s(0, d, __VA_ARGS__),
+
+// Same as `IMPL_SEQFOR_FOR_GUIDE_A`, but for `SF_FOR_EACH_UNTIL`. `_B_1` receives the stop flag from `s` and either continues or stops.
+#define IMPL_SEQFOR_UNTIL_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL_A_ IMPL_SEQFOR_UNTIL_B
+#define IMPL_SEQFOR_UNTIL_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE_END
+#define IMPL_SEQFOR_UNTIL_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE_END
+#define IMPL_SEQFOR_UNTIL_B(m, s, f, d, ...) m(0, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL_B_0(m, s, f, s(0, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL_B_0(...) IMPL_SEQFOR_UNTIL_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL_B_1_0 IMPL_SEQFOR_UNTIL_A
+#define IMPL_SEQFOR_UNTIL_B_1_1 IMPL_SEQFOR_UNTIL_STOP
+#define IMPL_SEQFOR_UNTIL_STOP(m, s, f, d, e) f(0, d) IMPL_SEQFOR_SKIP_A_##e(
+
+// Same as `IMPL_SEQFOR_FAST_A`, but for `SF_FOR_EACH_ZIP`. `r` is the list of the remaining sequences other than the first one.
+// `_B` splits them into heads and tails, `_B_1` stops the loop if any of them ran out, then `_C` spreads the heads into the arguments of `m`.
+#define IMPL_SEQFOR_ZIP_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP_A_ IMPL_SEQFOR_ZIP_B
+#define IMPL_SEQFOR_ZIP_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE_END
+#define IMPL_SEQFOR_ZIP_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE_END
+#define IMPL_SEQFOR_ZIP_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP_B_0(...) IMPL_SEQFOR_ZIP_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_B_1_0 IMPL_SEQFOR_ZIP_C
+#define IMPL_SEQFOR_ZIP_B_1_1(m, s, f, d, ...) f(0, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP_C(m, s, f, d, r, ...) m(0, d, __VA_ARGS__) IMPL_SEQFOR_ZIP_A(m, s, f, s(0, d, __VA_ARGS__), r,
+
+// Same as `IMPL_SEQFOR_FOR_GUIDE_A`, but for `SF_FOR_EACH_SIMPLE`. Only `m` is passed around.
+#define IMPL_SEQFOR_SIMPLE_A(m, e) IMPL_SEQFOR_SIMPLE_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE_A_ IMPL_SEQFOR_SIMPLE_B
+#define IMPL_SEQFOR_SIMPLE_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE_B(m, ...) m(0, __VA_ARGS__) IMPL_SEQFOR_SIMPLE_A(m,
+
+// Implementation of the sequence algorithms. They are the same as `IMPL_SEQFOR_SIMPLE_A`, except for what they pass around and emit.
+// Those not calling user macros don't need per-level copies, but they need their own `IMPL_SEQFOR_SEQ_IDENTITY`,
+//   to be usable in loop bodies, which expand inside of `IMPL_SEQFOR_IDENTITY`.
+#define IMPL_SEQFOR_SEQ_IDENTITY(...) __VA_ARGS__
+// `SF_SEQ_SIZE` carries a counter, which is cheap to increment.
+#define IMPL_SEQFOR_SIZE_A(c, e) IMPL_SEQFOR_SIZE_A_##e(c,
+#define IMPL_SEQFOR_SIZE_A_ IMPL_SEQFOR_SIZE_B
+#define IMPL_SEQFOR_SIZE_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_SIZE_END
+#define IMPL_SEQFOR_SIZE_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_SIZE_END
+#define IMPL_SEQFOR_SIZE_END(c, ...) SF_COUNTER(c)
+#define IMPL_SEQFOR_SIZE_B(c, ...) IMPL_SEQFOR_SIZE_A((IMPL_SEQFOR_INC c),
+// `SF_SEQ_ELEM` counts the index down to zero, then emits the element and skips the rest.
+#define IMPL_SEQFOR_ELEM_A(i, e) IMPL_SEQFOR_ELEM_A_##e(i,
+#define IMPL_SEQFOR_ELEM_A_ IMPL_SEQFOR_ELEM_B
+#define IMPL_SEQFOR_ELEM_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_ELEM_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_ELEM_B(i, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ELEM_B_, IMPL_SEQFOR_IS_ZERO i)(i, __VA_ARGS__)
+#define IMPL_SEQFOR_ELEM_B_0(i, ...) IMPL_SEQFOR_ELEM_A((IMPL_SEQFOR_DEC i),
+#define IMPL_SEQFOR_ELEM_B_1(i, ...) __VA_ARGS__ IMPL_SEQFOR_SKIP_A(
+// `SF_SEQ_TO_ARGS` doesn't need a guide, since it doesn't need to stop. It uses the old trick of pasting `_END` to the leftover macro name.
+#define IMPL_SEQFOR_TO_ARGS_A(...) __VA_ARGS__ IMPL_SEQFOR_TO_ARGS_B
+#define IMPL_SEQFOR_TO_ARGS_B(...) , __VA_ARGS__ IMPL_SEQFOR_TO_ARGS_C
+#define IMPL_SEQFOR_TO_ARGS_C(...) , __VA_ARGS__ IMPL_SEQFOR_TO_ARGS_B
+#define IMPL_SEQFOR_TO_ARGS_END(...) IMPL_SEQFOR_TO_ARGS_END_(__VA_ARGS__)
+#define IMPL_SEQFOR_TO_ARGS_END_(...) __VA_ARGS__##_END
+#define IMPL_SEQFOR_TO_ARGS_A_END
+#define IMPL_SEQFOR_TO_ARGS_B_END
+#define IMPL_SEQFOR_TO_ARGS_C_END
+// `SF_SEQ_REVERSE` prepends every element to the state.
+#define IMPL_SEQFOR_REVERSE_A(d, e) IMPL_SEQFOR_REVERSE_A_##e(d,
+#define IMPL_SEQFOR_REVERSE_A_ IMPL_SEQFOR_REVERSE_B
+#define IMPL_SEQFOR_REVERSE_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_REVERSE_END
+#define IMPL_SEQFOR_REVERSE_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_REVERSE_END
+#define IMPL_SEQFOR_REVERSE_END(d, ...) d
+#define IMPL_SEQFOR_REVERSE_B(d, ...) IMPL_SEQFOR_REVERSE_A((__VA_ARGS__)d,
+// `SF_SEQ_MAP` and `SF_SEQ_FILTER` call user macros, so they need per-level copies, same as the loops.
+#define IMPL_SEQFOR_MAP_A(m, e) IMPL_SEQFOR_MAP_A_##e(m,
+#define IMPL_SEQFOR_MAP_A_ IMPL_SEQFOR_MAP_B
+#define IMPL_SEQFOR_MAP_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP_B(m, ...) (m(0, __VA_ARGS__)) IMPL_SEQFOR_MAP_A(m,
+#define IMPL_SEQFOR_FILTER_A(p, e) IMPL_SEQFOR_FILTER_A_##e(p,
+#define IMPL_SEQFOR_FILTER_A_ IMPL_SEQFOR_FILTER_B
+#define IMPL_SEQFOR_FILTER_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(0, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_A(p,
+#define IMPL_SEQFOR_FILTER_0(...)
+#define IMPL_SEQFOR_FILTER_1(...) (__VA_ARGS__)
+
+// Implementation of the pipelines. Same as above, but they emit guide elements instead of sequence elements, and the terminator at the end.
+// The `_G` macros above can pass the guide directly to `_A`, since it's already expanded as their argument. This replaces `IMPL_SEQFOR_IDENTITY`,
+//   which only exists to expand `IMPL_SEQFOR_TO_GUIDE_A seq` before `_A` is called.
+#define IMPL_SEQFOR_TO_ARGS_G_A(e) IMPL_SEQFOR_TO_ARGS_G_A_##e(
+#define IMPL_SEQFOR_TO_ARGS_G_A_ IMPL_SEQFOR_TO_ARGS_G_B
+#define IMPL_SEQFOR_TO_ARGS_G_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_TO_ARGS_G_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_TO_ARGS_G_B(...) __VA_ARGS__ IMPL_SEQFOR_TO_ARGS_G_C(
+#define IMPL_SEQFOR_TO_ARGS_G_C(e) IMPL_SEQFOR_TO_ARGS_G_C_##e(
+#define IMPL_SEQFOR_TO_ARGS_G_C_ IMPL_SEQFOR_TO_ARGS_G_D
+#define IMPL_SEQFOR_TO_ARGS_G_C_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_TO_ARGS_G_C_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_TO_ARGS_G_D(...) , __VA_ARGS__ IMPL_SEQFOR_TO_ARGS_G_C(
+#define IMPL_SEQFOR_GUIDE_END(...) IMPL_SEQFOR_TO_GUIDE_A
+#define IMPL_SEQFOR_MAP_G_A(m, e) IMPL_SEQFOR_MAP_G_A_##e(m,
+#define IMPL_SEQFOR_MAP_G_A_ IMPL_SEQFOR_MAP_G_B
+#define IMPL_SEQFOR_MAP_G_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G_B(m, ...) )m(0, __VA_ARGS__)) IMPL_SEQFOR_MAP_G_A(m,
+#define IMPL_SEQFOR_FILTER_G_A(p, e) IMPL_SEQFOR_FILTER_G_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G_A_ IMPL_SEQFOR_FILTER_G_B
+#define IMPL_SEQFOR_FILTER_G_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(0, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G_A(p,
+#define IMPL_SEQFOR_FILTER_G_0(...)
+#define IMPL_SEQFOR_FILTER_G_1(...) )__VA_ARGS__)
+
+// Implementation of `SF_ITERATE`, see "macro_sequence_for_iterate.h" for the inclusion logic.
+// Every chunk walks the whole sequence: `_SKIP_A` only calls `s` on the elements before the chunk, `_TAKE_A` calls `m` and `s` on the chunk,
+//   then the rest is discarded with `IMPL_SEQFOR_SKIP_A`. `f` is called only if the end of the sequence is reached while in the chunk.
+// Both count the remaining elements as `c, u`, meaning `c*10+u`, where `c` is a counter and `u` is a digit. `u` is pasted into the name
+//   of the next step, so only every 10th element has to touch the counter. Since the chunk size is a power of ten,
+//   the chunk digits `IMPL_SEQFOR_ITER_C{0..3}` give us those numbers without any arithmetic, see `IMPL_SEQFOR_ITER_{FIRST,COUNT}`.
+// This is cheaper than `SF_FOR_EACH` with a counter in the state, both in time and in memory, which matters since it runs on every chunk.
+#define IMPL_SEQFOR_ITER_LOOP IMPL_SEQFOR_ITER_LOOP_(SF_ITERATE_SEQ)
+#define IMPL_SEQFOR_ITER_LOOP_(seq) IMPL_SEQFOR_ITER_IDENTITY( IMPL_SEQFOR_ITER_SKIP_A IMPL_SEQFOR_LPAREN IMPL_SEQFOR_ITER_FIRST, SF_ITERATE_D, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define IMPL_SEQFOR_ITER_IDENTITY(...) __VA_ARGS__
+// The index of the first element of the current chunk, for `#if`.
+#define IMPL_SEQFOR_ITER_START ((((IMPL_SEQFOR_ITER_C3 * 10 + IMPL_SEQFOR_ITER_C2) * 10 + IMPL_SEQFOR_ITER_C1) * 10 + IMPL_SEQFOR_ITER_C0) * (SF_ITERATE_CHUNK))
+#define IMPL_SEQFOR_ITER_SKIP_A(c, u, d, e) IMPL_SEQFOR_ITER_SKIP_A_##e(c, u, d,
+#define IMPL_SEQFOR_ITER_SKIP_A_ IMPL_SEQFOR_ITER_SKIP_B
+#define IMPL_SEQFOR_ITER_SKIP_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_ITER_END
+#define IMPL_SEQFOR_ITER_SKIP_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_ITER_END
+#define IMPL_SEQFOR_ITER_SKIP_B(c, u, d, ...) IMPL_SEQFOR_ITER_SKIP_B_##u(c, d, __VA_ARGS__)
+#define IMPL_SEQFOR_ITER_SKIP_B_0(c, d, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ITER_SKIP_C_, IMPL_SEQFOR_IS_ZERO c)(c, d, __VA_ARGS__)
+#define IMPL_SEQFOR_ITER_SKIP_B_1(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A(c, 0, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_B_2(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A(c, 1, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_B_3(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A(c, 2, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_B_4(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A(c, 3, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_B_5(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A(c, 4, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_B_6(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A(c, 5, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_B_7(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A(c, 6, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_B_8(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A(c, 7, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_B_9(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A(c, 8, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_C_0(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A((IMPL_SEQFOR_DEC c), 9, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_C_1(c, d, ...) IMPL_SEQFOR_ITER_TAKE_FIRST(IMPL_SEQFOR_ITER_COUNT, d, __VA_ARGS__)
+#define IMPL_SEQFOR_ITER_TAKE_FIRST(...) IMPL_SEQFOR_ITER_TAKE_B(__VA_ARGS__)
+#define IMPL_SEQFOR_ITER_TAKE_A(c, u, d, e) IMPL_SEQFOR_ITER_TAKE_A_##e(c, u, d,
+#define IMPL_SEQFOR_ITER_TAKE_A_ IMPL_SEQFOR_ITER_TAKE_B
+#define IMPL_SEQFOR_ITER_TAKE_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_ITER_END
+#define IMPL_SEQFOR_ITER_TAKE_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_ITER_END
+#define IMPL_SEQFOR_ITER_TAKE_B(c, u, d, ...) SF_ITERATE_M(0, d, __VA_ARGS__) IMPL_SEQFOR_ITER_TAKE_C_##u(c, SF_ITERATE_S(0, d, __VA_ARGS__))
+#define IMPL_SEQFOR_ITER_TAKE_C_0(c, d) IMPL_SEQFOR_ITER_TAKE_A((IMPL_SEQFOR_DEC c), 9, d,
+#define IMPL_SEQFOR_ITER_TAKE_C_1(c, d) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ITER_TAKE_D_, IMPL_SEQFOR_IS_ZERO c)(c, d)
+#define IMPL_SEQFOR_ITER_TAKE_C_2(c, d) IMPL_SEQFOR_ITER_TAKE_A(c, 1, d,
+#define IMPL_SEQFOR_ITER_TAKE_C_3(c, d) IMPL_SEQFOR_ITER_TAKE_A(c, 2, d,
+#define IMPL_SEQFOR_ITER_TAKE_C_4(c, d) IMPL_SEQFOR_ITER_TAKE_A(c, 3, d,
+#define IMPL_SEQFOR_ITER_TAKE_C_5(c, d) IMPL_SEQFOR_ITER_TAKE_A(c, 4, d,
+#define IMPL_SEQFOR_ITER_TAKE_C_6(c, d) IMPL_SEQFOR_ITER_TAKE_A(c, 5, d,
+#define IMPL_SEQFOR_ITER_TAKE_C_7(c, d) IMPL_SEQFOR_ITER_TAKE_A(c, 6, d,
+#define IMPL_SEQFOR_ITER_TAKE_C_8(c, d) IMPL_SEQFOR_ITER_TAKE_A(c, 7, d,
+#define IMPL_SEQFOR_ITER_TAKE_C_9(c, d) IMPL_SEQFOR_ITER_TAKE_A(c, 8, d,
+#define IMPL_SEQFOR_ITER_TAKE_D_0(c, d) IMPL_SEQFOR_ITER_TAKE_A(c, 0, d,
+#define IMPL_SEQFOR_ITER_TAKE_D_1(c, d) IMPL_SEQFOR_ITER_STOP(d,
+// The chunk is done. If this was the last element, call `f` anyway, otherwise skip the rest.
+#define IMPL_SEQFOR_ITER_STOP(d, e) IMPL_SEQFOR_ITER_STOP_##e(, , d,
+#define IMPL_SEQFOR_ITER_STOP_(...) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ITER_STOP_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_ITER_END
+#define IMPL_SEQFOR_ITER_STOP_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_ITER_END
+#define IMPL_SEQFOR_ITER_END(c, u, d, ...) SF_ITERATE_F(0, d)
+// `IMPL_SEQFOR_ITER_IN_RANGE` is `1` if the sequence has an element at `IMPL_SEQFOR_ITER_START`, or `0` otherwise, for `#if`.
+// Counts down from `IMPL_SEQFOR_ITER_FIRST` like `_SKIP_A` (but without the state), and discards the rest of the sequence
+//   as soon as the element is found. Unlike `SF_SEQ_SIZE`, this doesn't touch the counter past the chunk start.
+#define IMPL_SEQFOR_ITER_IN_RANGE IMPL_SEQFOR_ITER_IN_RANGE_(SF_ITERATE_SEQ)
+#define IMPL_SEQFOR_ITER_IN_RANGE_(seq) IMPL_SEQFOR_ITER_IDENTITY( IMPL_SEQFOR_ITER_HAS_A IMPL_SEQFOR_LPAREN IMPL_SEQFOR_ITER_FIRST, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define IMPL_SEQFOR_ITER_HAS_A(c, u, e) IMPL_SEQFOR_ITER_HAS_A_##e(c, u,
+#define IMPL_SEQFOR_ITER_HAS_A_ IMPL_SEQFOR_ITER_HAS_B
+#define IMPL_SEQFOR_ITER_HAS_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_ITER_HAS_END
+#define IMPL_SEQFOR_ITER_HAS_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_ITER_HAS_END
+#define IMPL_SEQFOR_ITER_HAS_B(c, u, ...) IMPL_SEQFOR_ITER_HAS_B_##u(c)
+#define IMPL_SEQFOR_ITER_HAS_B_0(c) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ITER_HAS_C_, IMPL_SEQFOR_IS_ZERO c)(c)
+#define IMPL_SEQFOR_ITER_HAS_B_1(c) IMPL_SEQFOR_ITER_HAS_A(c, 0,
+#define IMPL_SEQFOR_ITER_HAS_B_2(c) IMPL_SEQFOR_ITER_HAS_A(c, 1,
+#define IMPL_SEQFOR_ITER_HAS_B_3(c) IMPL_SEQFOR_ITER_HAS_A(c, 2,
+#define IMPL_SEQFOR_ITER_HAS_B_4(c) IMPL_SEQFOR_ITER_HAS_A(c, 3,
+#define IMPL_SEQFOR_ITER_HAS_B_5(c) IMPL_SEQFOR_ITER_HAS_A(c, 4,
+#define IMPL_SEQFOR_ITER_HAS_B_6(c) IMPL_SEQFOR_ITER_HAS_A(c, 5,
+#define IMPL_SEQFOR_ITER_HAS_B_7(c) IMPL_SEQFOR_ITER_HAS_A(c, 6,
+#define IMPL_SEQFOR_ITER_HAS_B_8(c) IMPL_SEQFOR_ITER_HAS_A(c, 7,
+#define IMPL_SEQFOR_ITER_HAS_B_9(c) IMPL_SEQFOR_ITER_HAS_A(c, 8,
+#define IMPL_SEQFOR_ITER_HAS_C_0(c) IMPL_SEQFOR_ITER_HAS_A((IMPL_SEQFOR_DEC c), 9,
+#define IMPL_SEQFOR_ITER_HAS_C_1(c) 1 IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ITER_HAS_END(...) 0
+
+// Implementation of `SF_TRACE`. The loops only call `IMPL_SEQFOR_TRACE_BEGIN`, once per loop, and it's empty unless tracing is enabled.
+// The other markers are added by redefining the object-like macros that name the next step, so without `SF_TRACE` the iterations are unaffected.
+// `generate.sh` repeats this `#ifdef` for every nesting level.
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_BEGIN(name, n) IMPL_SEQFOR_TRACE_PRAGMA(begin name n __FILE__ __LINE__)
+#define IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_TRACE_PRAGMA(iter)
+#define IMPL_SEQFOR_TRACE_END(...) IMPL_SEQFOR_TRACE_PRAGMA(end __VA_ARGS__)
+#define IMPL_SEQFOR_TRACE_PRAGMA(...) _Pragma(IMPL_SEQFOR_TRACE_STR(sf_trace __VA_ARGS__))
+#define IMPL_SEQFOR_TRACE_STR(...) #__VA_ARGS__
+#define IMPL_SEQFOR_TRACE_SIMPLE_END(...) IMPL_SEQFOR_TRACE_END()
+// `_FINAL` replaces `IMPL_SEQFOR_FOR_GUIDE_END`, `_STOP` replaces `IMPL_SEQFOR_UNTIL_STOP`.
+#define IMPL_SEQFOR_TRACE_FINAL(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE_A_
+#undef IMPL_SEQFOR_FOR_GUIDE_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST_A_
+#undef IMPL_SEQFOR_FAST_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL_A_
+#undef IMPL_SEQFOR_UNTIL_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL_B_1_1
+#undef IMPL_SEQFOR_ZIP_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP_B_1_0
+#undef IMPL_SEQFOR_ZIP_B_1_1
+#undef IMPL_SEQFOR_SIMPLE_A_
+#undef IMPL_SEQFOR_SIMPLE_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL
+#define IMPL_SEQFOR_FOR_GUIDE_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL
+#define IMPL_SEQFOR_FAST_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST_B
+#define IMPL_SEQFOR_FAST_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL
+#define IMPL_SEQFOR_FAST_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL
+#define IMPL_SEQFOR_UNTIL_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL_B
+#define IMPL_SEQFOR_UNTIL_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL
+#define IMPL_SEQFOR_UNTIL_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL
+#define IMPL_SEQFOR_UNTIL_B_1_1 IMPL_SEQFOR_TRACE_STOP
+#define IMPL_SEQFOR_ZIP_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL
+#define IMPL_SEQFOR_ZIP_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL
+#define IMPL_SEQFOR_ZIP_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP_C
+#define IMPL_SEQFOR_ZIP_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE_B
+#define IMPL_SEQFOR_SIMPLE_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#else
+#define IMPL_SEQFOR_TRACE_BEGIN(name, n)
+#endif // SF_TRACE
+
+
+// Generated boilerplate for nested loops, see `SF_MAX_DEPTH`:
+#if SF_MAX_DEPTH > 0
+#include "macro_sequence_for/level_0.h"
+#endif
+#if SF_MAX_DEPTH > 1
+#include "macro_sequence_for/level_1.h"
+#endif
+#if SF_MAX_DEPTH > 2
+#include "macro_sequence_for/level_2.h"
+#endif
+#if SF_MAX_DEPTH > 3
+#include "macro_sequence_for/level_3.h"
+#endif
+#if SF_MAX_DEPTH > 4
+#include "macro_sequence_for/level_4.h"
+#endif
+#if SF_MAX_DEPTH > 5
+#include "macro_sequence_for/level_5.h"
+#endif
+#if SF_MAX_DEPTH > 6
+#include "macro_sequence_for/level_6.h"
+#endif
+#if SF_MAX_DEPTH > 7
+#include "macro_sequence_for/level_7.h"
+#endif
+#if SF_MAX_DEPTH > 8
+#include "macro_sequence_for/level_8.h"
+#endif
+#if SF_MAX_DEPTH > 9
+#include "macro_sequence_for/level_9.h"
+#endif
+#if SF_MAX_DEPTH > 10
+#include "macro_sequence_for/level_10.h"
+#endif
+#if SF_MAX_DEPTH > 11
+#include "macro_sequence_for/level_11.h"
+#endif
+#if SF_MAX_DEPTH > 12
+#include "macro_sequence_for/level_12.h"
+#endif
+#if SF_MAX_DEPTH > 13
+#include "macro_sequence_for/level_13.h"
+#endif
+#if SF_MAX_DEPTH > 14
+#include "macro_sequence_for/level_14.h"
+#endif
+#if SF_MAX_DEPTH > 15
+#include "macro_sequence_for/level_15.h"
+#endif
+#if SF_MAX_DEPTH > 16
+#include "macro_sequence_for/level_16.h"
+#endif
+#if SF_MAX_DEPTH > 17
+#include "macro_sequence_for/level_17.h"
+#endif
+#if SF_MAX_DEPTH > 18
+#include "macro_sequence_for/level_18.h"
+#endif
+#if SF_MAX_DEPTH > 19
+#include "macro_sequence_for/level_19.h"
+#endif
+#if SF_MAX_DEPTH > 20
+#include "macro_sequence_for/level_20.h"
+#endif
+#if SF_MAX_DEPTH > 21
+#include "macro_sequence_for/level_21.h"
+#endif
+#if SF_MAX_DEPTH > 22
+#include "macro_sequence_for/level_22.h"
+#endif
+#if SF_MAX_DEPTH > 23
+#include "macro_sequence_for/level_23.h"
+#endif
+#if SF_MAX_DEPTH > 24
+#include "macro_sequence_for/level_24.h"
+#endif
+#if SF_MAX_DEPTH > 25
+#include "macro_sequence_for/level_25.h"
+#endif
+#if SF_MAX_DEPTH > 26
+#include "macro_sequence_for/level_26.h"
+#endif
+#if SF_MAX_DEPTH > 27
+#include "macro_sequence_for/level_27.h"
+#endif
+#if SF_MAX_DEPTH > 28
+#include "macro_sequence_for/level_28.h"
+#endif
+#if SF_MAX_DEPTH > 29
+#include "macro_sequence_for/level_29.h"
+#endif
+#if SF_MAX_DEPTH > 30
+#include "macro_sequence_for/level_30.h"
+#endif
+#if SF_MAX_DEPTH > 31
+#include "macro_sequence_for/level_31.h"
+#endif
+#if SF_MAX_DEPTH > 32
+#include "macro_sequence_for/level_32.h"
+#endif
+#if SF_MAX_DEPTH > 33
+#include "macro_sequence_for/level_33.h"
+#endif
+#if SF_MAX_DEPTH > 34
+#include "macro_sequence_for/level_34.h"
+#endif
+#if SF_MAX_DEPTH > 35
+#include "macro_sequence_for/level_35.h"
+#endif
+#if SF_MAX_DEPTH > 36
+#include "macro_sequence_for/level_36.h"
+#endif
+#if SF_MAX_DEPTH > 37
+#include "macro_sequence_for/level_37.h"
+#endif
+#if SF_MAX_DEPTH > 38
+#include "macro_sequence_for/level_38.h"
+#endif
+#if SF_MAX_DEPTH > 39
+#include "macro_sequence_for/level_39.h"
+#endif
+#if SF_MAX_DEPTH > 40
+#include "macro_sequence_for/level_40.h"
+#endif
+#if SF_MAX_DEPTH > 41
+#include "macro_sequence_for/level_41.h"
+#endif
+#if SF_MAX_DEPTH > 42
+#include "macro_sequence_for/level_42.h"
+#endif
+#if SF_MAX_DEPTH > 43
+#include "macro_sequence_for/level_43.h"
+#endif
+#if SF_MAX_DEPTH > 44
+#include "macro_sequence_for/level_44.h"
+#endif
+#if SF_MAX_DEPTH > 45
+#include "macro_sequence_for/level_45.h"
+#endif
+#if SF_MAX_DEPTH > 46
+#include "macro_sequence_for/level_46.h"
+#endif
+#if SF_MAX_DEPTH > 47
+#include "macro_sequence_for/level_47.h"
+#endif
+#if SF_MAX_DEPTH > 48
+#include "macro_sequence_for/level_48.h"
+#endif
+#if SF_MAX_DEPTH > 49
+#include "macro_sequence_for/level_49.h"
+#endif
+#if SF_MAX_DEPTH > 50
+#include "macro_sequence_for/level_50.h"
+#endif
+#if SF_MAX_DEPTH > 51
+#include "macro_sequence_for/level_51.h"
+#endif
+#if SF_MAX_DEPTH > 52
+#include "macro_sequence_for/level_52.h"
+#endif
+#if SF_MAX_DEPTH > 53
+#include "macro_sequence_for/level_53.h"
+#endif
+#if SF_MAX_DEPTH > 54
+#include "macro_sequence_for/level_54.h"
+#endif
+#if SF_MAX_DEPTH > 55
+#include "macro_sequence_for/level_55.h"
+#endif
+#if SF_MAX_DEPTH > 56
+#include "macro_sequence_for/level_56.h"
+#endif
+#if SF_MAX_DEPTH > 57
+#include "macro_sequence_for/level_57.h"
+#endif
+#if SF_MAX_DEPTH > 58
+#include "macro_sequence_for/level_58.h"
+#endif
+#if SF_MAX_DEPTH > 59
+#include "macro_sequence_for/level_59.h"
+#endif
+#if SF_MAX_DEPTH > 60
+#include "macro_sequence_for/level_60.h"
+#endif
+#if SF_MAX_DEPTH > 61
+#include "macro_sequence_for/level_61.h"
+#endif
+#if SF_MAX_DEPTH > 62
+#include "macro_sequence_for/level_62.h"
+#endif
+#if SF_MAX_DEPTH > 63
+#include "macro_sequence_for/level_63.h"
+#endif
+
+// Generated boilerplate for counters:
+#define IMPL_SEQFOR_INC0(x, ...) IMPL_SEQFOR_INC0_(IMPL_SEQFOR_INC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_INC0_(...) IMPL_SEQFOR_INC0__(__VA_ARGS__)
+#define IMPL_SEQFOR_INC0__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_INC1)(__VA_ARGS__)
+#define IMPL_SEQFOR_LIT0(acc, x, ...) IMPL_SEQFOR_LIT_FIRST(__VA_OPT__(IMPL_SEQFOR_LIT1(x##acc, __VA_ARGS__),) x##acc)
+#define IMPL_SEQFOR_DEC0(x, ...) IMPL_SEQFOR_DEC0_(IMPL_SEQFOR_DEC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_DEC0_(...) IMPL_SEQFOR_DEC0__(__VA_ARGS__)
+#define IMPL_SEQFOR_DEC0__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_DEC1)(__VA_ARGS__)
+#define IMPL_SEQFOR_IS_ZERO0(x, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_IS_ZERO_, x)(IMPL_SEQFOR_IS_ZERO1)(__VA_ARGS__)
+#define IMPL_SEQFOR_INC1(x, ...) IMPL_SEQFOR_INC1_(IMPL_SEQFOR_INC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_INC1_(...) IMPL_SEQFOR_INC1__(__VA_ARGS__)
+#define IMPL_SEQFOR_INC1__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_INC2)(__VA_ARGS__)
+#define IMPL_SEQFOR_LIT1(acc, x, ...) IMPL_SEQFOR_LIT_FIRST(__VA_OPT__(IMPL_SEQFOR_LIT2(x##acc, __VA_ARGS__),) x##acc)
+#define IMPL_SEQFOR_DEC1(x, ...) IMPL_SEQFOR_DEC1_(IMPL_SEQFOR_DEC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_DEC1_(...) IMPL_SEQFOR_DEC1__(__VA_ARGS__)
+#define IMPL_SEQFOR_DEC1__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_DEC2)(__VA_ARGS__)
+#define IMPL_SEQFOR_IS_ZERO1(x, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_IS_ZERO_, x)(IMPL_SEQFOR_IS_ZERO2)(__VA_ARGS__)
+#define IMPL_SEQFOR_INC2(x, ...) IMPL_SEQFOR_INC2_(IMPL_SEQFOR_INC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_INC2_(...) IMPL_SEQFOR_INC2__(__VA_ARGS__)
+#define IMPL_SEQFOR_INC2__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_INC3)(__VA_ARGS__)
+#define IMPL_SEQFOR_LIT2(acc, x, ...) IMPL_SEQFOR_LIT_FIRST(__VA_OPT__(IMPL_SEQFOR_LIT3(x##acc, __VA_ARGS__),) x##acc)
+#define IMPL_SEQFOR_DEC2(x, ...) IMPL_SEQFOR_DEC2_(IMPL_SEQFOR_DEC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_DEC2_(...) IMPL_SEQFOR_DEC2__(__VA_ARGS__)
+#define IMPL_SEQFOR_DEC2__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_DEC3)(__VA_ARGS__)
+#define IMPL_SEQFOR_IS_ZERO2(x, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_IS_ZERO_, x)(IMPL_SEQFOR_IS_ZERO3)(__VA_ARGS__)
+#define IMPL_SEQFOR_INC3(x, ...) IMPL_SEQFOR_INC3_(IMPL_SEQFOR_INC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_INC3_(...) IMPL_SEQFOR_INC3__(__VA_ARGS__)
+#define IMPL_SEQFOR_INC3__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_INC4)(__VA_ARGS__)
+#define IMPL_SEQFOR_LIT3(acc, x, ...) IMPL_SEQFOR_LIT_FIRST(__VA_OPT__(IMPL_SEQFOR_LIT4(x##acc, __VA_ARGS__),) x##acc)
+#define IMPL_SEQFOR_DEC3(x, ...) IMPL_SEQFOR_DEC3_(IMPL_SEQFOR_DEC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_DEC3_(...) IMPL_SEQFOR_DEC3__(__VA_ARGS__)
+#define IMPL_SEQFOR_DEC3__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_DEC4)(__VA_ARGS__)
+#define IMPL_SEQFOR_IS_ZERO3(x, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_IS_ZERO_, x)(IMPL_SEQFOR_IS_ZERO4)(__VA_ARGS__)
+#define IMPL_SEQFOR_INC4(x, ...) IMPL_SEQFOR_INC4_(IMPL_SEQFOR_INC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_INC4_(...) IMPL_SEQFOR_INC4__(__VA_ARGS__)
+#define IMPL_SEQFOR_INC4__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_INC5)(__VA_ARGS__)
+#define IMPL_SEQFOR_LIT4(acc, x, ...) IMPL_SEQFOR_LIT_FIRST(__VA_OPT__(IMPL_SEQFOR_LIT5(x##acc, __VA_ARGS__),) x##acc)
+#define IMPL_SEQFOR_DEC4(x, ...) IMPL_SEQFOR_DEC4_(IMPL_SEQFOR_DEC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_DEC4_(...) IMPL_SEQFOR_DEC4__(__VA_ARGS__)
+#define IMPL_SEQFOR_DEC4__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_DEC5)(__VA_ARGS__)
+#define IMPL_SEQFOR_IS_ZERO4(x, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_IS_ZERO_, x)(IMPL_SEQFOR_IS_ZERO5)(__VA_ARGS__)
+#define IMPL_SEQFOR_INC5(x, ...) IMPL_SEQFOR_INC5_(IMPL_SEQFOR_INC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_INC5_(...) IMPL_SEQFOR_INC5__(__VA_ARGS__)
+#define IMPL_SEQFOR_INC5__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_INC6)(__VA_ARGS__)
+#define IMPL_SEQFOR_LIT5(acc, x, ...) IMPL_SEQFOR_LIT_FIRST(__VA_OPT__(IMPL_SEQFOR_LIT6(x##acc, __VA_ARGS__),) x##acc)
+#define IMPL_SEQFOR_DEC5(x, ...) IMPL_SEQFOR_DEC5_(IMPL_SEQFOR_DEC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_DEC5_(...) IMPL_SEQFOR_DEC5__(__VA_ARGS__)
+#define IMPL_SEQFOR_DEC5__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_DEC6)(__VA_ARGS__)
+#define IMPL_SEQFOR_IS_ZERO5(x, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_IS_ZERO_, x)(IMPL_SEQFOR_IS_ZERO6)(__VA_ARGS__)
+#define IMPL_SEQFOR_INC6(x, ...) IMPL_SEQFOR_INC6_(IMPL_SEQFOR_INC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_INC6_(...) IMPL_SEQFOR_INC6__(__VA_ARGS__)
+#define IMPL_SEQFOR_INC6__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_INC7)(__VA_ARGS__)
+#define IMPL_SEQFOR_LIT6(acc, x, ...) IMPL_SEQFOR_LIT_FIRST(__VA_OPT__(IMPL_SEQFOR_LIT7(x##acc, __VA_ARGS__),) x##acc)
+#define IMPL_SEQFOR_DEC6(x, ...) IMPL_SEQFOR_DEC6_(IMPL_SEQFOR_DEC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_DEC6_(...) IMPL_SEQFOR_DEC6__(__VA_ARGS__)
+#define IMPL_SEQFOR_DEC6__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_DEC7)(__VA_ARGS__)
+#define IMPL_SEQFOR_IS_ZERO6(x, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_IS_ZERO_, x)(IMPL_SEQFOR_IS_ZERO7)(__VA_ARGS__)
+#define IMPL_SEQFOR_INC7(x, ...) IMPL_SEQFOR_INC7_(IMPL_SEQFOR_INC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_INC7_(...) IMPL_SEQFOR_INC7__(__VA_ARGS__)
+#define IMPL_SEQFOR_INC7__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_INC8)(__VA_ARGS__)
+#define IMPL_SEQFOR_LIT7(acc, x, ...) IMPL_SEQFOR_LIT_FIRST(__VA_OPT__(IMPL_SEQFOR_LIT8(x##acc, __VA_ARGS__),) x##acc)
+#define IMPL_SEQFOR_DEC7(x, ...) IMPL_SEQFOR_DEC7_(IMPL_SEQFOR_DEC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_DEC7_(...) IMPL_SEQFOR_DEC7__(__VA_ARGS__)
+#define IMPL_SEQFOR_DEC7__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_DEC8)(__VA_ARGS__)
+#define IMPL_SEQFOR_IS_ZERO7(x, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_IS_ZERO_, x)(IMPL_SEQFOR_IS_ZERO8)(__VA_ARGS__)
+#define IMPL_SEQFOR_INC8(x, ...) IMPL_SEQFOR_INC8_(IMPL_SEQFOR_INC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_INC8_(...) IMPL_SEQFOR_INC8__(__VA_ARGS__)
+#define IMPL_SEQFOR_INC8__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_INC9)(__VA_ARGS__)
+#define IMPL_SEQFOR_LIT8(acc, x, ...) IMPL_SEQFOR_LIT_FIRST(__VA_OPT__(IMPL_SEQFOR_LIT9(x##acc, __VA_ARGS__),) x##acc)
+#define IMPL_SEQFOR_DEC8(x, ...) IMPL_SEQFOR_DEC8_(IMPL_SEQFOR_DEC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_DEC8_(...) IMPL_SEQFOR_DEC8__(__VA_ARGS__)
+#define IMPL_SEQFOR_DEC8__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_DEC9)(__VA_ARGS__)
+#define IMPL_SEQFOR_IS_ZERO8(x, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_IS_ZERO_, x)(IMPL_SEQFOR_IS_ZERO9)(__VA_ARGS__)
+
+// Generated boilerplate for `SF_FOR_EACH_ZIP`:
+#define IMPL_SEQFOR_ZIP_COL0(t, h, c, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ZIP_HAS_, IMPL_SEQFOR_NONEMPTY(c))(IMPL_SEQFOR_ZIP_COL0_)(t, h, IMPL_SEQFOR_ZIP_POP c, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL0_(...) IMPL_SEQFOR_ZIP_COL0__(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL0__(t, h, x, c, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP_NEXT_, __VA_OPT__(1))(IMPL_SEQFOR_ZIP_COL1)((IMPL_SEQFOR_ZIP_EXPAND t, c), (IMPL_SEQFOR_ZIP_EXPAND h, IMPL_SEQFOR_ZIP_EXPAND x) __VA_OPT__(,) __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL1(t, h, c, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ZIP_HAS_, IMPL_SEQFOR_NONEMPTY(c))(IMPL_SEQFOR_ZIP_COL1_)(t, h, IMPL_SEQFOR_ZIP_POP c, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL1_(...) IMPL_SEQFOR_ZIP_COL1__(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL1__(t, h, x, c, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP_NEXT_, __VA_OPT__(1))(IMPL_SEQFOR_ZIP_COL2)((IMPL_SEQFOR_ZIP_EXPAND t, c), (IMPL_SEQFOR_ZIP_EXPAND h, IMPL_SEQFOR_ZIP_EXPAND x) __VA_OPT__(,) __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL2(t, h, c, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ZIP_HAS_, IMPL_SEQFOR_NONEMPTY(c))(IMPL_SEQFOR_ZIP_COL2_)(t, h, IMPL_SEQFOR_ZIP_POP c, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL2_(...) IMPL_SEQFOR_ZIP_COL2__(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL2__(t, h, x, c, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP_NEXT_, __VA_OPT__(1))(IMPL_SEQFOR_ZIP_COL3)((IMPL_SEQFOR_ZIP_EXPAND t, c), (IMPL_SEQFOR_ZIP_EXPAND h, IMPL_SEQFOR_ZIP_EXPAND x) __VA_OPT__(,) __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL3(t, h, c, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ZIP_HAS_, IMPL_SEQFOR_NONEMPTY(c))(IMPL_SEQFOR_ZIP_COL3_)(t, h, IMPL_SEQFOR_ZIP_POP c, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL3_(...) IMPL_SEQFOR_ZIP_COL3__(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL3__(t, h, x, c, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP_NEXT_, __VA_OPT__(1))(IMPL_SEQFOR_ZIP_COL4)((IMPL_SEQFOR_ZIP_EXPAND t, c), (IMPL_SEQFOR_ZIP_EXPAND h, IMPL_SEQFOR_ZIP_EXPAND x) __VA_OPT__(,) __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL4(t, h, c, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ZIP_HAS_, IMPL_SEQFOR_NONEMPTY(c))(IMPL_SEQFOR_ZIP_COL4_)(t, h, IMPL_SEQFOR_ZIP_POP c, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL4_(...) IMPL_SEQFOR_ZIP_COL4__(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL4__(t, h, x, c, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP_NEXT_, __VA_OPT__(1))(IMPL_SEQFOR_ZIP_COL5)((IMPL_SEQFOR_ZIP_EXPAND t, c), (IMPL_SEQFOR_ZIP_EXPAND h, IMPL_SEQFOR_ZIP_EXPAND x) __VA_OPT__(,) __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL5(t, h, c, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ZIP_HAS_, IMPL_SEQFOR_NONEMPTY(c))(IMPL_SEQFOR_ZIP_COL5_)(t, h, IMPL_SEQFOR_ZIP_POP c, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL5_(...) IMPL_SEQFOR_ZIP_COL5__(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL5__(t, h, x, c, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP_NEXT_, __VA_OPT__(1))(IMPL_SEQFOR_ZIP_COL6)((IMPL_SEQFOR_ZIP_EXPAND t, c), (IMPL_SEQFOR_ZIP_EXPAND h, IMPL_SEQFOR_ZIP_EXPAND x) __VA_OPT__(,) __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL6(t, h, c, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ZIP_HAS_, IMPL_SEQFOR_NONEMPTY(c))(IMPL_SEQFOR_ZIP_COL6_)(t, h, IMPL_SEQFOR_ZIP_POP c, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL6_(...) IMPL_SEQFOR_ZIP_COL6__(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL6__(t, h, x, c, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP_NEXT_, __VA_OPT__(1))(IMPL_SEQFOR_ZIP_COL7)((IMPL_SEQFOR_ZIP_EXPAND t, c), (IMPL_SEQFOR_ZIP_EXPAND h, IMPL_SEQFOR_ZIP_EXPAND x) __VA_OPT__(,) __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL7(t, h, c, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ZIP_HAS_, IMPL_SEQFOR_NONEMPTY(c))(IMPL_SEQFOR_ZIP_COL7_)(t, h, IMPL_SEQFOR_ZIP_POP c, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL7_(...) IMPL_SEQFOR_ZIP_COL7__(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL7__(t, h, x, c, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP_NEXT_, __VA_OPT__(1))(IMPL_SEQFOR_ZIP_COL8)((IMPL_SEQFOR_ZIP_EXPAND t, c), (IMPL_SEQFOR_ZIP_EXPAND h, IMPL_SEQFOR_ZIP_EXPAND x) __VA_OPT__(,) __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL8(t, h, c, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ZIP_HAS_, IMPL_SEQFOR_NONEMPTY(c))(IMPL_SEQFOR_ZIP_COL8_)(t, h, IMPL_SEQFOR_ZIP_POP c, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL8_(...) IMPL_SEQFOR_ZIP_COL8__(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COL8__(t, h, x, c, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP_NEXT_, __VA_OPT__(1))(IMPL_SEQFOR_ZIP_COL9)((IMPL_SEQFOR_ZIP_EXPAND t, c), (IMPL_SEQFOR_ZIP_EXPAND h, IMPL_SEQFOR_ZIP_EXPAND x) __VA_OPT__(,) __VA_ARGS__)
 
-// Generated boilerplate for nested loops:
-// 0
-#define SF_FOR_EACH0(m, s, f, d, seq) IMPL_SEQFOR_FOR0(m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_ANNOTATE_SEQ_END(IMPL_SEQFOR_ANNOTATE_SEQ_A seq)) )
-#define IMPL_SEQFOR_FOR0(m, s, f, d, guide) IMPL_SEQFOR_IDENTITY0( IMPL_SEQFOR_FOR_GUIDE0_A IMPL_SEQFOR_LPAREN m, s, f, d, guide )
-#define IMPL_SEQFOR_IDENTITY0(...) __VA_ARGS__
-#define IMPL_SEQFOR_FOR_GUIDE0_A(m, s, f, d, e) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FOR_GUIDE0_A_, e)(m, s, f, d)
-#define IMPL_SEQFOR_FOR_GUIDE0_A_(m, s, f, d) IMPL_SEQFOR_FOR_GUIDE0_B(m, s, f, d,
-#define IMPL_SEQFOR_FOR_GUIDE0_A_0(m, s, f, d) f(1, d) IMPL_SEQFOR_NULL(
-#define IMPL_SEQFOR_FOR_GUIDE0_B(m, s, f, d, ...) m(1, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE0_B_0(m, s, f, s(1, d, __VA_ARGS__))
-#define IMPL_SEQFOR_FOR_GUIDE0_B_0(...) IMPL_SEQFOR_FOR_GUIDE0_B_1(__VA_ARGS__)
-#define IMPL_SEQFOR_FOR_GUIDE0_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE0_A(m, s, f, d,
-// 1
-#define SF_FOR_EACH1(m, s, f, d, seq) IMPL_SEQFOR_FOR1(m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_ANNOTATE_SEQ_END(IMPL_SEQFOR_ANNOTATE_SEQ_A seq)) )
-#define IMPL_SEQFOR_FOR1(m, s, f, d, guide) IMPL_SEQFOR_IDENTITY1( IMPL_SEQFOR_FOR_GUIDE1_A IMPL_SEQFOR_LPAREN m, s, f, d, guide )
-#define IMPL_SEQFOR_IDENTITY1(...) __VA_ARGS__
-#define IMPL_SEQFOR_FOR_GUIDE1_A(m, s, f, d, e) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FOR_GUIDE1_A_, e)(m, s, f, d)
-#define IMPL_SEQFOR_FOR_GUIDE1_A_(m, s, f, d) IMPL_SEQFOR_FOR_GUIDE1_B(m, s, f, d,
-#define IMPL_SEQFOR_FOR_GUIDE1_A_0(m, s, f, d) f(2, d) IMPL_SEQFOR_NULL(
-#define IMPL_SEQFOR_FOR_GUIDE1_B(m, s, f, d, ...) m(2, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE1_B_0(m, s, f, s(2, d, __VA_ARGS__))
-#define IMPL_SEQFOR_FOR_GUIDE1_B_0(...) IMPL_SEQFOR_FOR_GUIDE1_B_1(__VA_ARGS__)
-#define IMPL_SEQFOR_FOR_GUIDE1_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE1_A(m, s, f, d,
-// 2
-#define SF_FOR_EACH2(m, s, f, d, seq) IMPL_SEQFOR_FOR2(m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_ANNOTATE_SEQ_END(IMPL_SEQFOR_ANNOTATE_SEQ_A seq)) )
-#define IMPL_SEQFOR_FOR2(m, s, f, d, guide) IMPL_SEQFOR_IDENTITY2( IMPL_SEQFOR_FOR_GUIDE2_A IMPL_SEQFOR_LPAREN m, s, f, d, guide )
-#define IMPL_SEQFOR_IDENTITY2(...) __VA_ARGS__
-#define IMPL_SEQFOR_FOR_GUIDE2_A(m, s, f, d, e) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FOR_GUIDE2_A_, e)(m, s, f, d)
-#define IMPL_SEQFOR_FOR_GUIDE2_A_(m, s, f, d) IMPL_SEQFOR_FOR_GUIDE2_B(m, s, f, d,
-#define IMPL_SEQFOR_FOR_GUIDE2_A_0(m, s, f, d) f(3, d) IMPL_SEQFOR_NULL(
-#define IMPL_SEQFOR_FOR_GUIDE2_B(m, s, f, d, ...) m(3, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE2_B_0(m, s, f, s(3, d, __VA_ARGS__))
-#define IMPL_SEQFOR_FOR_GUIDE2_B_0(...) IMPL_SEQFOR_FOR_GUIDE2_B_1(__VA_ARGS__)
-#define IMPL_SEQFOR_FOR_GUIDE2_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE2_A(m, s, f, d,
-// 3
-#define SF_FOR_EACH3(m, s, f, d, seq) IMPL_SEQFOR_FOR3(m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_ANNOTATE_SEQ_END(IMPL_SEQFOR_ANNOTATE_SEQ_A seq)) )
-#define IMPL_SEQFOR_FOR3(m, s, f, d, guide) IMPL_SEQFOR_IDENTITY3( IMPL_SEQFOR_FOR_GUIDE3_A IMPL_SEQFOR_LPAREN m, s, f, d, guide )
-#define IMPL_SEQFOR_IDENTITY3(...) __VA_ARGS__
-#define IMPL_SEQFOR_FOR_GUIDE3_A(m, s, f, d, e) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FOR_GUIDE3_A_, e)(m, s, f, d)
-#define IMPL_SEQFOR_FOR_GUIDE3_A_(m, s, f, d) IMPL_SEQFOR_FOR_GUIDE3_B(m, s, f, d,
-#define IMPL_SEQFOR_FOR_GUIDE3_A_0(m, s, f, d) f(4, d) IMPL_SEQFOR_NULL(
-#define IMPL_SEQFOR_FOR_GUIDE3_B(m, s, f, d, ...) m(4, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE3_B_0(m, s, f, s(4, d, __VA_ARGS__))
-#define IMPL_SEQFOR_FOR_GUIDE3_B_0(...) IMPL_SEQFOR_FOR_GUIDE3_B_1(__VA_ARGS__)
-#define IMPL_SEQFOR_FOR_GUIDE3_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE3_A(m, s, f, d,
-// 4
-#define SF_FOR_EACH4(m, s, f, d, seq) IMPL_SEQFOR_FOR4(m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_ANNOTATE_SEQ_END(IMPL_SEQFOR_ANNOTATE_SEQ_A seq)) )
-#define IMPL_SEQFOR_FOR4(m, s, f, d, guide) IMPL_SEQFOR_IDENTITY4( IMPL_SEQFOR_FOR_GUIDE4_A IMPL_SEQFOR_LPAREN m, s, f, d, guide )
-#define IMPL_SEQFOR_IDENTITY4(...) __VA_ARGS__
-#define IMPL_SEQFOR_FOR_GUIDE4_A(m, s, f, d, e) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FOR_GUIDE4_A_, e)(m, s, f, d)
-#define IMPL_SEQFOR_FOR_GUIDE4_A_(m, s, f, d) IMPL_SEQFOR_FOR_GUIDE4_B(m, s, f, d,
-#define IMPL_SEQFOR_FOR_GUIDE4_A_0(m, s, f, d) f(5, d) IMPL_SEQFOR_NULL(
-#define IMPL_SEQFOR_FOR_GUIDE4_B(m, s, f, d, ...) m(5, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE4_B_0(m, s, f, s(5, d, __VA_ARGS__))
-#define IMPL_SEQFOR_FOR_GUIDE4_B_0(...) IMPL_SEQFOR_FOR_GUIDE4_B_1(__VA_ARGS__)
-#define IMPL_SEQFOR_FOR_GUIDE4_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE4_A(m, s, f, d,
-// 5
-#define SF_FOR_EACH5(m, s, f, d, seq) IMPL_SEQFOR_FOR5(m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_ANNOTATE_SEQ_END(IMPL_SEQFOR_ANNOTATE_SEQ_A seq)) )
-#define IMPL_SEQFOR_FOR5(m, s, f, d, guide) IMPL_SEQFOR_IDENTITY5( IMPL_SEQFOR_FOR_GUIDE5_A IMPL_SEQFOR_LPAREN m, s, f, d, guide )
-#define IMPL_SEQFOR_IDENTITY5(...) __VA_ARGS__
-#define IMPL_SEQFOR_FOR_GUIDE5_A(m, s, f, d, e) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FOR_GUIDE5_A_, e)(m, s, f, d)
-#define IMPL_SEQFOR_FOR_GUIDE5_A_(m, s, f, d) IMPL_SEQFOR_FOR_GUIDE5_B(m, s, f, d,
-#define IMPL_SEQFOR_FOR_GUIDE5_A_0(m, s, f, d) f(6, d) IMPL_SEQFOR_NULL(
-#define IMPL_SEQFOR_FOR_GUIDE5_B(m, s, f, d, ...) m(6, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE5_B_0(m, s, f, s(6, d, __VA_ARGS__))
-#define IMPL_SEQFOR_FOR_GUIDE5_B_0(...) IMPL_SEQFOR_FOR_GUIDE5_B_1(__VA_ARGS__)
-#define IMPL_SEQFOR_FOR_GUIDE5_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE5_A(m, s, f, d,
-// 6
-#define SF_FOR_EACH6(m, s, f, d, seq) IMPL_SEQFOR_FOR6(m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_ANNOTATE_SEQ_END(IMPL_SEQFOR_ANNOTATE_SEQ_A seq)) )
-#define IMPL_SEQFOR_FOR6(m, s, f, d, guide) IMPL_SEQFOR_IDENTITY6( IMPL_SEQFOR_FOR_GUIDE6_A IMPL_SEQFOR_LPAREN m, s, f, d, guide )
-#define IMPL_SEQFOR_IDENTITY6(...) __VA_ARGS__
-#define IMPL_SEQFOR_FOR_GUIDE6_A(m, s, f, d, e) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FOR_GUIDE6_A_, e)(m, s, f, d)
-#define IMPL_SEQFOR_FOR_GUIDE6_A_(m, s, f, d) IMPL_SEQFOR_FOR_GUIDE6_B(m, s, f, d,
-#define IMPL_SEQFOR_FOR_GUIDE6_A_0(m, s, f, d) f(7, d) IMPL_SEQFOR_NULL(
-#define IMPL_SEQFOR_FOR_GUIDE6_B(m, s, f, d, ...) m(7, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE6_B_0(m, s, f, s(7, d, __VA_ARGS__))
-#define IMPL_SEQFOR_FOR_GUIDE6_B_0(...) IMPL_SEQFOR_FOR_GUIDE6_B_1(__VA_ARGS__)
-#define IMPL_SEQFOR_FOR_GUIDE6_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE6_A(m, s, f, d,
-// 7
-#define SF_FOR_EACH7(m, s, f, d, seq) IMPL_SEQFOR_FOR7(m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_ANNOTATE_SEQ_END(IMPL_SEQFOR_ANNOTATE_SEQ_A seq)) )
-#define IMPL_SEQFOR_FOR7(m, s, f, d, guide) IMPL_SEQFOR_IDENTITY7( IMPL_SEQFOR_FOR_GUIDE7_A IMPL_SEQFOR_LPAREN m, s, f, d, guide )
-#define IMPL_SEQFOR_IDENTITY7(...) __VA_ARGS__
-#define IMPL_SEQFOR_FOR_GUIDE7_A(m, s, f, d, e) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FOR_GUIDE7_A_, e)(m, s, f, d)
-#define IMPL_SEQFOR_FOR_GUIDE7_A_(m, s, f, d) IMPL_SEQFOR_FOR_GUIDE7_B(m, s, f, d,
-#define IMPL_SEQFOR_FOR_GUIDE7_A_0(m, s, f, d) f(8, d) IMPL_SEQFOR_NULL(
-#define IMPL_SEQFOR_FOR_GUIDE7_B(m, s, f, d, ...) m(8, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE7_B_0(m, s, f, s(8, d, __VA_ARGS__))
-#define IMPL_SEQFOR_FOR_GUIDE7_B_0(...) IMPL_SEQFOR_FOR_GUIDE7_B_1(__VA_ARGS__)
-#define IMPL_SEQFOR_FOR_GUIDE7_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE7_A(m, s, f, d,
+// Generated boilerplate for `SF_FOR_EACH_ARGS`:
+#define IMPL_SEQFOR_ARGS_STEP0(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP1)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP1(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP2)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP2(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP3)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP3(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP4)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP4(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP5)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP5(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP6)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP6(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP7)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP7(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP8)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP8(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP9)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP9(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP10)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP10(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP11)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP11(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP12)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP12(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP13)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP13(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP14)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP14(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP15)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP15(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP16)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP16(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP17)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP17(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP18)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP18(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP19)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP19(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP20)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP20(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP21)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP21(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP22)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP22(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP23)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP23(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP24)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP24(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP25)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP25(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP26)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP26(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP27)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP27(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP28)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP28(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP29)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP29(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP30)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP30(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP31)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP31(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP32)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP32(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP33)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP33(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP34)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP34(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP35)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP35(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP36)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP36(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP37)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP37(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP38)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP38(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP39)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP39(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP40)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP40(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP41)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP41(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP42)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP42(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP43)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP43(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP44)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP44(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP45)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP45(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP46)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP46(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP47)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP47(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP48)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP48(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP49)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP49(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP50)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP50(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP51)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP51(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP52)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP52(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP53)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP53(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP54)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP54(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP55)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP55(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP56)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP56(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP57)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP57(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP58)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP58(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP59)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP59(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP60)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP60(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP61)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP61(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP62)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP62(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP63)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP63(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP64)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP64(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP65)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP65(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP66)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP66(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP67)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP67(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP68)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP68(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP69)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP69(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP70)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP70(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP71)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP71(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP72)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP72(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP73)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP73(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP74)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP74(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP75)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP75(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP76)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP76(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP77)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP77(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP78)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP78(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP79)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP79(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP80)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP80(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP81)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP81(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP82)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP82(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP83)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP83(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP84)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP84(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP85)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP85(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP86)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP86(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP87)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP87(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP88)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP88(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP89)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP89(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP90)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP90(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP91)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP91(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP92)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP92(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP93)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP93(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP94)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP94(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP95)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP95(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP96)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP96(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP97)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP97(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP98)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP98(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP99)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP99(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP100)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP100(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP101)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP101(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP102)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP102(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP103)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP103(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP104)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP104(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP105)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP105(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP106)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP106(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP107)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP107(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP108)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP108(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP109)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP109(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP110)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP110(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP111)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP111(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP112)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP112(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP113)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP113(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP114)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP114(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP115)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP115(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP116)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP116(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP117)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP117(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP118)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP118(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP119)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP119(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP120)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP120(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP121)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP121(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP122)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP122(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP123)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP123(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP124)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP124(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP125)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP125(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP126)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP126(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP127)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP127(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP128)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP128(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP129)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP129(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP130)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP130(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP131)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP131(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP132)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP132(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP133)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP133(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP134)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP134(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP135)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP135(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP136)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP136(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP137)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP137(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP138)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP138(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP139)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP139(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP140)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP140(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP141)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP141(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP142)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP142(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP143)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP143(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP144)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP144(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP145)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP145(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP146)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP146(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP147)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP147(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP148)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP148(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP149)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP149(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP150)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP150(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP151)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP151(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP152)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP152(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP153)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP153(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP154)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP154(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP155)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP155(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP156)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP156(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP157)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP157(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP158)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP158(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP159)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP159(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP160)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP160(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP161)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP161(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP162)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP162(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP163)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP163(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP164)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP164(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP165)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP165(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP166)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP166(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP167)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP167(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP168)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP168(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP169)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP169(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP170)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP170(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP171)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP171(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP172)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP172(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP173)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP173(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP174)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP174(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP175)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP175(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP176)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP176(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP177)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP177(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP178)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP178(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP179)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP179(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP180)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP180(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP181)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP181(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP182)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP182(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP183)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP183(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP184)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP184(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP185)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP185(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP186)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP186(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP187)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP187(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP188)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP188(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP189)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP189(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP190)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP190(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP191)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP191(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP192)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP192(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP193)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP193(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP194)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP194(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP195)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP195(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP196)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP196(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP197)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP197(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP198)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP198(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP199)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP199(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP200)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP200(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP201)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP201(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP202)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP202(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP203)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP203(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP204)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP204(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP205)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP205(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP206)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP206(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP207)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP207(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP208)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP208(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP209)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP209(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP210)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP210(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP211)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP211(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP212)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP212(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP213)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP213(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP214)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP214(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP215)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP215(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP216)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP216(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP217)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP217(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP218)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP218(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP219)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP219(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP220)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP220(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP221)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP221(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP222)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP222(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP223)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP223(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP224)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP224(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP225)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP225(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP226)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP226(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP227)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP227(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP228)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP228(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP229)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP229(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP230)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP230(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP231)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP231(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP232)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP232(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP233)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP233(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP234)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP234(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP235)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP235(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP236)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP236(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP237)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP237(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP238)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP238(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP239)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP239(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP240)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP240(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP241)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP241(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP242)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP242(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP243)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP243(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP244)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP244(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP245)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP245(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP246)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP246(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP247)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP247(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP248)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP248(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP249)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP249(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP250)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP250(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP251)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP251(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP252)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP252(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP253)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP253(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP254)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_STEP254(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEP255)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
 
 #endif
@@ -0,0 +1,113 @@
+// Nesting level 0 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH0(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH0, 1) IMPL_SEQFOR_IDENTITY0( IMPL_SEQFOR_FOR_GUIDE0_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE0(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE0, 1) IMPL_SEQFOR_IDENTITY0( IMPL_SEQFOR_SIMPLE0_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST0(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST0, 1) IMPL_SEQFOR_IDENTITY0( IMPL_SEQFOR_FAST0_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL0(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL0, 1) IMPL_SEQFOR_IDENTITY0( IMPL_SEQFOR_UNTIL0_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP0(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP0, 1) IMPL_SEQFOR_IDENTITY0( IMPL_SEQFOR_ZIP0_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS0(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS0, 1) IMPL_SEQFOR_IDENTITY0( IMPL_SEQFOR_FOR_GUIDE0_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP0(m, seq) IMPL_SEQFOR_IDENTITY0( IMPL_SEQFOR_MAP0_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER0(p, seq) IMPL_SEQFOR_IDENTITY0( IMPL_SEQFOR_FILTER0_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G0(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G0, 1) IMPL_SEQFOR_FOR_GUIDE0_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G0(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G0, 1) IMPL_SEQFOR_SIMPLE0_A(m, g) )
+#define SF_FOR_EACH_FAST_G0(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G0, 1) IMPL_SEQFOR_FAST0_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G0(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G0, 1) IMPL_SEQFOR_UNTIL0_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G0(m, g) IMPL_SEQFOR_MAP_G0_A(m, g) )
+#define SF_SEQ_FILTER_G0(p, g) IMPL_SEQFOR_FILTER_G0_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY0(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE0_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE0_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE0_A_ IMPL_SEQFOR_FOR_GUIDE0_B
+#define IMPL_SEQFOR_FOR_GUIDE0_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE0_END
+#define IMPL_SEQFOR_FOR_GUIDE0_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE0_END
+#define IMPL_SEQFOR_FOR_GUIDE0_END(m, s, f, d, ...) f(1, d)
+#define IMPL_SEQFOR_FOR_GUIDE0_B(m, s, f, d, ...) m(1, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE0_B_0(m, s, f, s(1, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE0_B_0(...) IMPL_SEQFOR_FOR_GUIDE0_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE0_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE0_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST0_A(m, s, f, d, e) IMPL_SEQFOR_FAST0_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST0_A_ IMPL_SEQFOR_FAST0_B
+#define IMPL_SEQFOR_FAST0_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE0_END
+#define IMPL_SEQFOR_FAST0_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE0_END
+#define IMPL_SEQFOR_FAST0_B(m, s, f, d, ...) m(1, d, __VA_ARGS__) IMPL_SEQFOR_FAST0_A(m, s, f, s(1, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL0_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL0_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL0_A_ IMPL_SEQFOR_UNTIL0_B
+#define IMPL_SEQFOR_UNTIL0_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE0_END
+#define IMPL_SEQFOR_UNTIL0_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE0_END
+#define IMPL_SEQFOR_UNTIL0_B(m, s, f, d, ...) m(1, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL0_B_0(m, s, f, s(1, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL0_B_0(...) IMPL_SEQFOR_UNTIL0_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL0_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL0_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL0_B_1_0 IMPL_SEQFOR_UNTIL0_A
+#define IMPL_SEQFOR_UNTIL0_B_1_1 IMPL_SEQFOR_UNTIL0_STOP
+#define IMPL_SEQFOR_UNTIL0_STOP(m, s, f, d, e) f(1, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP0_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP0_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP0_A_ IMPL_SEQFOR_ZIP0_B
+#define IMPL_SEQFOR_ZIP0_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE0_END
+#define IMPL_SEQFOR_ZIP0_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE0_END
+#define IMPL_SEQFOR_ZIP0_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP0_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP0_B_0(...) IMPL_SEQFOR_ZIP0_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP0_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP0_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP0_B_1_0 IMPL_SEQFOR_ZIP0_C
+#define IMPL_SEQFOR_ZIP0_B_1_1(m, s, f, d, ...) f(1, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP0_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP0_C(m, s, f, d, r, ...) m(1, d, __VA_ARGS__) IMPL_SEQFOR_ZIP0_A(m, s, f, s(1, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE0_A(m, e) IMPL_SEQFOR_SIMPLE0_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE0_A_ IMPL_SEQFOR_SIMPLE0_B
+#define IMPL_SEQFOR_SIMPLE0_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE0_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE0_B(m, ...) m(1, __VA_ARGS__) IMPL_SEQFOR_SIMPLE0_A(m,
+#define IMPL_SEQFOR_MAP0_A(m, e) IMPL_SEQFOR_MAP0_A_##e(m,
+#define IMPL_SEQFOR_MAP0_A_ IMPL_SEQFOR_MAP0_B
+#define IMPL_SEQFOR_MAP0_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP0_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP0_B(m, ...) (m(1, __VA_ARGS__)) IMPL_SEQFOR_MAP0_A(m,
+#define IMPL_SEQFOR_FILTER0_A(p, e) IMPL_SEQFOR_FILTER0_A_##e(p,
+#define IMPL_SEQFOR_FILTER0_A_ IMPL_SEQFOR_FILTER0_B
+#define IMPL_SEQFOR_FILTER0_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER0_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER0_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(1, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER0_A(p,
+#define IMPL_SEQFOR_MAP_G0_A(m, e) IMPL_SEQFOR_MAP_G0_A_##e(m,
+#define IMPL_SEQFOR_MAP_G0_A_ IMPL_SEQFOR_MAP_G0_B
+#define IMPL_SEQFOR_MAP_G0_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G0_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G0_B(m, ...) )m(1, __VA_ARGS__)) IMPL_SEQFOR_MAP_G0_A(m,
+#define IMPL_SEQFOR_FILTER_G0_A(p, e) IMPL_SEQFOR_FILTER_G0_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G0_A_ IMPL_SEQFOR_FILTER_G0_B
+#define IMPL_SEQFOR_FILTER_G0_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G0_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G0_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(1, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G0_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL0(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE0_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP0(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL0(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE0_A_
+#undef IMPL_SEQFOR_FOR_GUIDE0_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE0_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST0_A_
+#undef IMPL_SEQFOR_FAST0_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST0_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL0_A_
+#undef IMPL_SEQFOR_UNTIL0_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL0_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL0_B_1_1
+#undef IMPL_SEQFOR_ZIP0_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP0_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP0_B_1_0
+#undef IMPL_SEQFOR_ZIP0_B_1_1
+#undef IMPL_SEQFOR_SIMPLE0_A_
+#undef IMPL_SEQFOR_SIMPLE0_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE0_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE0_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE0_B
+#define IMPL_SEQFOR_FOR_GUIDE0_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL0
+#define IMPL_SEQFOR_FOR_GUIDE0_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL0
+#define IMPL_SEQFOR_FAST0_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST0_B
+#define IMPL_SEQFOR_FAST0_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL0
+#define IMPL_SEQFOR_FAST0_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL0
+#define IMPL_SEQFOR_UNTIL0_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL0_B
+#define IMPL_SEQFOR_UNTIL0_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL0
+#define IMPL_SEQFOR_UNTIL0_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL0
+#define IMPL_SEQFOR_UNTIL0_B_1_1 IMPL_SEQFOR_TRACE_STOP0
+#define IMPL_SEQFOR_ZIP0_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL0
+#define IMPL_SEQFOR_ZIP0_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL0
+#define IMPL_SEQFOR_ZIP0_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP0_C
+#define IMPL_SEQFOR_ZIP0_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL0(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE0_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE0_B
+#define IMPL_SEQFOR_SIMPLE0_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE0_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 1 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH1(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH1, 2) IMPL_SEQFOR_IDENTITY1( IMPL_SEQFOR_FOR_GUIDE1_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE1(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE1, 2) IMPL_SEQFOR_IDENTITY1( IMPL_SEQFOR_SIMPLE1_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST1(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST1, 2) IMPL_SEQFOR_IDENTITY1( IMPL_SEQFOR_FAST1_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL1(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL1, 2) IMPL_SEQFOR_IDENTITY1( IMPL_SEQFOR_UNTIL1_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP1(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP1, 2) IMPL_SEQFOR_IDENTITY1( IMPL_SEQFOR_ZIP1_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS1, 2) IMPL_SEQFOR_IDENTITY1( IMPL_SEQFOR_FOR_GUIDE1_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP1(m, seq) IMPL_SEQFOR_IDENTITY1( IMPL_SEQFOR_MAP1_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER1(p, seq) IMPL_SEQFOR_IDENTITY1( IMPL_SEQFOR_FILTER1_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G1(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G1, 2) IMPL_SEQFOR_FOR_GUIDE1_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G1(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G1, 2) IMPL_SEQFOR_SIMPLE1_A(m, g) )
+#define SF_FOR_EACH_FAST_G1(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G1, 2) IMPL_SEQFOR_FAST1_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G1(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G1, 2) IMPL_SEQFOR_UNTIL1_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G1(m, g) IMPL_SEQFOR_MAP_G1_A(m, g) )
+#define SF_SEQ_FILTER_G1(p, g) IMPL_SEQFOR_FILTER_G1_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY1(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE1_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE1_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE1_A_ IMPL_SEQFOR_FOR_GUIDE1_B
+#define IMPL_SEQFOR_FOR_GUIDE1_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE1_END
+#define IMPL_SEQFOR_FOR_GUIDE1_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE1_END
+#define IMPL_SEQFOR_FOR_GUIDE1_END(m, s, f, d, ...) f(2, d)
+#define IMPL_SEQFOR_FOR_GUIDE1_B(m, s, f, d, ...) m(2, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE1_B_0(m, s, f, s(2, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE1_B_0(...) IMPL_SEQFOR_FOR_GUIDE1_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE1_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE1_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST1_A(m, s, f, d, e) IMPL_SEQFOR_FAST1_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST1_A_ IMPL_SEQFOR_FAST1_B
+#define IMPL_SEQFOR_FAST1_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE1_END
+#define IMPL_SEQFOR_FAST1_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE1_END
+#define IMPL_SEQFOR_FAST1_B(m, s, f, d, ...) m(2, d, __VA_ARGS__) IMPL_SEQFOR_FAST1_A(m, s, f, s(2, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL1_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL1_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL1_A_ IMPL_SEQFOR_UNTIL1_B
+#define IMPL_SEQFOR_UNTIL1_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE1_END
+#define IMPL_SEQFOR_UNTIL1_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE1_END
+#define IMPL_SEQFOR_UNTIL1_B(m, s, f, d, ...) m(2, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL1_B_0(m, s, f, s(2, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL1_B_0(...) IMPL_SEQFOR_UNTIL1_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL1_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL1_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL1_B_1_0 IMPL_SEQFOR_UNTIL1_A
+#define IMPL_SEQFOR_UNTIL1_B_1_1 IMPL_SEQFOR_UNTIL1_STOP
+#define IMPL_SEQFOR_UNTIL1_STOP(m, s, f, d, e) f(2, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP1_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP1_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP1_A_ IMPL_SEQFOR_ZIP1_B
+#define IMPL_SEQFOR_ZIP1_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE1_END
+#define IMPL_SEQFOR_ZIP1_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE1_END
+#define IMPL_SEQFOR_ZIP1_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP1_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP1_B_0(...) IMPL_SEQFOR_ZIP1_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP1_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP1_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP1_B_1_0 IMPL_SEQFOR_ZIP1_C
+#define IMPL_SEQFOR_ZIP1_B_1_1(m, s, f, d, ...) f(2, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP1_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP1_C(m, s, f, d, r, ...) m(2, d, __VA_ARGS__) IMPL_SEQFOR_ZIP1_A(m, s, f, s(2, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE1_A(m, e) IMPL_SEQFOR_SIMPLE1_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE1_A_ IMPL_SEQFOR_SIMPLE1_B
+#define IMPL_SEQFOR_SIMPLE1_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE1_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE1_B(m, ...) m(2, __VA_ARGS__) IMPL_SEQFOR_SIMPLE1_A(m,
+#define IMPL_SEQFOR_MAP1_A(m, e) IMPL_SEQFOR_MAP1_A_##e(m,
+#define IMPL_SEQFOR_MAP1_A_ IMPL_SEQFOR_MAP1_B
+#define IMPL_SEQFOR_MAP1_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP1_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP1_B(m, ...) (m(2, __VA_ARGS__)) IMPL_SEQFOR_MAP1_A(m,
+#define IMPL_SEQFOR_FILTER1_A(p, e) IMPL_SEQFOR_FILTER1_A_##e(p,
+#define IMPL_SEQFOR_FILTER1_A_ IMPL_SEQFOR_FILTER1_B
+#define IMPL_SEQFOR_FILTER1_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER1_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER1_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(2, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER1_A(p,
+#define IMPL_SEQFOR_MAP_G1_A(m, e) IMPL_SEQFOR_MAP_G1_A_##e(m,
+#define IMPL_SEQFOR_MAP_G1_A_ IMPL_SEQFOR_MAP_G1_B
+#define IMPL_SEQFOR_MAP_G1_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G1_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G1_B(m, ...) )m(2, __VA_ARGS__)) IMPL_SEQFOR_MAP_G1_A(m,
+#define IMPL_SEQFOR_FILTER_G1_A(p, e) IMPL_SEQFOR_FILTER_G1_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G1_A_ IMPL_SEQFOR_FILTER_G1_B
+#define IMPL_SEQFOR_FILTER_G1_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G1_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G1_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(2, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G1_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL1(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE1_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP1(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL1(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE1_A_
+#undef IMPL_SEQFOR_FOR_GUIDE1_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE1_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST1_A_
+#undef IMPL_SEQFOR_FAST1_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST1_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL1_A_
+#undef IMPL_SEQFOR_UNTIL1_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL1_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL1_B_1_1
+#undef IMPL_SEQFOR_ZIP1_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP1_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP1_B_1_0
+#undef IMPL_SEQFOR_ZIP1_B_1_1
+#undef IMPL_SEQFOR_SIMPLE1_A_
+#undef IMPL_SEQFOR_SIMPLE1_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE1_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE1_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE1_B
+#define IMPL_SEQFOR_FOR_GUIDE1_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL1
+#define IMPL_SEQFOR_FOR_GUIDE1_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL1
+#define IMPL_SEQFOR_FAST1_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST1_B
+#define IMPL_SEQFOR_FAST1_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL1
+#define IMPL_SEQFOR_FAST1_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL1
+#define IMPL_SEQFOR_UNTIL1_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL1_B
+#define IMPL_SEQFOR_UNTIL1_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL1
+#define IMPL_SEQFOR_UNTIL1_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL1
+#define IMPL_SEQFOR_UNTIL1_B_1_1 IMPL_SEQFOR_TRACE_STOP1
+#define IMPL_SEQFOR_ZIP1_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL1
+#define IMPL_SEQFOR_ZIP1_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL1
+#define IMPL_SEQFOR_ZIP1_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP1_C
+#define IMPL_SEQFOR_ZIP1_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL1(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE1_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE1_B
+#define IMPL_SEQFOR_SIMPLE1_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE1_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 10 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH10(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH10, 11) IMPL_SEQFOR_IDENTITY10( IMPL_SEQFOR_FOR_GUIDE10_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE10(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE10, 11) IMPL_SEQFOR_IDENTITY10( IMPL_SEQFOR_SIMPLE10_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST10(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST10, 11) IMPL_SEQFOR_IDENTITY10( IMPL_SEQFOR_FAST10_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL10(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL10, 11) IMPL_SEQFOR_IDENTITY10( IMPL_SEQFOR_UNTIL10_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP10(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP10, 11) IMPL_SEQFOR_IDENTITY10( IMPL_SEQFOR_ZIP10_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS10(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS10, 11) IMPL_SEQFOR_IDENTITY10( IMPL_SEQFOR_FOR_GUIDE10_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP10(m, seq) IMPL_SEQFOR_IDENTITY10( IMPL_SEQFOR_MAP10_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER10(p, seq) IMPL_SEQFOR_IDENTITY10( IMPL_SEQFOR_FILTER10_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G10(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G10, 11) IMPL_SEQFOR_FOR_GUIDE10_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G10(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G10, 11) IMPL_SEQFOR_SIMPLE10_A(m, g) )
+#define SF_FOR_EACH_FAST_G10(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G10, 11) IMPL_SEQFOR_FAST10_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G10(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G10, 11) IMPL_SEQFOR_UNTIL10_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G10(m, g) IMPL_SEQFOR_MAP_G10_A(m, g) )
+#define SF_SEQ_FILTER_G10(p, g) IMPL_SEQFOR_FILTER_G10_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY10(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE10_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE10_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE10_A_ IMPL_SEQFOR_FOR_GUIDE10_B
+#define IMPL_SEQFOR_FOR_GUIDE10_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE10_END
+#define IMPL_SEQFOR_FOR_GUIDE10_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE10_END
+#define IMPL_SEQFOR_FOR_GUIDE10_END(m, s, f, d, ...) f(11, d)
+#define IMPL_SEQFOR_FOR_GUIDE10_B(m, s, f, d, ...) m(11, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE10_B_0(m, s, f, s(11, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE10_B_0(...) IMPL_SEQFOR_FOR_GUIDE10_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE10_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE10_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST10_A(m, s, f, d, e) IMPL_SEQFOR_FAST10_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST10_A_ IMPL_SEQFOR_FAST10_B
+#define IMPL_SEQFOR_FAST10_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE10_END
+#define IMPL_SEQFOR_FAST10_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE10_END
+#define IMPL_SEQFOR_FAST10_B(m, s, f, d, ...) m(11, d, __VA_ARGS__) IMPL_SEQFOR_FAST10_A(m, s, f, s(11, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL10_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL10_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL10_A_ IMPL_SEQFOR_UNTIL10_B
+#define IMPL_SEQFOR_UNTIL10_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE10_END
+#define IMPL_SEQFOR_UNTIL10_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE10_END
+#define IMPL_SEQFOR_UNTIL10_B(m, s, f, d, ...) m(11, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL10_B_0(m, s, f, s(11, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL10_B_0(...) IMPL_SEQFOR_UNTIL10_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL10_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL10_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL10_B_1_0 IMPL_SEQFOR_UNTIL10_A
+#define IMPL_SEQFOR_UNTIL10_B_1_1 IMPL_SEQFOR_UNTIL10_STOP
+#define IMPL_SEQFOR_UNTIL10_STOP(m, s, f, d, e) f(11, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP10_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP10_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP10_A_ IMPL_SEQFOR_ZIP10_B
+#define IMPL_SEQFOR_ZIP10_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE10_END
+#define IMPL_SEQFOR_ZIP10_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE10_END
+#define IMPL_SEQFOR_ZIP10_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP10_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP10_B_0(...) IMPL_SEQFOR_ZIP10_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP10_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP10_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP10_B_1_0 IMPL_SEQFOR_ZIP10_C
+#define IMPL_SEQFOR_ZIP10_B_1_1(m, s, f, d, ...) f(11, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP10_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP10_C(m, s, f, d, r, ...) m(11, d, __VA_ARGS__) IMPL_SEQFOR_ZIP10_A(m, s, f, s(11, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE10_A(m, e) IMPL_SEQFOR_SIMPLE10_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE10_A_ IMPL_SEQFOR_SIMPLE10_B
+#define IMPL_SEQFOR_SIMPLE10_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE10_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE10_B(m, ...) m(11, __VA_ARGS__) IMPL_SEQFOR_SIMPLE10_A(m,
+#define IMPL_SEQFOR_MAP10_A(m, e) IMPL_SEQFOR_MAP10_A_##e(m,
+#define IMPL_SEQFOR_MAP10_A_ IMPL_SEQFOR_MAP10_B
+#define IMPL_SEQFOR_MAP10_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP10_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP10_B(m, ...) (m(11, __VA_ARGS__)) IMPL_SEQFOR_MAP10_A(m,
+#define IMPL_SEQFOR_FILTER10_A(p, e) IMPL_SEQFOR_FILTER10_A_##e(p,
+#define IMPL_SEQFOR_FILTER10_A_ IMPL_SEQFOR_FILTER10_B
+#define IMPL_SEQFOR_FILTER10_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER10_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER10_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(11, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER10_A(p,
+#define IMPL_SEQFOR_MAP_G10_A(m, e) IMPL_SEQFOR_MAP_G10_A_##e(m,
+#define IMPL_SEQFOR_MAP_G10_A_ IMPL_SEQFOR_MAP_G10_B
+#define IMPL_SEQFOR_MAP_G10_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G10_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G10_B(m, ...) )m(11, __VA_ARGS__)) IMPL_SEQFOR_MAP_G10_A(m,
+#define IMPL_SEQFOR_FILTER_G10_A(p, e) IMPL_SEQFOR_FILTER_G10_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G10_A_ IMPL_SEQFOR_FILTER_G10_B
+#define IMPL_SEQFOR_FILTER_G10_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G10_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G10_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(11, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G10_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL10(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE10_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP10(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL10(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE10_A_
+#undef IMPL_SEQFOR_FOR_GUIDE10_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE10_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST10_A_
+#undef IMPL_SEQFOR_FAST10_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST10_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL10_A_
+#undef IMPL_SEQFOR_UNTIL10_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL10_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL10_B_1_1
+#undef IMPL_SEQFOR_ZIP10_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP10_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP10_B_1_0
+#undef IMPL_SEQFOR_ZIP10_B_1_1
+#undef IMPL_SEQFOR_SIMPLE10_A_
+#undef IMPL_SEQFOR_SIMPLE10_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE10_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE10_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE10_B
+#define IMPL_SEQFOR_FOR_GUIDE10_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL10
+#define IMPL_SEQFOR_FOR_GUIDE10_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL10
+#define IMPL_SEQFOR_FAST10_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST10_B
+#define IMPL_SEQFOR_FAST10_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL10
+#define IMPL_SEQFOR_FAST10_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL10
+#define IMPL_SEQFOR_UNTIL10_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL10_B
+#define IMPL_SEQFOR_UNTIL10_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL10
+#define IMPL_SEQFOR_UNTIL10_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL10
+#define IMPL_SEQFOR_UNTIL10_B_1_1 IMPL_SEQFOR_TRACE_STOP10
+#define IMPL_SEQFOR_ZIP10_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL10
+#define IMPL_SEQFOR_ZIP10_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL10
+#define IMPL_SEQFOR_ZIP10_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP10_C
+#define IMPL_SEQFOR_ZIP10_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL10(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE10_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE10_B
+#define IMPL_SEQFOR_SIMPLE10_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE10_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 11 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH11(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH11, 12) IMPL_SEQFOR_IDENTITY11( IMPL_SEQFOR_FOR_GUIDE11_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE11(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE11, 12) IMPL_SEQFOR_IDENTITY11( IMPL_SEQFOR_SIMPLE11_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST11(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST11, 12) IMPL_SEQFOR_IDENTITY11( IMPL_SEQFOR_FAST11_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL11(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL11, 12) IMPL_SEQFOR_IDENTITY11( IMPL_SEQFOR_UNTIL11_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP11(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP11, 12) IMPL_SEQFOR_IDENTITY11( IMPL_SEQFOR_ZIP11_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS11(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS11, 12) IMPL_SEQFOR_IDENTITY11( IMPL_SEQFOR_FOR_GUIDE11_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP11(m, seq) IMPL_SEQFOR_IDENTITY11( IMPL_SEQFOR_MAP11_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER11(p, seq) IMPL_SEQFOR_IDENTITY11( IMPL_SEQFOR_FILTER11_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G11(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G11, 12) IMPL_SEQFOR_FOR_GUIDE11_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G11(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G11, 12) IMPL_SEQFOR_SIMPLE11_A(m, g) )
+#define SF_FOR_EACH_FAST_G11(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G11, 12) IMPL_SEQFOR_FAST11_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G11(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G11, 12) IMPL_SEQFOR_UNTIL11_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G11(m, g) IMPL_SEQFOR_MAP_G11_A(m, g) )
+#define SF_SEQ_FILTER_G11(p, g) IMPL_SEQFOR_FILTER_G11_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY11(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE11_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE11_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE11_A_ IMPL_SEQFOR_FOR_GUIDE11_B
+#define IMPL_SEQFOR_FOR_GUIDE11_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE11_END
+#define IMPL_SEQFOR_FOR_GUIDE11_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE11_END
+#define IMPL_SEQFOR_FOR_GUIDE11_END(m, s, f, d, ...) f(12, d)
+#define IMPL_SEQFOR_FOR_GUIDE11_B(m, s, f, d, ...) m(12, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE11_B_0(m, s, f, s(12, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE11_B_0(...) IMPL_SEQFOR_FOR_GUIDE11_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE11_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE11_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST11_A(m, s, f, d, e) IMPL_SEQFOR_FAST11_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST11_A_ IMPL_SEQFOR_FAST11_B
+#define IMPL_SEQFOR_FAST11_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE11_END
+#define IMPL_SEQFOR_FAST11_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE11_END
+#define IMPL_SEQFOR_FAST11_B(m, s, f, d, ...) m(12, d, __VA_ARGS__) IMPL_SEQFOR_FAST11_A(m, s, f, s(12, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL11_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL11_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL11_A_ IMPL_SEQFOR_UNTIL11_B
+#define IMPL_SEQFOR_UNTIL11_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE11_END
+#define IMPL_SEQFOR_UNTIL11_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE11_END
+#define IMPL_SEQFOR_UNTIL11_B(m, s, f, d, ...) m(12, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL11_B_0(m, s, f, s(12, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL11_B_0(...) IMPL_SEQFOR_UNTIL11_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL11_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL11_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL11_B_1_0 IMPL_SEQFOR_UNTIL11_A
+#define IMPL_SEQFOR_UNTIL11_B_1_1 IMPL_SEQFOR_UNTIL11_STOP
+#define IMPL_SEQFOR_UNTIL11_STOP(m, s, f, d, e) f(12, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP11_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP11_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP11_A_ IMPL_SEQFOR_ZIP11_B
+#define IMPL_SEQFOR_ZIP11_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE11_END
+#define IMPL_SEQFOR_ZIP11_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE11_END
+#define IMPL_SEQFOR_ZIP11_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP11_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP11_B_0(...) IMPL_SEQFOR_ZIP11_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP11_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP11_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP11_B_1_0 IMPL_SEQFOR_ZIP11_C
+#define IMPL_SEQFOR_ZIP11_B_1_1(m, s, f, d, ...) f(12, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP11_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP11_C(m, s, f, d, r, ...) m(12, d, __VA_ARGS__) IMPL_SEQFOR_ZIP11_A(m, s, f, s(12, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE11_A(m, e) IMPL_SEQFOR_SIMPLE11_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE11_A_ IMPL_SEQFOR_SIMPLE11_B
+#define IMPL_SEQFOR_SIMPLE11_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE11_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE11_B(m, ...) m(12, __VA_ARGS__) IMPL_SEQFOR_SIMPLE11_A(m,
+#define IMPL_SEQFOR_MAP11_A(m, e) IMPL_SEQFOR_MAP11_A_##e(m,
+#define IMPL_SEQFOR_MAP11_A_ IMPL_SEQFOR_MAP11_B
+#define IMPL_SEQFOR_MAP11_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP11_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP11_B(m, ...) (m(12, __VA_ARGS__)) IMPL_SEQFOR_MAP11_A(m,
+#define IMPL_SEQFOR_FILTER11_A(p, e) IMPL_SEQFOR_FILTER11_A_##e(p,
+#define IMPL_SEQFOR_FILTER11_A_ IMPL_SEQFOR_FILTER11_B
+#define IMPL_SEQFOR_FILTER11_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER11_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER11_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(12, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER11_A(p,
+#define IMPL_SEQFOR_MAP_G11_A(m, e) IMPL_SEQFOR_MAP_G11_A_##e(m,
+#define IMPL_SEQFOR_MAP_G11_A_ IMPL_SEQFOR_MAP_G11_B
+#define IMPL_SEQFOR_MAP_G11_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G11_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G11_B(m, ...) )m(12, __VA_ARGS__)) IMPL_SEQFOR_MAP_G11_A(m,
+#define IMPL_SEQFOR_FILTER_G11_A(p, e) IMPL_SEQFOR_FILTER_G11_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G11_A_ IMPL_SEQFOR_FILTER_G11_B
+#define IMPL_SEQFOR_FILTER_G11_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G11_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G11_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(12, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G11_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL11(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE11_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP11(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL11(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE11_A_
+#undef IMPL_SEQFOR_FOR_GUIDE11_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE11_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST11_A_
+#undef IMPL_SEQFOR_FAST11_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST11_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL11_A_
+#undef IMPL_SEQFOR_UNTIL11_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL11_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL11_B_1_1
+#undef IMPL_SEQFOR_ZIP11_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP11_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP11_B_1_0
+#undef IMPL_SEQFOR_ZIP11_B_1_1
+#undef IMPL_SEQFOR_SIMPLE11_A_
+#undef IMPL_SEQFOR_SIMPLE11_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE11_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE11_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE11_B
+#define IMPL_SEQFOR_FOR_GUIDE11_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL11
+#define IMPL_SEQFOR_FOR_GUIDE11_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL11
+#define IMPL_SEQFOR_FAST11_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST11_B
+#define IMPL_SEQFOR_FAST11_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL11
+#define IMPL_SEQFOR_FAST11_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL11
+#define IMPL_SEQFOR_UNTIL11_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL11_B
+#define IMPL_SEQFOR_UNTIL11_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL11
+#define IMPL_SEQFOR_UNTIL11_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL11
+#define IMPL_SEQFOR_UNTIL11_B_1_1 IMPL_SEQFOR_TRACE_STOP11
+#define IMPL_SEQFOR_ZIP11_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL11
+#define IMPL_SEQFOR_ZIP11_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL11
+#define IMPL_SEQFOR_ZIP11_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP11_C
+#define IMPL_SEQFOR_ZIP11_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL11(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE11_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE11_B
+#define IMPL_SEQFOR_SIMPLE11_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE11_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
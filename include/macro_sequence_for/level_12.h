@@ -0,0 +1,113 @@
+// Nesting level 12 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH12(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH12, 13) IMPL_SEQFOR_IDENTITY12( IMPL_SEQFOR_FOR_GUIDE12_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE12(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE12, 13) IMPL_SEQFOR_IDENTITY12( IMPL_SEQFOR_SIMPLE12_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST12(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST12, 13) IMPL_SEQFOR_IDENTITY12( IMPL_SEQFOR_FAST12_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL12(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL12, 13) IMPL_SEQFOR_IDENTITY12( IMPL_SEQFOR_UNTIL12_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP12(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP12, 13) IMPL_SEQFOR_IDENTITY12( IMPL_SEQFOR_ZIP12_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS12(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS12, 13) IMPL_SEQFOR_IDENTITY12( IMPL_SEQFOR_FOR_GUIDE12_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP12(m, seq) IMPL_SEQFOR_IDENTITY12( IMPL_SEQFOR_MAP12_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER12(p, seq) IMPL_SEQFOR_IDENTITY12( IMPL_SEQFOR_FILTER12_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G12(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G12, 13) IMPL_SEQFOR_FOR_GUIDE12_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G12(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G12, 13) IMPL_SEQFOR_SIMPLE12_A(m, g) )
+#define SF_FOR_EACH_FAST_G12(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G12, 13) IMPL_SEQFOR_FAST12_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G12(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G12, 13) IMPL_SEQFOR_UNTIL12_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G12(m, g) IMPL_SEQFOR_MAP_G12_A(m, g) )
+#define SF_SEQ_FILTER_G12(p, g) IMPL_SEQFOR_FILTER_G12_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY12(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE12_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE12_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE12_A_ IMPL_SEQFOR_FOR_GUIDE12_B
+#define IMPL_SEQFOR_FOR_GUIDE12_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE12_END
+#define IMPL_SEQFOR_FOR_GUIDE12_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE12_END
+#define IMPL_SEQFOR_FOR_GUIDE12_END(m, s, f, d, ...) f(13, d)
+#define IMPL_SEQFOR_FOR_GUIDE12_B(m, s, f, d, ...) m(13, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE12_B_0(m, s, f, s(13, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE12_B_0(...) IMPL_SEQFOR_FOR_GUIDE12_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE12_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE12_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST12_A(m, s, f, d, e) IMPL_SEQFOR_FAST12_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST12_A_ IMPL_SEQFOR_FAST12_B
+#define IMPL_SEQFOR_FAST12_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE12_END
+#define IMPL_SEQFOR_FAST12_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE12_END
+#define IMPL_SEQFOR_FAST12_B(m, s, f, d, ...) m(13, d, __VA_ARGS__) IMPL_SEQFOR_FAST12_A(m, s, f, s(13, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL12_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL12_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL12_A_ IMPL_SEQFOR_UNTIL12_B
+#define IMPL_SEQFOR_UNTIL12_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE12_END
+#define IMPL_SEQFOR_UNTIL12_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE12_END
+#define IMPL_SEQFOR_UNTIL12_B(m, s, f, d, ...) m(13, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL12_B_0(m, s, f, s(13, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL12_B_0(...) IMPL_SEQFOR_UNTIL12_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL12_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL12_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL12_B_1_0 IMPL_SEQFOR_UNTIL12_A
+#define IMPL_SEQFOR_UNTIL12_B_1_1 IMPL_SEQFOR_UNTIL12_STOP
+#define IMPL_SEQFOR_UNTIL12_STOP(m, s, f, d, e) f(13, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP12_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP12_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP12_A_ IMPL_SEQFOR_ZIP12_B
+#define IMPL_SEQFOR_ZIP12_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE12_END
+#define IMPL_SEQFOR_ZIP12_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE12_END
+#define IMPL_SEQFOR_ZIP12_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP12_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP12_B_0(...) IMPL_SEQFOR_ZIP12_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP12_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP12_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP12_B_1_0 IMPL_SEQFOR_ZIP12_C
+#define IMPL_SEQFOR_ZIP12_B_1_1(m, s, f, d, ...) f(13, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP12_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP12_C(m, s, f, d, r, ...) m(13, d, __VA_ARGS__) IMPL_SEQFOR_ZIP12_A(m, s, f, s(13, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE12_A(m, e) IMPL_SEQFOR_SIMPLE12_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE12_A_ IMPL_SEQFOR_SIMPLE12_B
+#define IMPL_SEQFOR_SIMPLE12_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE12_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE12_B(m, ...) m(13, __VA_ARGS__) IMPL_SEQFOR_SIMPLE12_A(m,
+#define IMPL_SEQFOR_MAP12_A(m, e) IMPL_SEQFOR_MAP12_A_##e(m,
+#define IMPL_SEQFOR_MAP12_A_ IMPL_SEQFOR_MAP12_B
+#define IMPL_SEQFOR_MAP12_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP12_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP12_B(m, ...) (m(13, __VA_ARGS__)) IMPL_SEQFOR_MAP12_A(m,
+#define IMPL_SEQFOR_FILTER12_A(p, e) IMPL_SEQFOR_FILTER12_A_##e(p,
+#define IMPL_SEQFOR_FILTER12_A_ IMPL_SEQFOR_FILTER12_B
+#define IMPL_SEQFOR_FILTER12_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER12_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER12_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(13, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER12_A(p,
+#define IMPL_SEQFOR_MAP_G12_A(m, e) IMPL_SEQFOR_MAP_G12_A_##e(m,
+#define IMPL_SEQFOR_MAP_G12_A_ IMPL_SEQFOR_MAP_G12_B
+#define IMPL_SEQFOR_MAP_G12_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G12_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G12_B(m, ...) )m(13, __VA_ARGS__)) IMPL_SEQFOR_MAP_G12_A(m,
+#define IMPL_SEQFOR_FILTER_G12_A(p, e) IMPL_SEQFOR_FILTER_G12_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G12_A_ IMPL_SEQFOR_FILTER_G12_B
+#define IMPL_SEQFOR_FILTER_G12_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G12_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G12_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(13, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G12_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL12(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE12_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP12(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL12(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE12_A_
+#undef IMPL_SEQFOR_FOR_GUIDE12_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE12_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST12_A_
+#undef IMPL_SEQFOR_FAST12_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST12_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL12_A_
+#undef IMPL_SEQFOR_UNTIL12_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL12_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL12_B_1_1
+#undef IMPL_SEQFOR_ZIP12_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP12_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP12_B_1_0
+#undef IMPL_SEQFOR_ZIP12_B_1_1
+#undef IMPL_SEQFOR_SIMPLE12_A_
+#undef IMPL_SEQFOR_SIMPLE12_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE12_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE12_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE12_B
+#define IMPL_SEQFOR_FOR_GUIDE12_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL12
+#define IMPL_SEQFOR_FOR_GUIDE12_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL12
+#define IMPL_SEQFOR_FAST12_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST12_B
+#define IMPL_SEQFOR_FAST12_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL12
+#define IMPL_SEQFOR_FAST12_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL12
+#define IMPL_SEQFOR_UNTIL12_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL12_B
+#define IMPL_SEQFOR_UNTIL12_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL12
+#define IMPL_SEQFOR_UNTIL12_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL12
+#define IMPL_SEQFOR_UNTIL12_B_1_1 IMPL_SEQFOR_TRACE_STOP12
+#define IMPL_SEQFOR_ZIP12_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL12
+#define IMPL_SEQFOR_ZIP12_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL12
+#define IMPL_SEQFOR_ZIP12_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP12_C
+#define IMPL_SEQFOR_ZIP12_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL12(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE12_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE12_B
+#define IMPL_SEQFOR_SIMPLE12_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE12_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
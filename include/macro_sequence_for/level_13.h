@@ -0,0 +1,113 @@
+// Nesting level 13 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH13(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH13, 14) IMPL_SEQFOR_IDENTITY13( IMPL_SEQFOR_FOR_GUIDE13_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE13(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE13, 14) IMPL_SEQFOR_IDENTITY13( IMPL_SEQFOR_SIMPLE13_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST13(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST13, 14) IMPL_SEQFOR_IDENTITY13( IMPL_SEQFOR_FAST13_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL13(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL13, 14) IMPL_SEQFOR_IDENTITY13( IMPL_SEQFOR_UNTIL13_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP13(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP13, 14) IMPL_SEQFOR_IDENTITY13( IMPL_SEQFOR_ZIP13_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS13(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS13, 14) IMPL_SEQFOR_IDENTITY13( IMPL_SEQFOR_FOR_GUIDE13_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP13(m, seq) IMPL_SEQFOR_IDENTITY13( IMPL_SEQFOR_MAP13_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER13(p, seq) IMPL_SEQFOR_IDENTITY13( IMPL_SEQFOR_FILTER13_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G13(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G13, 14) IMPL_SEQFOR_FOR_GUIDE13_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G13(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G13, 14) IMPL_SEQFOR_SIMPLE13_A(m, g) )
+#define SF_FOR_EACH_FAST_G13(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G13, 14) IMPL_SEQFOR_FAST13_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G13(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G13, 14) IMPL_SEQFOR_UNTIL13_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G13(m, g) IMPL_SEQFOR_MAP_G13_A(m, g) )
+#define SF_SEQ_FILTER_G13(p, g) IMPL_SEQFOR_FILTER_G13_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY13(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE13_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE13_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE13_A_ IMPL_SEQFOR_FOR_GUIDE13_B
+#define IMPL_SEQFOR_FOR_GUIDE13_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE13_END
+#define IMPL_SEQFOR_FOR_GUIDE13_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE13_END
+#define IMPL_SEQFOR_FOR_GUIDE13_END(m, s, f, d, ...) f(14, d)
+#define IMPL_SEQFOR_FOR_GUIDE13_B(m, s, f, d, ...) m(14, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE13_B_0(m, s, f, s(14, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE13_B_0(...) IMPL_SEQFOR_FOR_GUIDE13_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE13_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE13_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST13_A(m, s, f, d, e) IMPL_SEQFOR_FAST13_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST13_A_ IMPL_SEQFOR_FAST13_B
+#define IMPL_SEQFOR_FAST13_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE13_END
+#define IMPL_SEQFOR_FAST13_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE13_END
+#define IMPL_SEQFOR_FAST13_B(m, s, f, d, ...) m(14, d, __VA_ARGS__) IMPL_SEQFOR_FAST13_A(m, s, f, s(14, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL13_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL13_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL13_A_ IMPL_SEQFOR_UNTIL13_B
+#define IMPL_SEQFOR_UNTIL13_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE13_END
+#define IMPL_SEQFOR_UNTIL13_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE13_END
+#define IMPL_SEQFOR_UNTIL13_B(m, s, f, d, ...) m(14, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL13_B_0(m, s, f, s(14, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL13_B_0(...) IMPL_SEQFOR_UNTIL13_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL13_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL13_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL13_B_1_0 IMPL_SEQFOR_UNTIL13_A
+#define IMPL_SEQFOR_UNTIL13_B_1_1 IMPL_SEQFOR_UNTIL13_STOP
+#define IMPL_SEQFOR_UNTIL13_STOP(m, s, f, d, e) f(14, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP13_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP13_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP13_A_ IMPL_SEQFOR_ZIP13_B
+#define IMPL_SEQFOR_ZIP13_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE13_END
+#define IMPL_SEQFOR_ZIP13_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE13_END
+#define IMPL_SEQFOR_ZIP13_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP13_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP13_B_0(...) IMPL_SEQFOR_ZIP13_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP13_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP13_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP13_B_1_0 IMPL_SEQFOR_ZIP13_C
+#define IMPL_SEQFOR_ZIP13_B_1_1(m, s, f, d, ...) f(14, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP13_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP13_C(m, s, f, d, r, ...) m(14, d, __VA_ARGS__) IMPL_SEQFOR_ZIP13_A(m, s, f, s(14, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE13_A(m, e) IMPL_SEQFOR_SIMPLE13_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE13_A_ IMPL_SEQFOR_SIMPLE13_B
+#define IMPL_SEQFOR_SIMPLE13_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE13_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE13_B(m, ...) m(14, __VA_ARGS__) IMPL_SEQFOR_SIMPLE13_A(m,
+#define IMPL_SEQFOR_MAP13_A(m, e) IMPL_SEQFOR_MAP13_A_##e(m,
+#define IMPL_SEQFOR_MAP13_A_ IMPL_SEQFOR_MAP13_B
+#define IMPL_SEQFOR_MAP13_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP13_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP13_B(m, ...) (m(14, __VA_ARGS__)) IMPL_SEQFOR_MAP13_A(m,
+#define IMPL_SEQFOR_FILTER13_A(p, e) IMPL_SEQFOR_FILTER13_A_##e(p,
+#define IMPL_SEQFOR_FILTER13_A_ IMPL_SEQFOR_FILTER13_B
+#define IMPL_SEQFOR_FILTER13_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER13_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER13_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(14, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER13_A(p,
+#define IMPL_SEQFOR_MAP_G13_A(m, e) IMPL_SEQFOR_MAP_G13_A_##e(m,
+#define IMPL_SEQFOR_MAP_G13_A_ IMPL_SEQFOR_MAP_G13_B
+#define IMPL_SEQFOR_MAP_G13_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G13_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G13_B(m, ...) )m(14, __VA_ARGS__)) IMPL_SEQFOR_MAP_G13_A(m,
+#define IMPL_SEQFOR_FILTER_G13_A(p, e) IMPL_SEQFOR_FILTER_G13_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G13_A_ IMPL_SEQFOR_FILTER_G13_B
+#define IMPL_SEQFOR_FILTER_G13_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G13_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G13_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(14, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G13_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL13(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE13_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP13(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL13(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE13_A_
+#undef IMPL_SEQFOR_FOR_GUIDE13_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE13_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST13_A_
+#undef IMPL_SEQFOR_FAST13_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST13_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL13_A_
+#undef IMPL_SEQFOR_UNTIL13_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL13_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL13_B_1_1
+#undef IMPL_SEQFOR_ZIP13_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP13_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP13_B_1_0
+#undef IMPL_SEQFOR_ZIP13_B_1_1
+#undef IMPL_SEQFOR_SIMPLE13_A_
+#undef IMPL_SEQFOR_SIMPLE13_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE13_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE13_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE13_B
+#define IMPL_SEQFOR_FOR_GUIDE13_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL13
+#define IMPL_SEQFOR_FOR_GUIDE13_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL13
+#define IMPL_SEQFOR_FAST13_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST13_B
+#define IMPL_SEQFOR_FAST13_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL13
+#define IMPL_SEQFOR_FAST13_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL13
+#define IMPL_SEQFOR_UNTIL13_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL13_B
+#define IMPL_SEQFOR_UNTIL13_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL13
+#define IMPL_SEQFOR_UNTIL13_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL13
+#define IMPL_SEQFOR_UNTIL13_B_1_1 IMPL_SEQFOR_TRACE_STOP13
+#define IMPL_SEQFOR_ZIP13_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL13
+#define IMPL_SEQFOR_ZIP13_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL13
+#define IMPL_SEQFOR_ZIP13_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP13_C
+#define IMPL_SEQFOR_ZIP13_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL13(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE13_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE13_B
+#define IMPL_SEQFOR_SIMPLE13_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE13_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
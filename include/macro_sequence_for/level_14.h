@@ -0,0 +1,113 @@
+// Nesting level 14 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH14(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH14, 15) IMPL_SEQFOR_IDENTITY14( IMPL_SEQFOR_FOR_GUIDE14_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE14(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE14, 15) IMPL_SEQFOR_IDENTITY14( IMPL_SEQFOR_SIMPLE14_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST14(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST14, 15) IMPL_SEQFOR_IDENTITY14( IMPL_SEQFOR_FAST14_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL14(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL14, 15) IMPL_SEQFOR_IDENTITY14( IMPL_SEQFOR_UNTIL14_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP14(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP14, 15) IMPL_SEQFOR_IDENTITY14( IMPL_SEQFOR_ZIP14_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS14(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS14, 15) IMPL_SEQFOR_IDENTITY14( IMPL_SEQFOR_FOR_GUIDE14_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP14(m, seq) IMPL_SEQFOR_IDENTITY14( IMPL_SEQFOR_MAP14_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER14(p, seq) IMPL_SEQFOR_IDENTITY14( IMPL_SEQFOR_FILTER14_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G14(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G14, 15) IMPL_SEQFOR_FOR_GUIDE14_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G14(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G14, 15) IMPL_SEQFOR_SIMPLE14_A(m, g) )
+#define SF_FOR_EACH_FAST_G14(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G14, 15) IMPL_SEQFOR_FAST14_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G14(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G14, 15) IMPL_SEQFOR_UNTIL14_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G14(m, g) IMPL_SEQFOR_MAP_G14_A(m, g) )
+#define SF_SEQ_FILTER_G14(p, g) IMPL_SEQFOR_FILTER_G14_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY14(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE14_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE14_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE14_A_ IMPL_SEQFOR_FOR_GUIDE14_B
+#define IMPL_SEQFOR_FOR_GUIDE14_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE14_END
+#define IMPL_SEQFOR_FOR_GUIDE14_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE14_END
+#define IMPL_SEQFOR_FOR_GUIDE14_END(m, s, f, d, ...) f(15, d)
+#define IMPL_SEQFOR_FOR_GUIDE14_B(m, s, f, d, ...) m(15, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE14_B_0(m, s, f, s(15, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE14_B_0(...) IMPL_SEQFOR_FOR_GUIDE14_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE14_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE14_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST14_A(m, s, f, d, e) IMPL_SEQFOR_FAST14_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST14_A_ IMPL_SEQFOR_FAST14_B
+#define IMPL_SEQFOR_FAST14_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE14_END
+#define IMPL_SEQFOR_FAST14_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE14_END
+#define IMPL_SEQFOR_FAST14_B(m, s, f, d, ...) m(15, d, __VA_ARGS__) IMPL_SEQFOR_FAST14_A(m, s, f, s(15, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL14_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL14_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL14_A_ IMPL_SEQFOR_UNTIL14_B
+#define IMPL_SEQFOR_UNTIL14_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE14_END
+#define IMPL_SEQFOR_UNTIL14_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE14_END
+#define IMPL_SEQFOR_UNTIL14_B(m, s, f, d, ...) m(15, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL14_B_0(m, s, f, s(15, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL14_B_0(...) IMPL_SEQFOR_UNTIL14_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL14_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL14_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL14_B_1_0 IMPL_SEQFOR_UNTIL14_A
+#define IMPL_SEQFOR_UNTIL14_B_1_1 IMPL_SEQFOR_UNTIL14_STOP
+#define IMPL_SEQFOR_UNTIL14_STOP(m, s, f, d, e) f(15, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP14_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP14_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP14_A_ IMPL_SEQFOR_ZIP14_B
+#define IMPL_SEQFOR_ZIP14_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE14_END
+#define IMPL_SEQFOR_ZIP14_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE14_END
+#define IMPL_SEQFOR_ZIP14_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP14_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP14_B_0(...) IMPL_SEQFOR_ZIP14_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP14_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP14_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP14_B_1_0 IMPL_SEQFOR_ZIP14_C
+#define IMPL_SEQFOR_ZIP14_B_1_1(m, s, f, d, ...) f(15, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP14_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP14_C(m, s, f, d, r, ...) m(15, d, __VA_ARGS__) IMPL_SEQFOR_ZIP14_A(m, s, f, s(15, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE14_A(m, e) IMPL_SEQFOR_SIMPLE14_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE14_A_ IMPL_SEQFOR_SIMPLE14_B
+#define IMPL_SEQFOR_SIMPLE14_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE14_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE14_B(m, ...) m(15, __VA_ARGS__) IMPL_SEQFOR_SIMPLE14_A(m,
+#define IMPL_SEQFOR_MAP14_A(m, e) IMPL_SEQFOR_MAP14_A_##e(m,
+#define IMPL_SEQFOR_MAP14_A_ IMPL_SEQFOR_MAP14_B
+#define IMPL_SEQFOR_MAP14_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP14_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP14_B(m, ...) (m(15, __VA_ARGS__)) IMPL_SEQFOR_MAP14_A(m,
+#define IMPL_SEQFOR_FILTER14_A(p, e) IMPL_SEQFOR_FILTER14_A_##e(p,
+#define IMPL_SEQFOR_FILTER14_A_ IMPL_SEQFOR_FILTER14_B
+#define IMPL_SEQFOR_FILTER14_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER14_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER14_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(15, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER14_A(p,
+#define IMPL_SEQFOR_MAP_G14_A(m, e) IMPL_SEQFOR_MAP_G14_A_##e(m,
+#define IMPL_SEQFOR_MAP_G14_A_ IMPL_SEQFOR_MAP_G14_B
+#define IMPL_SEQFOR_MAP_G14_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G14_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G14_B(m, ...) )m(15, __VA_ARGS__)) IMPL_SEQFOR_MAP_G14_A(m,
+#define IMPL_SEQFOR_FILTER_G14_A(p, e) IMPL_SEQFOR_FILTER_G14_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G14_A_ IMPL_SEQFOR_FILTER_G14_B
+#define IMPL_SEQFOR_FILTER_G14_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G14_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G14_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(15, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G14_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL14(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE14_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP14(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL14(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE14_A_
+#undef IMPL_SEQFOR_FOR_GUIDE14_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE14_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST14_A_
+#undef IMPL_SEQFOR_FAST14_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST14_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL14_A_
+#undef IMPL_SEQFOR_UNTIL14_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL14_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL14_B_1_1
+#undef IMPL_SEQFOR_ZIP14_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP14_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP14_B_1_0
+#undef IMPL_SEQFOR_ZIP14_B_1_1
+#undef IMPL_SEQFOR_SIMPLE14_A_
+#undef IMPL_SEQFOR_SIMPLE14_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE14_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE14_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE14_B
+#define IMPL_SEQFOR_FOR_GUIDE14_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL14
+#define IMPL_SEQFOR_FOR_GUIDE14_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL14
+#define IMPL_SEQFOR_FAST14_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST14_B
+#define IMPL_SEQFOR_FAST14_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL14
+#define IMPL_SEQFOR_FAST14_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL14
+#define IMPL_SEQFOR_UNTIL14_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL14_B
+#define IMPL_SEQFOR_UNTIL14_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL14
+#define IMPL_SEQFOR_UNTIL14_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL14
+#define IMPL_SEQFOR_UNTIL14_B_1_1 IMPL_SEQFOR_TRACE_STOP14
+#define IMPL_SEQFOR_ZIP14_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL14
+#define IMPL_SEQFOR_ZIP14_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL14
+#define IMPL_SEQFOR_ZIP14_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP14_C
+#define IMPL_SEQFOR_ZIP14_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL14(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE14_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE14_B
+#define IMPL_SEQFOR_SIMPLE14_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE14_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
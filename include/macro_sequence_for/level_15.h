@@ -0,0 +1,113 @@
+// Nesting level 15 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH15(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH15, 16) IMPL_SEQFOR_IDENTITY15( IMPL_SEQFOR_FOR_GUIDE15_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE15(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE15, 16) IMPL_SEQFOR_IDENTITY15( IMPL_SEQFOR_SIMPLE15_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST15(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST15, 16) IMPL_SEQFOR_IDENTITY15( IMPL_SEQFOR_FAST15_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL15(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL15, 16) IMPL_SEQFOR_IDENTITY15( IMPL_SEQFOR_UNTIL15_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP15(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP15, 16) IMPL_SEQFOR_IDENTITY15( IMPL_SEQFOR_ZIP15_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS15(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS15, 16) IMPL_SEQFOR_IDENTITY15( IMPL_SEQFOR_FOR_GUIDE15_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP15(m, seq) IMPL_SEQFOR_IDENTITY15( IMPL_SEQFOR_MAP15_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER15(p, seq) IMPL_SEQFOR_IDENTITY15( IMPL_SEQFOR_FILTER15_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G15(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G15, 16) IMPL_SEQFOR_FOR_GUIDE15_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G15(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G15, 16) IMPL_SEQFOR_SIMPLE15_A(m, g) )
+#define SF_FOR_EACH_FAST_G15(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G15, 16) IMPL_SEQFOR_FAST15_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G15(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G15, 16) IMPL_SEQFOR_UNTIL15_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G15(m, g) IMPL_SEQFOR_MAP_G15_A(m, g) )
+#define SF_SEQ_FILTER_G15(p, g) IMPL_SEQFOR_FILTER_G15_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY15(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE15_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE15_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE15_A_ IMPL_SEQFOR_FOR_GUIDE15_B
+#define IMPL_SEQFOR_FOR_GUIDE15_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE15_END
+#define IMPL_SEQFOR_FOR_GUIDE15_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE15_END
+#define IMPL_SEQFOR_FOR_GUIDE15_END(m, s, f, d, ...) f(16, d)
+#define IMPL_SEQFOR_FOR_GUIDE15_B(m, s, f, d, ...) m(16, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE15_B_0(m, s, f, s(16, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE15_B_0(...) IMPL_SEQFOR_FOR_GUIDE15_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE15_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE15_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST15_A(m, s, f, d, e) IMPL_SEQFOR_FAST15_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST15_A_ IMPL_SEQFOR_FAST15_B
+#define IMPL_SEQFOR_FAST15_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE15_END
+#define IMPL_SEQFOR_FAST15_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE15_END
+#define IMPL_SEQFOR_FAST15_B(m, s, f, d, ...) m(16, d, __VA_ARGS__) IMPL_SEQFOR_FAST15_A(m, s, f, s(16, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL15_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL15_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL15_A_ IMPL_SEQFOR_UNTIL15_B
+#define IMPL_SEQFOR_UNTIL15_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE15_END
+#define IMPL_SEQFOR_UNTIL15_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE15_END
+#define IMPL_SEQFOR_UNTIL15_B(m, s, f, d, ...) m(16, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL15_B_0(m, s, f, s(16, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL15_B_0(...) IMPL_SEQFOR_UNTIL15_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL15_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL15_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL15_B_1_0 IMPL_SEQFOR_UNTIL15_A
+#define IMPL_SEQFOR_UNTIL15_B_1_1 IMPL_SEQFOR_UNTIL15_STOP
+#define IMPL_SEQFOR_UNTIL15_STOP(m, s, f, d, e) f(16, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP15_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP15_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP15_A_ IMPL_SEQFOR_ZIP15_B
+#define IMPL_SEQFOR_ZIP15_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE15_END
+#define IMPL_SEQFOR_ZIP15_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE15_END
+#define IMPL_SEQFOR_ZIP15_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP15_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP15_B_0(...) IMPL_SEQFOR_ZIP15_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP15_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP15_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP15_B_1_0 IMPL_SEQFOR_ZIP15_C
+#define IMPL_SEQFOR_ZIP15_B_1_1(m, s, f, d, ...) f(16, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP15_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP15_C(m, s, f, d, r, ...) m(16, d, __VA_ARGS__) IMPL_SEQFOR_ZIP15_A(m, s, f, s(16, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE15_A(m, e) IMPL_SEQFOR_SIMPLE15_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE15_A_ IMPL_SEQFOR_SIMPLE15_B
+#define IMPL_SEQFOR_SIMPLE15_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE15_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE15_B(m, ...) m(16, __VA_ARGS__) IMPL_SEQFOR_SIMPLE15_A(m,
+#define IMPL_SEQFOR_MAP15_A(m, e) IMPL_SEQFOR_MAP15_A_##e(m,
+#define IMPL_SEQFOR_MAP15_A_ IMPL_SEQFOR_MAP15_B
+#define IMPL_SEQFOR_MAP15_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP15_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP15_B(m, ...) (m(16, __VA_ARGS__)) IMPL_SEQFOR_MAP15_A(m,
+#define IMPL_SEQFOR_FILTER15_A(p, e) IMPL_SEQFOR_FILTER15_A_##e(p,
+#define IMPL_SEQFOR_FILTER15_A_ IMPL_SEQFOR_FILTER15_B
+#define IMPL_SEQFOR_FILTER15_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER15_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER15_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(16, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER15_A(p,
+#define IMPL_SEQFOR_MAP_G15_A(m, e) IMPL_SEQFOR_MAP_G15_A_##e(m,
+#define IMPL_SEQFOR_MAP_G15_A_ IMPL_SEQFOR_MAP_G15_B
+#define IMPL_SEQFOR_MAP_G15_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G15_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G15_B(m, ...) )m(16, __VA_ARGS__)) IMPL_SEQFOR_MAP_G15_A(m,
+#define IMPL_SEQFOR_FILTER_G15_A(p, e) IMPL_SEQFOR_FILTER_G15_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G15_A_ IMPL_SEQFOR_FILTER_G15_B
+#define IMPL_SEQFOR_FILTER_G15_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G15_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G15_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(16, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G15_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL15(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE15_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP15(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL15(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE15_A_
+#undef IMPL_SEQFOR_FOR_GUIDE15_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE15_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST15_A_
+#undef IMPL_SEQFOR_FAST15_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST15_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL15_A_
+#undef IMPL_SEQFOR_UNTIL15_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL15_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL15_B_1_1
+#undef IMPL_SEQFOR_ZIP15_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP15_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP15_B_1_0
+#undef IMPL_SEQFOR_ZIP15_B_1_1
+#undef IMPL_SEQFOR_SIMPLE15_A_
+#undef IMPL_SEQFOR_SIMPLE15_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE15_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE15_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE15_B
+#define IMPL_SEQFOR_FOR_GUIDE15_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL15
+#define IMPL_SEQFOR_FOR_GUIDE15_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL15
+#define IMPL_SEQFOR_FAST15_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST15_B
+#define IMPL_SEQFOR_FAST15_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL15
+#define IMPL_SEQFOR_FAST15_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL15
+#define IMPL_SEQFOR_UNTIL15_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL15_B
+#define IMPL_SEQFOR_UNTIL15_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL15
+#define IMPL_SEQFOR_UNTIL15_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL15
+#define IMPL_SEQFOR_UNTIL15_B_1_1 IMPL_SEQFOR_TRACE_STOP15
+#define IMPL_SEQFOR_ZIP15_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL15
+#define IMPL_SEQFOR_ZIP15_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL15
+#define IMPL_SEQFOR_ZIP15_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP15_C
+#define IMPL_SEQFOR_ZIP15_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL15(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE15_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE15_B
+#define IMPL_SEQFOR_SIMPLE15_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE15_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
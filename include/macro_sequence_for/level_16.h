@@ -0,0 +1,113 @@
+// Nesting level 16 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH16(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH16, 17) IMPL_SEQFOR_IDENTITY16( IMPL_SEQFOR_FOR_GUIDE16_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE16(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE16, 17) IMPL_SEQFOR_IDENTITY16( IMPL_SEQFOR_SIMPLE16_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST16(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST16, 17) IMPL_SEQFOR_IDENTITY16( IMPL_SEQFOR_FAST16_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL16(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL16, 17) IMPL_SEQFOR_IDENTITY16( IMPL_SEQFOR_UNTIL16_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP16(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP16, 17) IMPL_SEQFOR_IDENTITY16( IMPL_SEQFOR_ZIP16_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS16(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS16, 17) IMPL_SEQFOR_IDENTITY16( IMPL_SEQFOR_FOR_GUIDE16_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP16(m, seq) IMPL_SEQFOR_IDENTITY16( IMPL_SEQFOR_MAP16_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER16(p, seq) IMPL_SEQFOR_IDENTITY16( IMPL_SEQFOR_FILTER16_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G16(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G16, 17) IMPL_SEQFOR_FOR_GUIDE16_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G16(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G16, 17) IMPL_SEQFOR_SIMPLE16_A(m, g) )
+#define SF_FOR_EACH_FAST_G16(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G16, 17) IMPL_SEQFOR_FAST16_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G16(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G16, 17) IMPL_SEQFOR_UNTIL16_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G16(m, g) IMPL_SEQFOR_MAP_G16_A(m, g) )
+#define SF_SEQ_FILTER_G16(p, g) IMPL_SEQFOR_FILTER_G16_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY16(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE16_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE16_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE16_A_ IMPL_SEQFOR_FOR_GUIDE16_B
+#define IMPL_SEQFOR_FOR_GUIDE16_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE16_END
+#define IMPL_SEQFOR_FOR_GUIDE16_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE16_END
+#define IMPL_SEQFOR_FOR_GUIDE16_END(m, s, f, d, ...) f(17, d)
+#define IMPL_SEQFOR_FOR_GUIDE16_B(m, s, f, d, ...) m(17, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE16_B_0(m, s, f, s(17, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE16_B_0(...) IMPL_SEQFOR_FOR_GUIDE16_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE16_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE16_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST16_A(m, s, f, d, e) IMPL_SEQFOR_FAST16_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST16_A_ IMPL_SEQFOR_FAST16_B
+#define IMPL_SEQFOR_FAST16_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE16_END
+#define IMPL_SEQFOR_FAST16_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE16_END
+#define IMPL_SEQFOR_FAST16_B(m, s, f, d, ...) m(17, d, __VA_ARGS__) IMPL_SEQFOR_FAST16_A(m, s, f, s(17, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL16_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL16_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL16_A_ IMPL_SEQFOR_UNTIL16_B
+#define IMPL_SEQFOR_UNTIL16_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE16_END
+#define IMPL_SEQFOR_UNTIL16_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE16_END
+#define IMPL_SEQFOR_UNTIL16_B(m, s, f, d, ...) m(17, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL16_B_0(m, s, f, s(17, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL16_B_0(...) IMPL_SEQFOR_UNTIL16_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL16_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL16_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL16_B_1_0 IMPL_SEQFOR_UNTIL16_A
+#define IMPL_SEQFOR_UNTIL16_B_1_1 IMPL_SEQFOR_UNTIL16_STOP
+#define IMPL_SEQFOR_UNTIL16_STOP(m, s, f, d, e) f(17, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP16_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP16_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP16_A_ IMPL_SEQFOR_ZIP16_B
+#define IMPL_SEQFOR_ZIP16_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE16_END
+#define IMPL_SEQFOR_ZIP16_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE16_END
+#define IMPL_SEQFOR_ZIP16_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP16_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP16_B_0(...) IMPL_SEQFOR_ZIP16_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP16_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP16_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP16_B_1_0 IMPL_SEQFOR_ZIP16_C
+#define IMPL_SEQFOR_ZIP16_B_1_1(m, s, f, d, ...) f(17, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP16_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP16_C(m, s, f, d, r, ...) m(17, d, __VA_ARGS__) IMPL_SEQFOR_ZIP16_A(m, s, f, s(17, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE16_A(m, e) IMPL_SEQFOR_SIMPLE16_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE16_A_ IMPL_SEQFOR_SIMPLE16_B
+#define IMPL_SEQFOR_SIMPLE16_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE16_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE16_B(m, ...) m(17, __VA_ARGS__) IMPL_SEQFOR_SIMPLE16_A(m,
+#define IMPL_SEQFOR_MAP16_A(m, e) IMPL_SEQFOR_MAP16_A_##e(m,
+#define IMPL_SEQFOR_MAP16_A_ IMPL_SEQFOR_MAP16_B
+#define IMPL_SEQFOR_MAP16_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP16_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP16_B(m, ...) (m(17, __VA_ARGS__)) IMPL_SEQFOR_MAP16_A(m,
+#define IMPL_SEQFOR_FILTER16_A(p, e) IMPL_SEQFOR_FILTER16_A_##e(p,
+#define IMPL_SEQFOR_FILTER16_A_ IMPL_SEQFOR_FILTER16_B
+#define IMPL_SEQFOR_FILTER16_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER16_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER16_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(17, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER16_A(p,
+#define IMPL_SEQFOR_MAP_G16_A(m, e) IMPL_SEQFOR_MAP_G16_A_##e(m,
+#define IMPL_SEQFOR_MAP_G16_A_ IMPL_SEQFOR_MAP_G16_B
+#define IMPL_SEQFOR_MAP_G16_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G16_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G16_B(m, ...) )m(17, __VA_ARGS__)) IMPL_SEQFOR_MAP_G16_A(m,
+#define IMPL_SEQFOR_FILTER_G16_A(p, e) IMPL_SEQFOR_FILTER_G16_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G16_A_ IMPL_SEQFOR_FILTER_G16_B
+#define IMPL_SEQFOR_FILTER_G16_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G16_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G16_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(17, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G16_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL16(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE16_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP16(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL16(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE16_A_
+#undef IMPL_SEQFOR_FOR_GUIDE16_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE16_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST16_A_
+#undef IMPL_SEQFOR_FAST16_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST16_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL16_A_
+#undef IMPL_SEQFOR_UNTIL16_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL16_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL16_B_1_1
+#undef IMPL_SEQFOR_ZIP16_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP16_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP16_B_1_0
+#undef IMPL_SEQFOR_ZIP16_B_1_1
+#undef IMPL_SEQFOR_SIMPLE16_A_
+#undef IMPL_SEQFOR_SIMPLE16_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE16_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE16_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE16_B
+#define IMPL_SEQFOR_FOR_GUIDE16_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL16
+#define IMPL_SEQFOR_FOR_GUIDE16_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL16
+#define IMPL_SEQFOR_FAST16_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST16_B
+#define IMPL_SEQFOR_FAST16_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL16
+#define IMPL_SEQFOR_FAST16_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL16
+#define IMPL_SEQFOR_UNTIL16_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL16_B
+#define IMPL_SEQFOR_UNTIL16_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL16
+#define IMPL_SEQFOR_UNTIL16_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL16
+#define IMPL_SEQFOR_UNTIL16_B_1_1 IMPL_SEQFOR_TRACE_STOP16
+#define IMPL_SEQFOR_ZIP16_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL16
+#define IMPL_SEQFOR_ZIP16_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL16
+#define IMPL_SEQFOR_ZIP16_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP16_C
+#define IMPL_SEQFOR_ZIP16_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL16(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE16_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE16_B
+#define IMPL_SEQFOR_SIMPLE16_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE16_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 17 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH17(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH17, 18) IMPL_SEQFOR_IDENTITY17( IMPL_SEQFOR_FOR_GUIDE17_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE17(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE17, 18) IMPL_SEQFOR_IDENTITY17( IMPL_SEQFOR_SIMPLE17_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST17(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST17, 18) IMPL_SEQFOR_IDENTITY17( IMPL_SEQFOR_FAST17_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL17(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL17, 18) IMPL_SEQFOR_IDENTITY17( IMPL_SEQFOR_UNTIL17_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP17(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP17, 18) IMPL_SEQFOR_IDENTITY17( IMPL_SEQFOR_ZIP17_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS17(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS17, 18) IMPL_SEQFOR_IDENTITY17( IMPL_SEQFOR_FOR_GUIDE17_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP17(m, seq) IMPL_SEQFOR_IDENTITY17( IMPL_SEQFOR_MAP17_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER17(p, seq) IMPL_SEQFOR_IDENTITY17( IMPL_SEQFOR_FILTER17_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G17(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G17, 18) IMPL_SEQFOR_FOR_GUIDE17_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G17(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G17, 18) IMPL_SEQFOR_SIMPLE17_A(m, g) )
+#define SF_FOR_EACH_FAST_G17(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G17, 18) IMPL_SEQFOR_FAST17_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G17(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G17, 18) IMPL_SEQFOR_UNTIL17_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G17(m, g) IMPL_SEQFOR_MAP_G17_A(m, g) )
+#define SF_SEQ_FILTER_G17(p, g) IMPL_SEQFOR_FILTER_G17_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY17(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE17_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE17_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE17_A_ IMPL_SEQFOR_FOR_GUIDE17_B
+#define IMPL_SEQFOR_FOR_GUIDE17_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE17_END
+#define IMPL_SEQFOR_FOR_GUIDE17_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE17_END
+#define IMPL_SEQFOR_FOR_GUIDE17_END(m, s, f, d, ...) f(18, d)
+#define IMPL_SEQFOR_FOR_GUIDE17_B(m, s, f, d, ...) m(18, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE17_B_0(m, s, f, s(18, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE17_B_0(...) IMPL_SEQFOR_FOR_GUIDE17_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE17_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE17_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST17_A(m, s, f, d, e) IMPL_SEQFOR_FAST17_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST17_A_ IMPL_SEQFOR_FAST17_B
+#define IMPL_SEQFOR_FAST17_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE17_END
+#define IMPL_SEQFOR_FAST17_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE17_END
+#define IMPL_SEQFOR_FAST17_B(m, s, f, d, ...) m(18, d, __VA_ARGS__) IMPL_SEQFOR_FAST17_A(m, s, f, s(18, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL17_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL17_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL17_A_ IMPL_SEQFOR_UNTIL17_B
+#define IMPL_SEQFOR_UNTIL17_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE17_END
+#define IMPL_SEQFOR_UNTIL17_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE17_END
+#define IMPL_SEQFOR_UNTIL17_B(m, s, f, d, ...) m(18, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL17_B_0(m, s, f, s(18, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL17_B_0(...) IMPL_SEQFOR_UNTIL17_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL17_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL17_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL17_B_1_0 IMPL_SEQFOR_UNTIL17_A
+#define IMPL_SEQFOR_UNTIL17_B_1_1 IMPL_SEQFOR_UNTIL17_STOP
+#define IMPL_SEQFOR_UNTIL17_STOP(m, s, f, d, e) f(18, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP17_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP17_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP17_A_ IMPL_SEQFOR_ZIP17_B
+#define IMPL_SEQFOR_ZIP17_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE17_END
+#define IMPL_SEQFOR_ZIP17_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE17_END
+#define IMPL_SEQFOR_ZIP17_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP17_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP17_B_0(...) IMPL_SEQFOR_ZIP17_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP17_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP17_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP17_B_1_0 IMPL_SEQFOR_ZIP17_C
+#define IMPL_SEQFOR_ZIP17_B_1_1(m, s, f, d, ...) f(18, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP17_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP17_C(m, s, f, d, r, ...) m(18, d, __VA_ARGS__) IMPL_SEQFOR_ZIP17_A(m, s, f, s(18, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE17_A(m, e) IMPL_SEQFOR_SIMPLE17_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE17_A_ IMPL_SEQFOR_SIMPLE17_B
+#define IMPL_SEQFOR_SIMPLE17_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE17_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE17_B(m, ...) m(18, __VA_ARGS__) IMPL_SEQFOR_SIMPLE17_A(m,
+#define IMPL_SEQFOR_MAP17_A(m, e) IMPL_SEQFOR_MAP17_A_##e(m,
+#define IMPL_SEQFOR_MAP17_A_ IMPL_SEQFOR_MAP17_B
+#define IMPL_SEQFOR_MAP17_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP17_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP17_B(m, ...) (m(18, __VA_ARGS__)) IMPL_SEQFOR_MAP17_A(m,
+#define IMPL_SEQFOR_FILTER17_A(p, e) IMPL_SEQFOR_FILTER17_A_##e(p,
+#define IMPL_SEQFOR_FILTER17_A_ IMPL_SEQFOR_FILTER17_B
+#define IMPL_SEQFOR_FILTER17_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER17_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER17_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(18, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER17_A(p,
+#define IMPL_SEQFOR_MAP_G17_A(m, e) IMPL_SEQFOR_MAP_G17_A_##e(m,
+#define IMPL_SEQFOR_MAP_G17_A_ IMPL_SEQFOR_MAP_G17_B
+#define IMPL_SEQFOR_MAP_G17_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G17_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G17_B(m, ...) )m(18, __VA_ARGS__)) IMPL_SEQFOR_MAP_G17_A(m,
+#define IMPL_SEQFOR_FILTER_G17_A(p, e) IMPL_SEQFOR_FILTER_G17_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G17_A_ IMPL_SEQFOR_FILTER_G17_B
+#define IMPL_SEQFOR_FILTER_G17_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G17_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G17_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(18, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G17_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL17(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE17_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP17(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL17(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE17_A_
+#undef IMPL_SEQFOR_FOR_GUIDE17_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE17_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST17_A_
+#undef IMPL_SEQFOR_FAST17_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST17_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL17_A_
+#undef IMPL_SEQFOR_UNTIL17_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL17_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL17_B_1_1
+#undef IMPL_SEQFOR_ZIP17_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP17_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP17_B_1_0
+#undef IMPL_SEQFOR_ZIP17_B_1_1
+#undef IMPL_SEQFOR_SIMPLE17_A_
+#undef IMPL_SEQFOR_SIMPLE17_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE17_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE17_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE17_B
+#define IMPL_SEQFOR_FOR_GUIDE17_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL17
+#define IMPL_SEQFOR_FOR_GUIDE17_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL17
+#define IMPL_SEQFOR_FAST17_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST17_B
+#define IMPL_SEQFOR_FAST17_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL17
+#define IMPL_SEQFOR_FAST17_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL17
+#define IMPL_SEQFOR_UNTIL17_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL17_B
+#define IMPL_SEQFOR_UNTIL17_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL17
+#define IMPL_SEQFOR_UNTIL17_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL17
+#define IMPL_SEQFOR_UNTIL17_B_1_1 IMPL_SEQFOR_TRACE_STOP17
+#define IMPL_SEQFOR_ZIP17_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL17
+#define IMPL_SEQFOR_ZIP17_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL17
+#define IMPL_SEQFOR_ZIP17_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP17_C
+#define IMPL_SEQFOR_ZIP17_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL17(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE17_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE17_B
+#define IMPL_SEQFOR_SIMPLE17_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE17_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 18 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH18(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH18, 19) IMPL_SEQFOR_IDENTITY18( IMPL_SEQFOR_FOR_GUIDE18_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE18(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE18, 19) IMPL_SEQFOR_IDENTITY18( IMPL_SEQFOR_SIMPLE18_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST18(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST18, 19) IMPL_SEQFOR_IDENTITY18( IMPL_SEQFOR_FAST18_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL18(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL18, 19) IMPL_SEQFOR_IDENTITY18( IMPL_SEQFOR_UNTIL18_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP18(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP18, 19) IMPL_SEQFOR_IDENTITY18( IMPL_SEQFOR_ZIP18_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS18(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS18, 19) IMPL_SEQFOR_IDENTITY18( IMPL_SEQFOR_FOR_GUIDE18_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP18(m, seq) IMPL_SEQFOR_IDENTITY18( IMPL_SEQFOR_MAP18_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER18(p, seq) IMPL_SEQFOR_IDENTITY18( IMPL_SEQFOR_FILTER18_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G18(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G18, 19) IMPL_SEQFOR_FOR_GUIDE18_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G18(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G18, 19) IMPL_SEQFOR_SIMPLE18_A(m, g) )
+#define SF_FOR_EACH_FAST_G18(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G18, 19) IMPL_SEQFOR_FAST18_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G18(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G18, 19) IMPL_SEQFOR_UNTIL18_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G18(m, g) IMPL_SEQFOR_MAP_G18_A(m, g) )
+#define SF_SEQ_FILTER_G18(p, g) IMPL_SEQFOR_FILTER_G18_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY18(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE18_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE18_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE18_A_ IMPL_SEQFOR_FOR_GUIDE18_B
+#define IMPL_SEQFOR_FOR_GUIDE18_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE18_END
+#define IMPL_SEQFOR_FOR_GUIDE18_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE18_END
+#define IMPL_SEQFOR_FOR_GUIDE18_END(m, s, f, d, ...) f(19, d)
+#define IMPL_SEQFOR_FOR_GUIDE18_B(m, s, f, d, ...) m(19, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE18_B_0(m, s, f, s(19, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE18_B_0(...) IMPL_SEQFOR_FOR_GUIDE18_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE18_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE18_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST18_A(m, s, f, d, e) IMPL_SEQFOR_FAST18_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST18_A_ IMPL_SEQFOR_FAST18_B
+#define IMPL_SEQFOR_FAST18_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE18_END
+#define IMPL_SEQFOR_FAST18_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE18_END
+#define IMPL_SEQFOR_FAST18_B(m, s, f, d, ...) m(19, d, __VA_ARGS__) IMPL_SEQFOR_FAST18_A(m, s, f, s(19, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL18_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL18_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL18_A_ IMPL_SEQFOR_UNTIL18_B
+#define IMPL_SEQFOR_UNTIL18_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE18_END
+#define IMPL_SEQFOR_UNTIL18_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE18_END
+#define IMPL_SEQFOR_UNTIL18_B(m, s, f, d, ...) m(19, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL18_B_0(m, s, f, s(19, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL18_B_0(...) IMPL_SEQFOR_UNTIL18_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL18_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL18_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL18_B_1_0 IMPL_SEQFOR_UNTIL18_A
+#define IMPL_SEQFOR_UNTIL18_B_1_1 IMPL_SEQFOR_UNTIL18_STOP
+#define IMPL_SEQFOR_UNTIL18_STOP(m, s, f, d, e) f(19, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP18_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP18_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP18_A_ IMPL_SEQFOR_ZIP18_B
+#define IMPL_SEQFOR_ZIP18_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE18_END
+#define IMPL_SEQFOR_ZIP18_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE18_END
+#define IMPL_SEQFOR_ZIP18_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP18_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP18_B_0(...) IMPL_SEQFOR_ZIP18_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP18_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP18_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP18_B_1_0 IMPL_SEQFOR_ZIP18_C
+#define IMPL_SEQFOR_ZIP18_B_1_1(m, s, f, d, ...) f(19, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP18_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP18_C(m, s, f, d, r, ...) m(19, d, __VA_ARGS__) IMPL_SEQFOR_ZIP18_A(m, s, f, s(19, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE18_A(m, e) IMPL_SEQFOR_SIMPLE18_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE18_A_ IMPL_SEQFOR_SIMPLE18_B
+#define IMPL_SEQFOR_SIMPLE18_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE18_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE18_B(m, ...) m(19, __VA_ARGS__) IMPL_SEQFOR_SIMPLE18_A(m,
+#define IMPL_SEQFOR_MAP18_A(m, e) IMPL_SEQFOR_MAP18_A_##e(m,
+#define IMPL_SEQFOR_MAP18_A_ IMPL_SEQFOR_MAP18_B
+#define IMPL_SEQFOR_MAP18_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP18_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP18_B(m, ...) (m(19, __VA_ARGS__)) IMPL_SEQFOR_MAP18_A(m,
+#define IMPL_SEQFOR_FILTER18_A(p, e) IMPL_SEQFOR_FILTER18_A_##e(p,
+#define IMPL_SEQFOR_FILTER18_A_ IMPL_SEQFOR_FILTER18_B
+#define IMPL_SEQFOR_FILTER18_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER18_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER18_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(19, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER18_A(p,
+#define IMPL_SEQFOR_MAP_G18_A(m, e) IMPL_SEQFOR_MAP_G18_A_##e(m,
+#define IMPL_SEQFOR_MAP_G18_A_ IMPL_SEQFOR_MAP_G18_B
+#define IMPL_SEQFOR_MAP_G18_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G18_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G18_B(m, ...) )m(19, __VA_ARGS__)) IMPL_SEQFOR_MAP_G18_A(m,
+#define IMPL_SEQFOR_FILTER_G18_A(p, e) IMPL_SEQFOR_FILTER_G18_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G18_A_ IMPL_SEQFOR_FILTER_G18_B
+#define IMPL_SEQFOR_FILTER_G18_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G18_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G18_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(19, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G18_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL18(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE18_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP18(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL18(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE18_A_
+#undef IMPL_SEQFOR_FOR_GUIDE18_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE18_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST18_A_
+#undef IMPL_SEQFOR_FAST18_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST18_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL18_A_
+#undef IMPL_SEQFOR_UNTIL18_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL18_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL18_B_1_1
+#undef IMPL_SEQFOR_ZIP18_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP18_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP18_B_1_0
+#undef IMPL_SEQFOR_ZIP18_B_1_1
+#undef IMPL_SEQFOR_SIMPLE18_A_
+#undef IMPL_SEQFOR_SIMPLE18_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE18_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE18_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE18_B
+#define IMPL_SEQFOR_FOR_GUIDE18_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL18
+#define IMPL_SEQFOR_FOR_GUIDE18_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL18
+#define IMPL_SEQFOR_FAST18_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST18_B
+#define IMPL_SEQFOR_FAST18_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL18
+#define IMPL_SEQFOR_FAST18_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL18
+#define IMPL_SEQFOR_UNTIL18_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL18_B
+#define IMPL_SEQFOR_UNTIL18_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL18
+#define IMPL_SEQFOR_UNTIL18_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL18
+#define IMPL_SEQFOR_UNTIL18_B_1_1 IMPL_SEQFOR_TRACE_STOP18
+#define IMPL_SEQFOR_ZIP18_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL18
+#define IMPL_SEQFOR_ZIP18_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL18
+#define IMPL_SEQFOR_ZIP18_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP18_C
+#define IMPL_SEQFOR_ZIP18_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL18(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE18_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE18_B
+#define IMPL_SEQFOR_SIMPLE18_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE18_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
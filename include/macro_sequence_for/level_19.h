@@ -0,0 +1,113 @@
+// Nesting level 19 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH19(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH19, 20) IMPL_SEQFOR_IDENTITY19( IMPL_SEQFOR_FOR_GUIDE19_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE19(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE19, 20) IMPL_SEQFOR_IDENTITY19( IMPL_SEQFOR_SIMPLE19_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST19(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST19, 20) IMPL_SEQFOR_IDENTITY19( IMPL_SEQFOR_FAST19_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL19(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL19, 20) IMPL_SEQFOR_IDENTITY19( IMPL_SEQFOR_UNTIL19_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP19(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP19, 20) IMPL_SEQFOR_IDENTITY19( IMPL_SEQFOR_ZIP19_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS19(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS19, 20) IMPL_SEQFOR_IDENTITY19( IMPL_SEQFOR_FOR_GUIDE19_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP19(m, seq) IMPL_SEQFOR_IDENTITY19( IMPL_SEQFOR_MAP19_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER19(p, seq) IMPL_SEQFOR_IDENTITY19( IMPL_SEQFOR_FILTER19_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G19(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G19, 20) IMPL_SEQFOR_FOR_GUIDE19_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G19(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G19, 20) IMPL_SEQFOR_SIMPLE19_A(m, g) )
+#define SF_FOR_EACH_FAST_G19(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G19, 20) IMPL_SEQFOR_FAST19_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G19(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G19, 20) IMPL_SEQFOR_UNTIL19_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G19(m, g) IMPL_SEQFOR_MAP_G19_A(m, g) )
+#define SF_SEQ_FILTER_G19(p, g) IMPL_SEQFOR_FILTER_G19_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY19(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE19_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE19_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE19_A_ IMPL_SEQFOR_FOR_GUIDE19_B
+#define IMPL_SEQFOR_FOR_GUIDE19_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE19_END
+#define IMPL_SEQFOR_FOR_GUIDE19_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE19_END
+#define IMPL_SEQFOR_FOR_GUIDE19_END(m, s, f, d, ...) f(20, d)
+#define IMPL_SEQFOR_FOR_GUIDE19_B(m, s, f, d, ...) m(20, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE19_B_0(m, s, f, s(20, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE19_B_0(...) IMPL_SEQFOR_FOR_GUIDE19_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE19_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE19_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST19_A(m, s, f, d, e) IMPL_SEQFOR_FAST19_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST19_A_ IMPL_SEQFOR_FAST19_B
+#define IMPL_SEQFOR_FAST19_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE19_END
+#define IMPL_SEQFOR_FAST19_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE19_END
+#define IMPL_SEQFOR_FAST19_B(m, s, f, d, ...) m(20, d, __VA_ARGS__) IMPL_SEQFOR_FAST19_A(m, s, f, s(20, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL19_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL19_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL19_A_ IMPL_SEQFOR_UNTIL19_B
+#define IMPL_SEQFOR_UNTIL19_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE19_END
+#define IMPL_SEQFOR_UNTIL19_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE19_END
+#define IMPL_SEQFOR_UNTIL19_B(m, s, f, d, ...) m(20, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL19_B_0(m, s, f, s(20, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL19_B_0(...) IMPL_SEQFOR_UNTIL19_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL19_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL19_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL19_B_1_0 IMPL_SEQFOR_UNTIL19_A
+#define IMPL_SEQFOR_UNTIL19_B_1_1 IMPL_SEQFOR_UNTIL19_STOP
+#define IMPL_SEQFOR_UNTIL19_STOP(m, s, f, d, e) f(20, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP19_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP19_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP19_A_ IMPL_SEQFOR_ZIP19_B
+#define IMPL_SEQFOR_ZIP19_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE19_END
+#define IMPL_SEQFOR_ZIP19_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE19_END
+#define IMPL_SEQFOR_ZIP19_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP19_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP19_B_0(...) IMPL_SEQFOR_ZIP19_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP19_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP19_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP19_B_1_0 IMPL_SEQFOR_ZIP19_C
+#define IMPL_SEQFOR_ZIP19_B_1_1(m, s, f, d, ...) f(20, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP19_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP19_C(m, s, f, d, r, ...) m(20, d, __VA_ARGS__) IMPL_SEQFOR_ZIP19_A(m, s, f, s(20, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE19_A(m, e) IMPL_SEQFOR_SIMPLE19_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE19_A_ IMPL_SEQFOR_SIMPLE19_B
+#define IMPL_SEQFOR_SIMPLE19_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE19_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE19_B(m, ...) m(20, __VA_ARGS__) IMPL_SEQFOR_SIMPLE19_A(m,
+#define IMPL_SEQFOR_MAP19_A(m, e) IMPL_SEQFOR_MAP19_A_##e(m,
+#define IMPL_SEQFOR_MAP19_A_ IMPL_SEQFOR_MAP19_B
+#define IMPL_SEQFOR_MAP19_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP19_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP19_B(m, ...) (m(20, __VA_ARGS__)) IMPL_SEQFOR_MAP19_A(m,
+#define IMPL_SEQFOR_FILTER19_A(p, e) IMPL_SEQFOR_FILTER19_A_##e(p,
+#define IMPL_SEQFOR_FILTER19_A_ IMPL_SEQFOR_FILTER19_B
+#define IMPL_SEQFOR_FILTER19_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER19_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER19_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(20, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER19_A(p,
+#define IMPL_SEQFOR_MAP_G19_A(m, e) IMPL_SEQFOR_MAP_G19_A_##e(m,
+#define IMPL_SEQFOR_MAP_G19_A_ IMPL_SEQFOR_MAP_G19_B
+#define IMPL_SEQFOR_MAP_G19_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G19_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G19_B(m, ...) )m(20, __VA_ARGS__)) IMPL_SEQFOR_MAP_G19_A(m,
+#define IMPL_SEQFOR_FILTER_G19_A(p, e) IMPL_SEQFOR_FILTER_G19_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G19_A_ IMPL_SEQFOR_FILTER_G19_B
+#define IMPL_SEQFOR_FILTER_G19_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G19_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G19_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(20, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G19_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL19(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE19_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP19(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL19(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE19_A_
+#undef IMPL_SEQFOR_FOR_GUIDE19_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE19_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST19_A_
+#undef IMPL_SEQFOR_FAST19_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST19_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL19_A_
+#undef IMPL_SEQFOR_UNTIL19_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL19_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL19_B_1_1
+#undef IMPL_SEQFOR_ZIP19_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP19_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP19_B_1_0
+#undef IMPL_SEQFOR_ZIP19_B_1_1
+#undef IMPL_SEQFOR_SIMPLE19_A_
+#undef IMPL_SEQFOR_SIMPLE19_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE19_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE19_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE19_B
+#define IMPL_SEQFOR_FOR_GUIDE19_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL19
+#define IMPL_SEQFOR_FOR_GUIDE19_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL19
+#define IMPL_SEQFOR_FAST19_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST19_B
+#define IMPL_SEQFOR_FAST19_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL19
+#define IMPL_SEQFOR_FAST19_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL19
+#define IMPL_SEQFOR_UNTIL19_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL19_B
+#define IMPL_SEQFOR_UNTIL19_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL19
+#define IMPL_SEQFOR_UNTIL19_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL19
+#define IMPL_SEQFOR_UNTIL19_B_1_1 IMPL_SEQFOR_TRACE_STOP19
+#define IMPL_SEQFOR_ZIP19_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL19
+#define IMPL_SEQFOR_ZIP19_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL19
+#define IMPL_SEQFOR_ZIP19_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP19_C
+#define IMPL_SEQFOR_ZIP19_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL19(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE19_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE19_B
+#define IMPL_SEQFOR_SIMPLE19_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE19_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 2 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH2(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH2, 3) IMPL_SEQFOR_IDENTITY2( IMPL_SEQFOR_FOR_GUIDE2_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE2(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE2, 3) IMPL_SEQFOR_IDENTITY2( IMPL_SEQFOR_SIMPLE2_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST2(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST2, 3) IMPL_SEQFOR_IDENTITY2( IMPL_SEQFOR_FAST2_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL2(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL2, 3) IMPL_SEQFOR_IDENTITY2( IMPL_SEQFOR_UNTIL2_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP2(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP2, 3) IMPL_SEQFOR_IDENTITY2( IMPL_SEQFOR_ZIP2_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS2(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS2, 3) IMPL_SEQFOR_IDENTITY2( IMPL_SEQFOR_FOR_GUIDE2_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP2(m, seq) IMPL_SEQFOR_IDENTITY2( IMPL_SEQFOR_MAP2_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER2(p, seq) IMPL_SEQFOR_IDENTITY2( IMPL_SEQFOR_FILTER2_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G2(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G2, 3) IMPL_SEQFOR_FOR_GUIDE2_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G2(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G2, 3) IMPL_SEQFOR_SIMPLE2_A(m, g) )
+#define SF_FOR_EACH_FAST_G2(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G2, 3) IMPL_SEQFOR_FAST2_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G2(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G2, 3) IMPL_SEQFOR_UNTIL2_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G2(m, g) IMPL_SEQFOR_MAP_G2_A(m, g) )
+#define SF_SEQ_FILTER_G2(p, g) IMPL_SEQFOR_FILTER_G2_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY2(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE2_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE2_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE2_A_ IMPL_SEQFOR_FOR_GUIDE2_B
+#define IMPL_SEQFOR_FOR_GUIDE2_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE2_END
+#define IMPL_SEQFOR_FOR_GUIDE2_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE2_END
+#define IMPL_SEQFOR_FOR_GUIDE2_END(m, s, f, d, ...) f(3, d)
+#define IMPL_SEQFOR_FOR_GUIDE2_B(m, s, f, d, ...) m(3, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE2_B_0(m, s, f, s(3, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE2_B_0(...) IMPL_SEQFOR_FOR_GUIDE2_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE2_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE2_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST2_A(m, s, f, d, e) IMPL_SEQFOR_FAST2_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST2_A_ IMPL_SEQFOR_FAST2_B
+#define IMPL_SEQFOR_FAST2_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE2_END
+#define IMPL_SEQFOR_FAST2_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE2_END
+#define IMPL_SEQFOR_FAST2_B(m, s, f, d, ...) m(3, d, __VA_ARGS__) IMPL_SEQFOR_FAST2_A(m, s, f, s(3, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL2_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL2_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL2_A_ IMPL_SEQFOR_UNTIL2_B
+#define IMPL_SEQFOR_UNTIL2_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE2_END
+#define IMPL_SEQFOR_UNTIL2_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE2_END
+#define IMPL_SEQFOR_UNTIL2_B(m, s, f, d, ...) m(3, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL2_B_0(m, s, f, s(3, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL2_B_0(...) IMPL_SEQFOR_UNTIL2_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL2_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL2_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL2_B_1_0 IMPL_SEQFOR_UNTIL2_A
+#define IMPL_SEQFOR_UNTIL2_B_1_1 IMPL_SEQFOR_UNTIL2_STOP
+#define IMPL_SEQFOR_UNTIL2_STOP(m, s, f, d, e) f(3, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP2_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP2_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP2_A_ IMPL_SEQFOR_ZIP2_B
+#define IMPL_SEQFOR_ZIP2_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE2_END
+#define IMPL_SEQFOR_ZIP2_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE2_END
+#define IMPL_SEQFOR_ZIP2_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP2_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP2_B_0(...) IMPL_SEQFOR_ZIP2_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP2_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP2_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP2_B_1_0 IMPL_SEQFOR_ZIP2_C
+#define IMPL_SEQFOR_ZIP2_B_1_1(m, s, f, d, ...) f(3, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP2_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP2_C(m, s, f, d, r, ...) m(3, d, __VA_ARGS__) IMPL_SEQFOR_ZIP2_A(m, s, f, s(3, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE2_A(m, e) IMPL_SEQFOR_SIMPLE2_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE2_A_ IMPL_SEQFOR_SIMPLE2_B
+#define IMPL_SEQFOR_SIMPLE2_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE2_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE2_B(m, ...) m(3, __VA_ARGS__) IMPL_SEQFOR_SIMPLE2_A(m,
+#define IMPL_SEQFOR_MAP2_A(m, e) IMPL_SEQFOR_MAP2_A_##e(m,
+#define IMPL_SEQFOR_MAP2_A_ IMPL_SEQFOR_MAP2_B
+#define IMPL_SEQFOR_MAP2_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP2_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP2_B(m, ...) (m(3, __VA_ARGS__)) IMPL_SEQFOR_MAP2_A(m,
+#define IMPL_SEQFOR_FILTER2_A(p, e) IMPL_SEQFOR_FILTER2_A_##e(p,
+#define IMPL_SEQFOR_FILTER2_A_ IMPL_SEQFOR_FILTER2_B
+#define IMPL_SEQFOR_FILTER2_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER2_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER2_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(3, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER2_A(p,
+#define IMPL_SEQFOR_MAP_G2_A(m, e) IMPL_SEQFOR_MAP_G2_A_##e(m,
+#define IMPL_SEQFOR_MAP_G2_A_ IMPL_SEQFOR_MAP_G2_B
+#define IMPL_SEQFOR_MAP_G2_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G2_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G2_B(m, ...) )m(3, __VA_ARGS__)) IMPL_SEQFOR_MAP_G2_A(m,
+#define IMPL_SEQFOR_FILTER_G2_A(p, e) IMPL_SEQFOR_FILTER_G2_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G2_A_ IMPL_SEQFOR_FILTER_G2_B
+#define IMPL_SEQFOR_FILTER_G2_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G2_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G2_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(3, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G2_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL2(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE2_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP2(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL2(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE2_A_
+#undef IMPL_SEQFOR_FOR_GUIDE2_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE2_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST2_A_
+#undef IMPL_SEQFOR_FAST2_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST2_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL2_A_
+#undef IMPL_SEQFOR_UNTIL2_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL2_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL2_B_1_1
+#undef IMPL_SEQFOR_ZIP2_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP2_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP2_B_1_0
+#undef IMPL_SEQFOR_ZIP2_B_1_1
+#undef IMPL_SEQFOR_SIMPLE2_A_
+#undef IMPL_SEQFOR_SIMPLE2_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE2_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE2_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE2_B
+#define IMPL_SEQFOR_FOR_GUIDE2_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL2
+#define IMPL_SEQFOR_FOR_GUIDE2_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL2
+#define IMPL_SEQFOR_FAST2_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST2_B
+#define IMPL_SEQFOR_FAST2_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL2
+#define IMPL_SEQFOR_FAST2_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL2
+#define IMPL_SEQFOR_UNTIL2_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL2_B
+#define IMPL_SEQFOR_UNTIL2_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL2
+#define IMPL_SEQFOR_UNTIL2_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL2
+#define IMPL_SEQFOR_UNTIL2_B_1_1 IMPL_SEQFOR_TRACE_STOP2
+#define IMPL_SEQFOR_ZIP2_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL2
+#define IMPL_SEQFOR_ZIP2_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL2
+#define IMPL_SEQFOR_ZIP2_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP2_C
+#define IMPL_SEQFOR_ZIP2_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL2(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE2_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE2_B
+#define IMPL_SEQFOR_SIMPLE2_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE2_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
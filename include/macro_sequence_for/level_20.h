@@ -0,0 +1,113 @@
+// Nesting level 20 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH20(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH20, 21) IMPL_SEQFOR_IDENTITY20( IMPL_SEQFOR_FOR_GUIDE20_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE20(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE20, 21) IMPL_SEQFOR_IDENTITY20( IMPL_SEQFOR_SIMPLE20_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST20(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST20, 21) IMPL_SEQFOR_IDENTITY20( IMPL_SEQFOR_FAST20_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL20(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL20, 21) IMPL_SEQFOR_IDENTITY20( IMPL_SEQFOR_UNTIL20_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP20(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP20, 21) IMPL_SEQFOR_IDENTITY20( IMPL_SEQFOR_ZIP20_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS20(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS20, 21) IMPL_SEQFOR_IDENTITY20( IMPL_SEQFOR_FOR_GUIDE20_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP20(m, seq) IMPL_SEQFOR_IDENTITY20( IMPL_SEQFOR_MAP20_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER20(p, seq) IMPL_SEQFOR_IDENTITY20( IMPL_SEQFOR_FILTER20_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G20(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G20, 21) IMPL_SEQFOR_FOR_GUIDE20_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G20(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G20, 21) IMPL_SEQFOR_SIMPLE20_A(m, g) )
+#define SF_FOR_EACH_FAST_G20(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G20, 21) IMPL_SEQFOR_FAST20_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G20(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G20, 21) IMPL_SEQFOR_UNTIL20_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G20(m, g) IMPL_SEQFOR_MAP_G20_A(m, g) )
+#define SF_SEQ_FILTER_G20(p, g) IMPL_SEQFOR_FILTER_G20_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY20(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE20_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE20_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE20_A_ IMPL_SEQFOR_FOR_GUIDE20_B
+#define IMPL_SEQFOR_FOR_GUIDE20_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE20_END
+#define IMPL_SEQFOR_FOR_GUIDE20_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE20_END
+#define IMPL_SEQFOR_FOR_GUIDE20_END(m, s, f, d, ...) f(21, d)
+#define IMPL_SEQFOR_FOR_GUIDE20_B(m, s, f, d, ...) m(21, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE20_B_0(m, s, f, s(21, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE20_B_0(...) IMPL_SEQFOR_FOR_GUIDE20_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE20_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE20_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST20_A(m, s, f, d, e) IMPL_SEQFOR_FAST20_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST20_A_ IMPL_SEQFOR_FAST20_B
+#define IMPL_SEQFOR_FAST20_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE20_END
+#define IMPL_SEQFOR_FAST20_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE20_END
+#define IMPL_SEQFOR_FAST20_B(m, s, f, d, ...) m(21, d, __VA_ARGS__) IMPL_SEQFOR_FAST20_A(m, s, f, s(21, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL20_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL20_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL20_A_ IMPL_SEQFOR_UNTIL20_B
+#define IMPL_SEQFOR_UNTIL20_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE20_END
+#define IMPL_SEQFOR_UNTIL20_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE20_END
+#define IMPL_SEQFOR_UNTIL20_B(m, s, f, d, ...) m(21, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL20_B_0(m, s, f, s(21, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL20_B_0(...) IMPL_SEQFOR_UNTIL20_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL20_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL20_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL20_B_1_0 IMPL_SEQFOR_UNTIL20_A
+#define IMPL_SEQFOR_UNTIL20_B_1_1 IMPL_SEQFOR_UNTIL20_STOP
+#define IMPL_SEQFOR_UNTIL20_STOP(m, s, f, d, e) f(21, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP20_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP20_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP20_A_ IMPL_SEQFOR_ZIP20_B
+#define IMPL_SEQFOR_ZIP20_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE20_END
+#define IMPL_SEQFOR_ZIP20_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE20_END
+#define IMPL_SEQFOR_ZIP20_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP20_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP20_B_0(...) IMPL_SEQFOR_ZIP20_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP20_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP20_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP20_B_1_0 IMPL_SEQFOR_ZIP20_C
+#define IMPL_SEQFOR_ZIP20_B_1_1(m, s, f, d, ...) f(21, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP20_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP20_C(m, s, f, d, r, ...) m(21, d, __VA_ARGS__) IMPL_SEQFOR_ZIP20_A(m, s, f, s(21, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE20_A(m, e) IMPL_SEQFOR_SIMPLE20_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE20_A_ IMPL_SEQFOR_SIMPLE20_B
+#define IMPL_SEQFOR_SIMPLE20_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE20_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE20_B(m, ...) m(21, __VA_ARGS__) IMPL_SEQFOR_SIMPLE20_A(m,
+#define IMPL_SEQFOR_MAP20_A(m, e) IMPL_SEQFOR_MAP20_A_##e(m,
+#define IMPL_SEQFOR_MAP20_A_ IMPL_SEQFOR_MAP20_B
+#define IMPL_SEQFOR_MAP20_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP20_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP20_B(m, ...) (m(21, __VA_ARGS__)) IMPL_SEQFOR_MAP20_A(m,
+#define IMPL_SEQFOR_FILTER20_A(p, e) IMPL_SEQFOR_FILTER20_A_##e(p,
+#define IMPL_SEQFOR_FILTER20_A_ IMPL_SEQFOR_FILTER20_B
+#define IMPL_SEQFOR_FILTER20_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER20_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER20_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(21, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER20_A(p,
+#define IMPL_SEQFOR_MAP_G20_A(m, e) IMPL_SEQFOR_MAP_G20_A_##e(m,
+#define IMPL_SEQFOR_MAP_G20_A_ IMPL_SEQFOR_MAP_G20_B
+#define IMPL_SEQFOR_MAP_G20_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G20_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G20_B(m, ...) )m(21, __VA_ARGS__)) IMPL_SEQFOR_MAP_G20_A(m,
+#define IMPL_SEQFOR_FILTER_G20_A(p, e) IMPL_SEQFOR_FILTER_G20_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G20_A_ IMPL_SEQFOR_FILTER_G20_B
+#define IMPL_SEQFOR_FILTER_G20_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G20_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G20_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(21, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G20_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL20(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE20_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP20(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL20(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE20_A_
+#undef IMPL_SEQFOR_FOR_GUIDE20_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE20_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST20_A_
+#undef IMPL_SEQFOR_FAST20_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST20_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL20_A_
+#undef IMPL_SEQFOR_UNTIL20_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL20_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL20_B_1_1
+#undef IMPL_SEQFOR_ZIP20_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP20_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP20_B_1_0
+#undef IMPL_SEQFOR_ZIP20_B_1_1
+#undef IMPL_SEQFOR_SIMPLE20_A_
+#undef IMPL_SEQFOR_SIMPLE20_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE20_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE20_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE20_B
+#define IMPL_SEQFOR_FOR_GUIDE20_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL20
+#define IMPL_SEQFOR_FOR_GUIDE20_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL20
+#define IMPL_SEQFOR_FAST20_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST20_B
+#define IMPL_SEQFOR_FAST20_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL20
+#define IMPL_SEQFOR_FAST20_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL20
+#define IMPL_SEQFOR_UNTIL20_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL20_B
+#define IMPL_SEQFOR_UNTIL20_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL20
+#define IMPL_SEQFOR_UNTIL20_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL20
+#define IMPL_SEQFOR_UNTIL20_B_1_1 IMPL_SEQFOR_TRACE_STOP20
+#define IMPL_SEQFOR_ZIP20_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL20
+#define IMPL_SEQFOR_ZIP20_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL20
+#define IMPL_SEQFOR_ZIP20_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP20_C
+#define IMPL_SEQFOR_ZIP20_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL20(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE20_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE20_B
+#define IMPL_SEQFOR_SIMPLE20_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE20_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
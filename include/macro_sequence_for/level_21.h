@@ -0,0 +1,113 @@
+// Nesting level 21 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH21(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH21, 22) IMPL_SEQFOR_IDENTITY21( IMPL_SEQFOR_FOR_GUIDE21_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE21(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE21, 22) IMPL_SEQFOR_IDENTITY21( IMPL_SEQFOR_SIMPLE21_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST21(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST21, 22) IMPL_SEQFOR_IDENTITY21( IMPL_SEQFOR_FAST21_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL21(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL21, 22) IMPL_SEQFOR_IDENTITY21( IMPL_SEQFOR_UNTIL21_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP21(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP21, 22) IMPL_SEQFOR_IDENTITY21( IMPL_SEQFOR_ZIP21_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS21(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS21, 22) IMPL_SEQFOR_IDENTITY21( IMPL_SEQFOR_FOR_GUIDE21_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP21(m, seq) IMPL_SEQFOR_IDENTITY21( IMPL_SEQFOR_MAP21_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER21(p, seq) IMPL_SEQFOR_IDENTITY21( IMPL_SEQFOR_FILTER21_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G21(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G21, 22) IMPL_SEQFOR_FOR_GUIDE21_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G21(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G21, 22) IMPL_SEQFOR_SIMPLE21_A(m, g) )
+#define SF_FOR_EACH_FAST_G21(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G21, 22) IMPL_SEQFOR_FAST21_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G21(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G21, 22) IMPL_SEQFOR_UNTIL21_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G21(m, g) IMPL_SEQFOR_MAP_G21_A(m, g) )
+#define SF_SEQ_FILTER_G21(p, g) IMPL_SEQFOR_FILTER_G21_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY21(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE21_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE21_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE21_A_ IMPL_SEQFOR_FOR_GUIDE21_B
+#define IMPL_SEQFOR_FOR_GUIDE21_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE21_END
+#define IMPL_SEQFOR_FOR_GUIDE21_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE21_END
+#define IMPL_SEQFOR_FOR_GUIDE21_END(m, s, f, d, ...) f(22, d)
+#define IMPL_SEQFOR_FOR_GUIDE21_B(m, s, f, d, ...) m(22, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE21_B_0(m, s, f, s(22, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE21_B_0(...) IMPL_SEQFOR_FOR_GUIDE21_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE21_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE21_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST21_A(m, s, f, d, e) IMPL_SEQFOR_FAST21_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST21_A_ IMPL_SEQFOR_FAST21_B
+#define IMPL_SEQFOR_FAST21_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE21_END
+#define IMPL_SEQFOR_FAST21_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE21_END
+#define IMPL_SEQFOR_FAST21_B(m, s, f, d, ...) m(22, d, __VA_ARGS__) IMPL_SEQFOR_FAST21_A(m, s, f, s(22, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL21_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL21_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL21_A_ IMPL_SEQFOR_UNTIL21_B
+#define IMPL_SEQFOR_UNTIL21_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE21_END
+#define IMPL_SEQFOR_UNTIL21_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE21_END
+#define IMPL_SEQFOR_UNTIL21_B(m, s, f, d, ...) m(22, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL21_B_0(m, s, f, s(22, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL21_B_0(...) IMPL_SEQFOR_UNTIL21_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL21_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL21_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL21_B_1_0 IMPL_SEQFOR_UNTIL21_A
+#define IMPL_SEQFOR_UNTIL21_B_1_1 IMPL_SEQFOR_UNTIL21_STOP
+#define IMPL_SEQFOR_UNTIL21_STOP(m, s, f, d, e) f(22, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP21_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP21_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP21_A_ IMPL_SEQFOR_ZIP21_B
+#define IMPL_SEQFOR_ZIP21_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE21_END
+#define IMPL_SEQFOR_ZIP21_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE21_END
+#define IMPL_SEQFOR_ZIP21_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP21_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP21_B_0(...) IMPL_SEQFOR_ZIP21_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP21_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP21_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP21_B_1_0 IMPL_SEQFOR_ZIP21_C
+#define IMPL_SEQFOR_ZIP21_B_1_1(m, s, f, d, ...) f(22, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP21_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP21_C(m, s, f, d, r, ...) m(22, d, __VA_ARGS__) IMPL_SEQFOR_ZIP21_A(m, s, f, s(22, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE21_A(m, e) IMPL_SEQFOR_SIMPLE21_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE21_A_ IMPL_SEQFOR_SIMPLE21_B
+#define IMPL_SEQFOR_SIMPLE21_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE21_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE21_B(m, ...) m(22, __VA_ARGS__) IMPL_SEQFOR_SIMPLE21_A(m,
+#define IMPL_SEQFOR_MAP21_A(m, e) IMPL_SEQFOR_MAP21_A_##e(m,
+#define IMPL_SEQFOR_MAP21_A_ IMPL_SEQFOR_MAP21_B
+#define IMPL_SEQFOR_MAP21_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP21_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP21_B(m, ...) (m(22, __VA_ARGS__)) IMPL_SEQFOR_MAP21_A(m,
+#define IMPL_SEQFOR_FILTER21_A(p, e) IMPL_SEQFOR_FILTER21_A_##e(p,
+#define IMPL_SEQFOR_FILTER21_A_ IMPL_SEQFOR_FILTER21_B
+#define IMPL_SEQFOR_FILTER21_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER21_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER21_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(22, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER21_A(p,
+#define IMPL_SEQFOR_MAP_G21_A(m, e) IMPL_SEQFOR_MAP_G21_A_##e(m,
+#define IMPL_SEQFOR_MAP_G21_A_ IMPL_SEQFOR_MAP_G21_B
+#define IMPL_SEQFOR_MAP_G21_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G21_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G21_B(m, ...) )m(22, __VA_ARGS__)) IMPL_SEQFOR_MAP_G21_A(m,
+#define IMPL_SEQFOR_FILTER_G21_A(p, e) IMPL_SEQFOR_FILTER_G21_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G21_A_ IMPL_SEQFOR_FILTER_G21_B
+#define IMPL_SEQFOR_FILTER_G21_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G21_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G21_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(22, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G21_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL21(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE21_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP21(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL21(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE21_A_
+#undef IMPL_SEQFOR_FOR_GUIDE21_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE21_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST21_A_
+#undef IMPL_SEQFOR_FAST21_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST21_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL21_A_
+#undef IMPL_SEQFOR_UNTIL21_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL21_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL21_B_1_1
+#undef IMPL_SEQFOR_ZIP21_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP21_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP21_B_1_0
+#undef IMPL_SEQFOR_ZIP21_B_1_1
+#undef IMPL_SEQFOR_SIMPLE21_A_
+#undef IMPL_SEQFOR_SIMPLE21_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE21_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE21_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE21_B
+#define IMPL_SEQFOR_FOR_GUIDE21_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL21
+#define IMPL_SEQFOR_FOR_GUIDE21_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL21
+#define IMPL_SEQFOR_FAST21_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST21_B
+#define IMPL_SEQFOR_FAST21_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL21
+#define IMPL_SEQFOR_FAST21_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL21
+#define IMPL_SEQFOR_UNTIL21_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL21_B
+#define IMPL_SEQFOR_UNTIL21_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL21
+#define IMPL_SEQFOR_UNTIL21_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL21
+#define IMPL_SEQFOR_UNTIL21_B_1_1 IMPL_SEQFOR_TRACE_STOP21
+#define IMPL_SEQFOR_ZIP21_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL21
+#define IMPL_SEQFOR_ZIP21_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL21
+#define IMPL_SEQFOR_ZIP21_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP21_C
+#define IMPL_SEQFOR_ZIP21_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL21(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE21_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE21_B
+#define IMPL_SEQFOR_SIMPLE21_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE21_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 22 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH22(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH22, 23) IMPL_SEQFOR_IDENTITY22( IMPL_SEQFOR_FOR_GUIDE22_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE22(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE22, 23) IMPL_SEQFOR_IDENTITY22( IMPL_SEQFOR_SIMPLE22_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST22(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST22, 23) IMPL_SEQFOR_IDENTITY22( IMPL_SEQFOR_FAST22_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL22(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL22, 23) IMPL_SEQFOR_IDENTITY22( IMPL_SEQFOR_UNTIL22_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP22(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP22, 23) IMPL_SEQFOR_IDENTITY22( IMPL_SEQFOR_ZIP22_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS22(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS22, 23) IMPL_SEQFOR_IDENTITY22( IMPL_SEQFOR_FOR_GUIDE22_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP22(m, seq) IMPL_SEQFOR_IDENTITY22( IMPL_SEQFOR_MAP22_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER22(p, seq) IMPL_SEQFOR_IDENTITY22( IMPL_SEQFOR_FILTER22_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G22(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G22, 23) IMPL_SEQFOR_FOR_GUIDE22_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G22(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G22, 23) IMPL_SEQFOR_SIMPLE22_A(m, g) )
+#define SF_FOR_EACH_FAST_G22(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G22, 23) IMPL_SEQFOR_FAST22_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G22(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G22, 23) IMPL_SEQFOR_UNTIL22_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G22(m, g) IMPL_SEQFOR_MAP_G22_A(m, g) )
+#define SF_SEQ_FILTER_G22(p, g) IMPL_SEQFOR_FILTER_G22_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY22(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE22_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE22_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE22_A_ IMPL_SEQFOR_FOR_GUIDE22_B
+#define IMPL_SEQFOR_FOR_GUIDE22_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE22_END
+#define IMPL_SEQFOR_FOR_GUIDE22_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE22_END
+#define IMPL_SEQFOR_FOR_GUIDE22_END(m, s, f, d, ...) f(23, d)
+#define IMPL_SEQFOR_FOR_GUIDE22_B(m, s, f, d, ...) m(23, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE22_B_0(m, s, f, s(23, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE22_B_0(...) IMPL_SEQFOR_FOR_GUIDE22_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE22_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE22_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST22_A(m, s, f, d, e) IMPL_SEQFOR_FAST22_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST22_A_ IMPL_SEQFOR_FAST22_B
+#define IMPL_SEQFOR_FAST22_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE22_END
+#define IMPL_SEQFOR_FAST22_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE22_END
+#define IMPL_SEQFOR_FAST22_B(m, s, f, d, ...) m(23, d, __VA_ARGS__) IMPL_SEQFOR_FAST22_A(m, s, f, s(23, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL22_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL22_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL22_A_ IMPL_SEQFOR_UNTIL22_B
+#define IMPL_SEQFOR_UNTIL22_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE22_END
+#define IMPL_SEQFOR_UNTIL22_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE22_END
+#define IMPL_SEQFOR_UNTIL22_B(m, s, f, d, ...) m(23, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL22_B_0(m, s, f, s(23, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL22_B_0(...) IMPL_SEQFOR_UNTIL22_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL22_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL22_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL22_B_1_0 IMPL_SEQFOR_UNTIL22_A
+#define IMPL_SEQFOR_UNTIL22_B_1_1 IMPL_SEQFOR_UNTIL22_STOP
+#define IMPL_SEQFOR_UNTIL22_STOP(m, s, f, d, e) f(23, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP22_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP22_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP22_A_ IMPL_SEQFOR_ZIP22_B
+#define IMPL_SEQFOR_ZIP22_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE22_END
+#define IMPL_SEQFOR_ZIP22_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE22_END
+#define IMPL_SEQFOR_ZIP22_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP22_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP22_B_0(...) IMPL_SEQFOR_ZIP22_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP22_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP22_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP22_B_1_0 IMPL_SEQFOR_ZIP22_C
+#define IMPL_SEQFOR_ZIP22_B_1_1(m, s, f, d, ...) f(23, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP22_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP22_C(m, s, f, d, r, ...) m(23, d, __VA_ARGS__) IMPL_SEQFOR_ZIP22_A(m, s, f, s(23, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE22_A(m, e) IMPL_SEQFOR_SIMPLE22_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE22_A_ IMPL_SEQFOR_SIMPLE22_B
+#define IMPL_SEQFOR_SIMPLE22_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE22_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE22_B(m, ...) m(23, __VA_ARGS__) IMPL_SEQFOR_SIMPLE22_A(m,
+#define IMPL_SEQFOR_MAP22_A(m, e) IMPL_SEQFOR_MAP22_A_##e(m,
+#define IMPL_SEQFOR_MAP22_A_ IMPL_SEQFOR_MAP22_B
+#define IMPL_SEQFOR_MAP22_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP22_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP22_B(m, ...) (m(23, __VA_ARGS__)) IMPL_SEQFOR_MAP22_A(m,
+#define IMPL_SEQFOR_FILTER22_A(p, e) IMPL_SEQFOR_FILTER22_A_##e(p,
+#define IMPL_SEQFOR_FILTER22_A_ IMPL_SEQFOR_FILTER22_B
+#define IMPL_SEQFOR_FILTER22_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER22_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER22_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(23, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER22_A(p,
+#define IMPL_SEQFOR_MAP_G22_A(m, e) IMPL_SEQFOR_MAP_G22_A_##e(m,
+#define IMPL_SEQFOR_MAP_G22_A_ IMPL_SEQFOR_MAP_G22_B
+#define IMPL_SEQFOR_MAP_G22_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G22_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G22_B(m, ...) )m(23, __VA_ARGS__)) IMPL_SEQFOR_MAP_G22_A(m,
+#define IMPL_SEQFOR_FILTER_G22_A(p, e) IMPL_SEQFOR_FILTER_G22_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G22_A_ IMPL_SEQFOR_FILTER_G22_B
+#define IMPL_SEQFOR_FILTER_G22_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G22_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G22_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(23, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G22_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL22(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE22_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP22(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL22(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE22_A_
+#undef IMPL_SEQFOR_FOR_GUIDE22_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE22_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST22_A_
+#undef IMPL_SEQFOR_FAST22_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST22_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL22_A_
+#undef IMPL_SEQFOR_UNTIL22_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL22_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL22_B_1_1
+#undef IMPL_SEQFOR_ZIP22_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP22_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP22_B_1_0
+#undef IMPL_SEQFOR_ZIP22_B_1_1
+#undef IMPL_SEQFOR_SIMPLE22_A_
+#undef IMPL_SEQFOR_SIMPLE22_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE22_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE22_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE22_B
+#define IMPL_SEQFOR_FOR_GUIDE22_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL22
+#define IMPL_SEQFOR_FOR_GUIDE22_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL22
+#define IMPL_SEQFOR_FAST22_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST22_B
+#define IMPL_SEQFOR_FAST22_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL22
+#define IMPL_SEQFOR_FAST22_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL22
+#define IMPL_SEQFOR_UNTIL22_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL22_B
+#define IMPL_SEQFOR_UNTIL22_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL22
+#define IMPL_SEQFOR_UNTIL22_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL22
+#define IMPL_SEQFOR_UNTIL22_B_1_1 IMPL_SEQFOR_TRACE_STOP22
+#define IMPL_SEQFOR_ZIP22_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL22
+#define IMPL_SEQFOR_ZIP22_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL22
+#define IMPL_SEQFOR_ZIP22_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP22_C
+#define IMPL_SEQFOR_ZIP22_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL22(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE22_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE22_B
+#define IMPL_SEQFOR_SIMPLE22_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE22_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
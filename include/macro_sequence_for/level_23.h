@@ -0,0 +1,113 @@
+// Nesting level 23 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH23(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH23, 24) IMPL_SEQFOR_IDENTITY23( IMPL_SEQFOR_FOR_GUIDE23_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE23(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE23, 24) IMPL_SEQFOR_IDENTITY23( IMPL_SEQFOR_SIMPLE23_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST23(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST23, 24) IMPL_SEQFOR_IDENTITY23( IMPL_SEQFOR_FAST23_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL23(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL23, 24) IMPL_SEQFOR_IDENTITY23( IMPL_SEQFOR_UNTIL23_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP23(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP23, 24) IMPL_SEQFOR_IDENTITY23( IMPL_SEQFOR_ZIP23_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS23(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS23, 24) IMPL_SEQFOR_IDENTITY23( IMPL_SEQFOR_FOR_GUIDE23_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP23(m, seq) IMPL_SEQFOR_IDENTITY23( IMPL_SEQFOR_MAP23_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER23(p, seq) IMPL_SEQFOR_IDENTITY23( IMPL_SEQFOR_FILTER23_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G23(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G23, 24) IMPL_SEQFOR_FOR_GUIDE23_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G23(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G23, 24) IMPL_SEQFOR_SIMPLE23_A(m, g) )
+#define SF_FOR_EACH_FAST_G23(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G23, 24) IMPL_SEQFOR_FAST23_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G23(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G23, 24) IMPL_SEQFOR_UNTIL23_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G23(m, g) IMPL_SEQFOR_MAP_G23_A(m, g) )
+#define SF_SEQ_FILTER_G23(p, g) IMPL_SEQFOR_FILTER_G23_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY23(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE23_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE23_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE23_A_ IMPL_SEQFOR_FOR_GUIDE23_B
+#define IMPL_SEQFOR_FOR_GUIDE23_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE23_END
+#define IMPL_SEQFOR_FOR_GUIDE23_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE23_END
+#define IMPL_SEQFOR_FOR_GUIDE23_END(m, s, f, d, ...) f(24, d)
+#define IMPL_SEQFOR_FOR_GUIDE23_B(m, s, f, d, ...) m(24, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE23_B_0(m, s, f, s(24, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE23_B_0(...) IMPL_SEQFOR_FOR_GUIDE23_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE23_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE23_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST23_A(m, s, f, d, e) IMPL_SEQFOR_FAST23_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST23_A_ IMPL_SEQFOR_FAST23_B
+#define IMPL_SEQFOR_FAST23_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE23_END
+#define IMPL_SEQFOR_FAST23_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE23_END
+#define IMPL_SEQFOR_FAST23_B(m, s, f, d, ...) m(24, d, __VA_ARGS__) IMPL_SEQFOR_FAST23_A(m, s, f, s(24, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL23_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL23_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL23_A_ IMPL_SEQFOR_UNTIL23_B
+#define IMPL_SEQFOR_UNTIL23_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE23_END
+#define IMPL_SEQFOR_UNTIL23_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE23_END
+#define IMPL_SEQFOR_UNTIL23_B(m, s, f, d, ...) m(24, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL23_B_0(m, s, f, s(24, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL23_B_0(...) IMPL_SEQFOR_UNTIL23_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL23_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL23_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL23_B_1_0 IMPL_SEQFOR_UNTIL23_A
+#define IMPL_SEQFOR_UNTIL23_B_1_1 IMPL_SEQFOR_UNTIL23_STOP
+#define IMPL_SEQFOR_UNTIL23_STOP(m, s, f, d, e) f(24, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP23_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP23_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP23_A_ IMPL_SEQFOR_ZIP23_B
+#define IMPL_SEQFOR_ZIP23_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE23_END
+#define IMPL_SEQFOR_ZIP23_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE23_END
+#define IMPL_SEQFOR_ZIP23_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP23_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP23_B_0(...) IMPL_SEQFOR_ZIP23_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP23_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP23_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP23_B_1_0 IMPL_SEQFOR_ZIP23_C
+#define IMPL_SEQFOR_ZIP23_B_1_1(m, s, f, d, ...) f(24, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP23_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP23_C(m, s, f, d, r, ...) m(24, d, __VA_ARGS__) IMPL_SEQFOR_ZIP23_A(m, s, f, s(24, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE23_A(m, e) IMPL_SEQFOR_SIMPLE23_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE23_A_ IMPL_SEQFOR_SIMPLE23_B
+#define IMPL_SEQFOR_SIMPLE23_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE23_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE23_B(m, ...) m(24, __VA_ARGS__) IMPL_SEQFOR_SIMPLE23_A(m,
+#define IMPL_SEQFOR_MAP23_A(m, e) IMPL_SEQFOR_MAP23_A_##e(m,
+#define IMPL_SEQFOR_MAP23_A_ IMPL_SEQFOR_MAP23_B
+#define IMPL_SEQFOR_MAP23_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP23_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP23_B(m, ...) (m(24, __VA_ARGS__)) IMPL_SEQFOR_MAP23_A(m,
+#define IMPL_SEQFOR_FILTER23_A(p, e) IMPL_SEQFOR_FILTER23_A_##e(p,
+#define IMPL_SEQFOR_FILTER23_A_ IMPL_SEQFOR_FILTER23_B
+#define IMPL_SEQFOR_FILTER23_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER23_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER23_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(24, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER23_A(p,
+#define IMPL_SEQFOR_MAP_G23_A(m, e) IMPL_SEQFOR_MAP_G23_A_##e(m,
+#define IMPL_SEQFOR_MAP_G23_A_ IMPL_SEQFOR_MAP_G23_B
+#define IMPL_SEQFOR_MAP_G23_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G23_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G23_B(m, ...) )m(24, __VA_ARGS__)) IMPL_SEQFOR_MAP_G23_A(m,
+#define IMPL_SEQFOR_FILTER_G23_A(p, e) IMPL_SEQFOR_FILTER_G23_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G23_A_ IMPL_SEQFOR_FILTER_G23_B
+#define IMPL_SEQFOR_FILTER_G23_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G23_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G23_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(24, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G23_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL23(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE23_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP23(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL23(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE23_A_
+#undef IMPL_SEQFOR_FOR_GUIDE23_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE23_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST23_A_
+#undef IMPL_SEQFOR_FAST23_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST23_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL23_A_
+#undef IMPL_SEQFOR_UNTIL23_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL23_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL23_B_1_1
+#undef IMPL_SEQFOR_ZIP23_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP23_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP23_B_1_0
+#undef IMPL_SEQFOR_ZIP23_B_1_1
+#undef IMPL_SEQFOR_SIMPLE23_A_
+#undef IMPL_SEQFOR_SIMPLE23_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE23_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE23_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE23_B
+#define IMPL_SEQFOR_FOR_GUIDE23_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL23
+#define IMPL_SEQFOR_FOR_GUIDE23_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL23
+#define IMPL_SEQFOR_FAST23_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST23_B
+#define IMPL_SEQFOR_FAST23_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL23
+#define IMPL_SEQFOR_FAST23_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL23
+#define IMPL_SEQFOR_UNTIL23_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL23_B
+#define IMPL_SEQFOR_UNTIL23_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL23
+#define IMPL_SEQFOR_UNTIL23_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL23
+#define IMPL_SEQFOR_UNTIL23_B_1_1 IMPL_SEQFOR_TRACE_STOP23
+#define IMPL_SEQFOR_ZIP23_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL23
+#define IMPL_SEQFOR_ZIP23_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL23
+#define IMPL_SEQFOR_ZIP23_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP23_C
+#define IMPL_SEQFOR_ZIP23_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL23(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE23_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE23_B
+#define IMPL_SEQFOR_SIMPLE23_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE23_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 24 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH24(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH24, 25) IMPL_SEQFOR_IDENTITY24( IMPL_SEQFOR_FOR_GUIDE24_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE24(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE24, 25) IMPL_SEQFOR_IDENTITY24( IMPL_SEQFOR_SIMPLE24_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST24(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST24, 25) IMPL_SEQFOR_IDENTITY24( IMPL_SEQFOR_FAST24_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL24(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL24, 25) IMPL_SEQFOR_IDENTITY24( IMPL_SEQFOR_UNTIL24_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP24(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP24, 25) IMPL_SEQFOR_IDENTITY24( IMPL_SEQFOR_ZIP24_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS24(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS24, 25) IMPL_SEQFOR_IDENTITY24( IMPL_SEQFOR_FOR_GUIDE24_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP24(m, seq) IMPL_SEQFOR_IDENTITY24( IMPL_SEQFOR_MAP24_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER24(p, seq) IMPL_SEQFOR_IDENTITY24( IMPL_SEQFOR_FILTER24_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G24(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G24, 25) IMPL_SEQFOR_FOR_GUIDE24_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G24(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G24, 25) IMPL_SEQFOR_SIMPLE24_A(m, g) )
+#define SF_FOR_EACH_FAST_G24(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G24, 25) IMPL_SEQFOR_FAST24_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G24(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G24, 25) IMPL_SEQFOR_UNTIL24_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G24(m, g) IMPL_SEQFOR_MAP_G24_A(m, g) )
+#define SF_SEQ_FILTER_G24(p, g) IMPL_SEQFOR_FILTER_G24_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY24(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE24_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE24_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE24_A_ IMPL_SEQFOR_FOR_GUIDE24_B
+#define IMPL_SEQFOR_FOR_GUIDE24_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE24_END
+#define IMPL_SEQFOR_FOR_GUIDE24_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE24_END
+#define IMPL_SEQFOR_FOR_GUIDE24_END(m, s, f, d, ...) f(25, d)
+#define IMPL_SEQFOR_FOR_GUIDE24_B(m, s, f, d, ...) m(25, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE24_B_0(m, s, f, s(25, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE24_B_0(...) IMPL_SEQFOR_FOR_GUIDE24_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE24_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE24_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST24_A(m, s, f, d, e) IMPL_SEQFOR_FAST24_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST24_A_ IMPL_SEQFOR_FAST24_B
+#define IMPL_SEQFOR_FAST24_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE24_END
+#define IMPL_SEQFOR_FAST24_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE24_END
+#define IMPL_SEQFOR_FAST24_B(m, s, f, d, ...) m(25, d, __VA_ARGS__) IMPL_SEQFOR_FAST24_A(m, s, f, s(25, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL24_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL24_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL24_A_ IMPL_SEQFOR_UNTIL24_B
+#define IMPL_SEQFOR_UNTIL24_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE24_END
+#define IMPL_SEQFOR_UNTIL24_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE24_END
+#define IMPL_SEQFOR_UNTIL24_B(m, s, f, d, ...) m(25, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL24_B_0(m, s, f, s(25, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL24_B_0(...) IMPL_SEQFOR_UNTIL24_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL24_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL24_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL24_B_1_0 IMPL_SEQFOR_UNTIL24_A
+#define IMPL_SEQFOR_UNTIL24_B_1_1 IMPL_SEQFOR_UNTIL24_STOP
+#define IMPL_SEQFOR_UNTIL24_STOP(m, s, f, d, e) f(25, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP24_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP24_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP24_A_ IMPL_SEQFOR_ZIP24_B
+#define IMPL_SEQFOR_ZIP24_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE24_END
+#define IMPL_SEQFOR_ZIP24_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE24_END
+#define IMPL_SEQFOR_ZIP24_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP24_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP24_B_0(...) IMPL_SEQFOR_ZIP24_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP24_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP24_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP24_B_1_0 IMPL_SEQFOR_ZIP24_C
+#define IMPL_SEQFOR_ZIP24_B_1_1(m, s, f, d, ...) f(25, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP24_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP24_C(m, s, f, d, r, ...) m(25, d, __VA_ARGS__) IMPL_SEQFOR_ZIP24_A(m, s, f, s(25, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE24_A(m, e) IMPL_SEQFOR_SIMPLE24_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE24_A_ IMPL_SEQFOR_SIMPLE24_B
+#define IMPL_SEQFOR_SIMPLE24_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE24_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE24_B(m, ...) m(25, __VA_ARGS__) IMPL_SEQFOR_SIMPLE24_A(m,
+#define IMPL_SEQFOR_MAP24_A(m, e) IMPL_SEQFOR_MAP24_A_##e(m,
+#define IMPL_SEQFOR_MAP24_A_ IMPL_SEQFOR_MAP24_B
+#define IMPL_SEQFOR_MAP24_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP24_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP24_B(m, ...) (m(25, __VA_ARGS__)) IMPL_SEQFOR_MAP24_A(m,
+#define IMPL_SEQFOR_FILTER24_A(p, e) IMPL_SEQFOR_FILTER24_A_##e(p,
+#define IMPL_SEQFOR_FILTER24_A_ IMPL_SEQFOR_FILTER24_B
+#define IMPL_SEQFOR_FILTER24_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER24_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER24_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(25, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER24_A(p,
+#define IMPL_SEQFOR_MAP_G24_A(m, e) IMPL_SEQFOR_MAP_G24_A_##e(m,
+#define IMPL_SEQFOR_MAP_G24_A_ IMPL_SEQFOR_MAP_G24_B
+#define IMPL_SEQFOR_MAP_G24_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G24_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G24_B(m, ...) )m(25, __VA_ARGS__)) IMPL_SEQFOR_MAP_G24_A(m,
+#define IMPL_SEQFOR_FILTER_G24_A(p, e) IMPL_SEQFOR_FILTER_G24_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G24_A_ IMPL_SEQFOR_FILTER_G24_B
+#define IMPL_SEQFOR_FILTER_G24_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G24_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G24_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(25, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G24_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL24(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE24_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP24(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL24(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE24_A_
+#undef IMPL_SEQFOR_FOR_GUIDE24_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE24_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST24_A_
+#undef IMPL_SEQFOR_FAST24_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST24_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL24_A_
+#undef IMPL_SEQFOR_UNTIL24_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL24_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL24_B_1_1
+#undef IMPL_SEQFOR_ZIP24_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP24_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP24_B_1_0
+#undef IMPL_SEQFOR_ZIP24_B_1_1
+#undef IMPL_SEQFOR_SIMPLE24_A_
+#undef IMPL_SEQFOR_SIMPLE24_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE24_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE24_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE24_B
+#define IMPL_SEQFOR_FOR_GUIDE24_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL24
+#define IMPL_SEQFOR_FOR_GUIDE24_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL24
+#define IMPL_SEQFOR_FAST24_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST24_B
+#define IMPL_SEQFOR_FAST24_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL24
+#define IMPL_SEQFOR_FAST24_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL24
+#define IMPL_SEQFOR_UNTIL24_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL24_B
+#define IMPL_SEQFOR_UNTIL24_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL24
+#define IMPL_SEQFOR_UNTIL24_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL24
+#define IMPL_SEQFOR_UNTIL24_B_1_1 IMPL_SEQFOR_TRACE_STOP24
+#define IMPL_SEQFOR_ZIP24_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL24
+#define IMPL_SEQFOR_ZIP24_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL24
+#define IMPL_SEQFOR_ZIP24_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP24_C
+#define IMPL_SEQFOR_ZIP24_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL24(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE24_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE24_B
+#define IMPL_SEQFOR_SIMPLE24_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE24_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 25 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH25(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH25, 26) IMPL_SEQFOR_IDENTITY25( IMPL_SEQFOR_FOR_GUIDE25_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE25(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE25, 26) IMPL_SEQFOR_IDENTITY25( IMPL_SEQFOR_SIMPLE25_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST25(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST25, 26) IMPL_SEQFOR_IDENTITY25( IMPL_SEQFOR_FAST25_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL25(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL25, 26) IMPL_SEQFOR_IDENTITY25( IMPL_SEQFOR_UNTIL25_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP25(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP25, 26) IMPL_SEQFOR_IDENTITY25( IMPL_SEQFOR_ZIP25_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS25(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS25, 26) IMPL_SEQFOR_IDENTITY25( IMPL_SEQFOR_FOR_GUIDE25_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP25(m, seq) IMPL_SEQFOR_IDENTITY25( IMPL_SEQFOR_MAP25_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER25(p, seq) IMPL_SEQFOR_IDENTITY25( IMPL_SEQFOR_FILTER25_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G25(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G25, 26) IMPL_SEQFOR_FOR_GUIDE25_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G25(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G25, 26) IMPL_SEQFOR_SIMPLE25_A(m, g) )
+#define SF_FOR_EACH_FAST_G25(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G25, 26) IMPL_SEQFOR_FAST25_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G25(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G25, 26) IMPL_SEQFOR_UNTIL25_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G25(m, g) IMPL_SEQFOR_MAP_G25_A(m, g) )
+#define SF_SEQ_FILTER_G25(p, g) IMPL_SEQFOR_FILTER_G25_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY25(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE25_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE25_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE25_A_ IMPL_SEQFOR_FOR_GUIDE25_B
+#define IMPL_SEQFOR_FOR_GUIDE25_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE25_END
+#define IMPL_SEQFOR_FOR_GUIDE25_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE25_END
+#define IMPL_SEQFOR_FOR_GUIDE25_END(m, s, f, d, ...) f(26, d)
+#define IMPL_SEQFOR_FOR_GUIDE25_B(m, s, f, d, ...) m(26, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE25_B_0(m, s, f, s(26, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE25_B_0(...) IMPL_SEQFOR_FOR_GUIDE25_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE25_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE25_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST25_A(m, s, f, d, e) IMPL_SEQFOR_FAST25_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST25_A_ IMPL_SEQFOR_FAST25_B
+#define IMPL_SEQFOR_FAST25_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE25_END
+#define IMPL_SEQFOR_FAST25_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE25_END
+#define IMPL_SEQFOR_FAST25_B(m, s, f, d, ...) m(26, d, __VA_ARGS__) IMPL_SEQFOR_FAST25_A(m, s, f, s(26, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL25_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL25_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL25_A_ IMPL_SEQFOR_UNTIL25_B
+#define IMPL_SEQFOR_UNTIL25_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE25_END
+#define IMPL_SEQFOR_UNTIL25_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE25_END
+#define IMPL_SEQFOR_UNTIL25_B(m, s, f, d, ...) m(26, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL25_B_0(m, s, f, s(26, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL25_B_0(...) IMPL_SEQFOR_UNTIL25_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL25_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL25_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL25_B_1_0 IMPL_SEQFOR_UNTIL25_A
+#define IMPL_SEQFOR_UNTIL25_B_1_1 IMPL_SEQFOR_UNTIL25_STOP
+#define IMPL_SEQFOR_UNTIL25_STOP(m, s, f, d, e) f(26, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP25_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP25_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP25_A_ IMPL_SEQFOR_ZIP25_B
+#define IMPL_SEQFOR_ZIP25_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE25_END
+#define IMPL_SEQFOR_ZIP25_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE25_END
+#define IMPL_SEQFOR_ZIP25_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP25_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP25_B_0(...) IMPL_SEQFOR_ZIP25_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP25_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP25_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP25_B_1_0 IMPL_SEQFOR_ZIP25_C
+#define IMPL_SEQFOR_ZIP25_B_1_1(m, s, f, d, ...) f(26, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP25_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP25_C(m, s, f, d, r, ...) m(26, d, __VA_ARGS__) IMPL_SEQFOR_ZIP25_A(m, s, f, s(26, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE25_A(m, e) IMPL_SEQFOR_SIMPLE25_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE25_A_ IMPL_SEQFOR_SIMPLE25_B
+#define IMPL_SEQFOR_SIMPLE25_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE25_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE25_B(m, ...) m(26, __VA_ARGS__) IMPL_SEQFOR_SIMPLE25_A(m,
+#define IMPL_SEQFOR_MAP25_A(m, e) IMPL_SEQFOR_MAP25_A_##e(m,
+#define IMPL_SEQFOR_MAP25_A_ IMPL_SEQFOR_MAP25_B
+#define IMPL_SEQFOR_MAP25_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP25_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP25_B(m, ...) (m(26, __VA_ARGS__)) IMPL_SEQFOR_MAP25_A(m,
+#define IMPL_SEQFOR_FILTER25_A(p, e) IMPL_SEQFOR_FILTER25_A_##e(p,
+#define IMPL_SEQFOR_FILTER25_A_ IMPL_SEQFOR_FILTER25_B
+#define IMPL_SEQFOR_FILTER25_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER25_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER25_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(26, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER25_A(p,
+#define IMPL_SEQFOR_MAP_G25_A(m, e) IMPL_SEQFOR_MAP_G25_A_##e(m,
+#define IMPL_SEQFOR_MAP_G25_A_ IMPL_SEQFOR_MAP_G25_B
+#define IMPL_SEQFOR_MAP_G25_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G25_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G25_B(m, ...) )m(26, __VA_ARGS__)) IMPL_SEQFOR_MAP_G25_A(m,
+#define IMPL_SEQFOR_FILTER_G25_A(p, e) IMPL_SEQFOR_FILTER_G25_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G25_A_ IMPL_SEQFOR_FILTER_G25_B
+#define IMPL_SEQFOR_FILTER_G25_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G25_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G25_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(26, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G25_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL25(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE25_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP25(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL25(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE25_A_
+#undef IMPL_SEQFOR_FOR_GUIDE25_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE25_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST25_A_
+#undef IMPL_SEQFOR_FAST25_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST25_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL25_A_
+#undef IMPL_SEQFOR_UNTIL25_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL25_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL25_B_1_1
+#undef IMPL_SEQFOR_ZIP25_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP25_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP25_B_1_0
+#undef IMPL_SEQFOR_ZIP25_B_1_1
+#undef IMPL_SEQFOR_SIMPLE25_A_
+#undef IMPL_SEQFOR_SIMPLE25_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE25_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE25_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE25_B
+#define IMPL_SEQFOR_FOR_GUIDE25_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL25
+#define IMPL_SEQFOR_FOR_GUIDE25_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL25
+#define IMPL_SEQFOR_FAST25_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST25_B
+#define IMPL_SEQFOR_FAST25_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL25
+#define IMPL_SEQFOR_FAST25_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL25
+#define IMPL_SEQFOR_UNTIL25_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL25_B
+#define IMPL_SEQFOR_UNTIL25_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL25
+#define IMPL_SEQFOR_UNTIL25_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL25
+#define IMPL_SEQFOR_UNTIL25_B_1_1 IMPL_SEQFOR_TRACE_STOP25
+#define IMPL_SEQFOR_ZIP25_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL25
+#define IMPL_SEQFOR_ZIP25_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL25
+#define IMPL_SEQFOR_ZIP25_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP25_C
+#define IMPL_SEQFOR_ZIP25_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL25(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE25_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE25_B
+#define IMPL_SEQFOR_SIMPLE25_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE25_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 26 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH26(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH26, 27) IMPL_SEQFOR_IDENTITY26( IMPL_SEQFOR_FOR_GUIDE26_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE26(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE26, 27) IMPL_SEQFOR_IDENTITY26( IMPL_SEQFOR_SIMPLE26_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST26(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST26, 27) IMPL_SEQFOR_IDENTITY26( IMPL_SEQFOR_FAST26_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL26(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL26, 27) IMPL_SEQFOR_IDENTITY26( IMPL_SEQFOR_UNTIL26_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP26(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP26, 27) IMPL_SEQFOR_IDENTITY26( IMPL_SEQFOR_ZIP26_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS26(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS26, 27) IMPL_SEQFOR_IDENTITY26( IMPL_SEQFOR_FOR_GUIDE26_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP26(m, seq) IMPL_SEQFOR_IDENTITY26( IMPL_SEQFOR_MAP26_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER26(p, seq) IMPL_SEQFOR_IDENTITY26( IMPL_SEQFOR_FILTER26_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G26(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G26, 27) IMPL_SEQFOR_FOR_GUIDE26_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G26(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G26, 27) IMPL_SEQFOR_SIMPLE26_A(m, g) )
+#define SF_FOR_EACH_FAST_G26(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G26, 27) IMPL_SEQFOR_FAST26_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G26(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G26, 27) IMPL_SEQFOR_UNTIL26_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G26(m, g) IMPL_SEQFOR_MAP_G26_A(m, g) )
+#define SF_SEQ_FILTER_G26(p, g) IMPL_SEQFOR_FILTER_G26_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY26(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE26_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE26_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE26_A_ IMPL_SEQFOR_FOR_GUIDE26_B
+#define IMPL_SEQFOR_FOR_GUIDE26_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE26_END
+#define IMPL_SEQFOR_FOR_GUIDE26_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE26_END
+#define IMPL_SEQFOR_FOR_GUIDE26_END(m, s, f, d, ...) f(27, d)
+#define IMPL_SEQFOR_FOR_GUIDE26_B(m, s, f, d, ...) m(27, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE26_B_0(m, s, f, s(27, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE26_B_0(...) IMPL_SEQFOR_FOR_GUIDE26_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE26_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE26_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST26_A(m, s, f, d, e) IMPL_SEQFOR_FAST26_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST26_A_ IMPL_SEQFOR_FAST26_B
+#define IMPL_SEQFOR_FAST26_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE26_END
+#define IMPL_SEQFOR_FAST26_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE26_END
+#define IMPL_SEQFOR_FAST26_B(m, s, f, d, ...) m(27, d, __VA_ARGS__) IMPL_SEQFOR_FAST26_A(m, s, f, s(27, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL26_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL26_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL26_A_ IMPL_SEQFOR_UNTIL26_B
+#define IMPL_SEQFOR_UNTIL26_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE26_END
+#define IMPL_SEQFOR_UNTIL26_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE26_END
+#define IMPL_SEQFOR_UNTIL26_B(m, s, f, d, ...) m(27, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL26_B_0(m, s, f, s(27, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL26_B_0(...) IMPL_SEQFOR_UNTIL26_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL26_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL26_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL26_B_1_0 IMPL_SEQFOR_UNTIL26_A
+#define IMPL_SEQFOR_UNTIL26_B_1_1 IMPL_SEQFOR_UNTIL26_STOP
+#define IMPL_SEQFOR_UNTIL26_STOP(m, s, f, d, e) f(27, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP26_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP26_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP26_A_ IMPL_SEQFOR_ZIP26_B
+#define IMPL_SEQFOR_ZIP26_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE26_END
+#define IMPL_SEQFOR_ZIP26_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE26_END
+#define IMPL_SEQFOR_ZIP26_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP26_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP26_B_0(...) IMPL_SEQFOR_ZIP26_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP26_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP26_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP26_B_1_0 IMPL_SEQFOR_ZIP26_C
+#define IMPL_SEQFOR_ZIP26_B_1_1(m, s, f, d, ...) f(27, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP26_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP26_C(m, s, f, d, r, ...) m(27, d, __VA_ARGS__) IMPL_SEQFOR_ZIP26_A(m, s, f, s(27, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE26_A(m, e) IMPL_SEQFOR_SIMPLE26_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE26_A_ IMPL_SEQFOR_SIMPLE26_B
+#define IMPL_SEQFOR_SIMPLE26_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE26_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE26_B(m, ...) m(27, __VA_ARGS__) IMPL_SEQFOR_SIMPLE26_A(m,
+#define IMPL_SEQFOR_MAP26_A(m, e) IMPL_SEQFOR_MAP26_A_##e(m,
+#define IMPL_SEQFOR_MAP26_A_ IMPL_SEQFOR_MAP26_B
+#define IMPL_SEQFOR_MAP26_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP26_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP26_B(m, ...) (m(27, __VA_ARGS__)) IMPL_SEQFOR_MAP26_A(m,
+#define IMPL_SEQFOR_FILTER26_A(p, e) IMPL_SEQFOR_FILTER26_A_##e(p,
+#define IMPL_SEQFOR_FILTER26_A_ IMPL_SEQFOR_FILTER26_B
+#define IMPL_SEQFOR_FILTER26_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER26_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER26_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(27, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER26_A(p,
+#define IMPL_SEQFOR_MAP_G26_A(m, e) IMPL_SEQFOR_MAP_G26_A_##e(m,
+#define IMPL_SEQFOR_MAP_G26_A_ IMPL_SEQFOR_MAP_G26_B
+#define IMPL_SEQFOR_MAP_G26_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G26_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G26_B(m, ...) )m(27, __VA_ARGS__)) IMPL_SEQFOR_MAP_G26_A(m,
+#define IMPL_SEQFOR_FILTER_G26_A(p, e) IMPL_SEQFOR_FILTER_G26_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G26_A_ IMPL_SEQFOR_FILTER_G26_B
+#define IMPL_SEQFOR_FILTER_G26_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G26_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G26_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(27, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G26_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL26(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE26_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP26(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL26(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE26_A_
+#undef IMPL_SEQFOR_FOR_GUIDE26_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE26_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST26_A_
+#undef IMPL_SEQFOR_FAST26_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST26_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL26_A_
+#undef IMPL_SEQFOR_UNTIL26_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL26_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL26_B_1_1
+#undef IMPL_SEQFOR_ZIP26_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP26_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP26_B_1_0
+#undef IMPL_SEQFOR_ZIP26_B_1_1
+#undef IMPL_SEQFOR_SIMPLE26_A_
+#undef IMPL_SEQFOR_SIMPLE26_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE26_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE26_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE26_B
+#define IMPL_SEQFOR_FOR_GUIDE26_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL26
+#define IMPL_SEQFOR_FOR_GUIDE26_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL26
+#define IMPL_SEQFOR_FAST26_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST26_B
+#define IMPL_SEQFOR_FAST26_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL26
+#define IMPL_SEQFOR_FAST26_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL26
+#define IMPL_SEQFOR_UNTIL26_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL26_B
+#define IMPL_SEQFOR_UNTIL26_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL26
+#define IMPL_SEQFOR_UNTIL26_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL26
+#define IMPL_SEQFOR_UNTIL26_B_1_1 IMPL_SEQFOR_TRACE_STOP26
+#define IMPL_SEQFOR_ZIP26_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL26
+#define IMPL_SEQFOR_ZIP26_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL26
+#define IMPL_SEQFOR_ZIP26_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP26_C
+#define IMPL_SEQFOR_ZIP26_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL26(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE26_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE26_B
+#define IMPL_SEQFOR_SIMPLE26_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE26_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 27 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH27(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH27, 28) IMPL_SEQFOR_IDENTITY27( IMPL_SEQFOR_FOR_GUIDE27_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE27(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE27, 28) IMPL_SEQFOR_IDENTITY27( IMPL_SEQFOR_SIMPLE27_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST27(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST27, 28) IMPL_SEQFOR_IDENTITY27( IMPL_SEQFOR_FAST27_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL27(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL27, 28) IMPL_SEQFOR_IDENTITY27( IMPL_SEQFOR_UNTIL27_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP27(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP27, 28) IMPL_SEQFOR_IDENTITY27( IMPL_SEQFOR_ZIP27_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS27(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS27, 28) IMPL_SEQFOR_IDENTITY27( IMPL_SEQFOR_FOR_GUIDE27_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP27(m, seq) IMPL_SEQFOR_IDENTITY27( IMPL_SEQFOR_MAP27_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER27(p, seq) IMPL_SEQFOR_IDENTITY27( IMPL_SEQFOR_FILTER27_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G27(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G27, 28) IMPL_SEQFOR_FOR_GUIDE27_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G27(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G27, 28) IMPL_SEQFOR_SIMPLE27_A(m, g) )
+#define SF_FOR_EACH_FAST_G27(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G27, 28) IMPL_SEQFOR_FAST27_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G27(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G27, 28) IMPL_SEQFOR_UNTIL27_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G27(m, g) IMPL_SEQFOR_MAP_G27_A(m, g) )
+#define SF_SEQ_FILTER_G27(p, g) IMPL_SEQFOR_FILTER_G27_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY27(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE27_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE27_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE27_A_ IMPL_SEQFOR_FOR_GUIDE27_B
+#define IMPL_SEQFOR_FOR_GUIDE27_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE27_END
+#define IMPL_SEQFOR_FOR_GUIDE27_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE27_END
+#define IMPL_SEQFOR_FOR_GUIDE27_END(m, s, f, d, ...) f(28, d)
+#define IMPL_SEQFOR_FOR_GUIDE27_B(m, s, f, d, ...) m(28, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE27_B_0(m, s, f, s(28, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE27_B_0(...) IMPL_SEQFOR_FOR_GUIDE27_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE27_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE27_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST27_A(m, s, f, d, e) IMPL_SEQFOR_FAST27_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST27_A_ IMPL_SEQFOR_FAST27_B
+#define IMPL_SEQFOR_FAST27_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE27_END
+#define IMPL_SEQFOR_FAST27_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE27_END
+#define IMPL_SEQFOR_FAST27_B(m, s, f, d, ...) m(28, d, __VA_ARGS__) IMPL_SEQFOR_FAST27_A(m, s, f, s(28, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL27_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL27_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL27_A_ IMPL_SEQFOR_UNTIL27_B
+#define IMPL_SEQFOR_UNTIL27_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE27_END
+#define IMPL_SEQFOR_UNTIL27_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE27_END
+#define IMPL_SEQFOR_UNTIL27_B(m, s, f, d, ...) m(28, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL27_B_0(m, s, f, s(28, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL27_B_0(...) IMPL_SEQFOR_UNTIL27_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL27_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL27_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL27_B_1_0 IMPL_SEQFOR_UNTIL27_A
+#define IMPL_SEQFOR_UNTIL27_B_1_1 IMPL_SEQFOR_UNTIL27_STOP
+#define IMPL_SEQFOR_UNTIL27_STOP(m, s, f, d, e) f(28, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP27_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP27_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP27_A_ IMPL_SEQFOR_ZIP27_B
+#define IMPL_SEQFOR_ZIP27_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE27_END
+#define IMPL_SEQFOR_ZIP27_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE27_END
+#define IMPL_SEQFOR_ZIP27_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP27_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP27_B_0(...) IMPL_SEQFOR_ZIP27_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP27_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP27_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP27_B_1_0 IMPL_SEQFOR_ZIP27_C
+#define IMPL_SEQFOR_ZIP27_B_1_1(m, s, f, d, ...) f(28, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP27_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP27_C(m, s, f, d, r, ...) m(28, d, __VA_ARGS__) IMPL_SEQFOR_ZIP27_A(m, s, f, s(28, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE27_A(m, e) IMPL_SEQFOR_SIMPLE27_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE27_A_ IMPL_SEQFOR_SIMPLE27_B
+#define IMPL_SEQFOR_SIMPLE27_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE27_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE27_B(m, ...) m(28, __VA_ARGS__) IMPL_SEQFOR_SIMPLE27_A(m,
+#define IMPL_SEQFOR_MAP27_A(m, e) IMPL_SEQFOR_MAP27_A_##e(m,
+#define IMPL_SEQFOR_MAP27_A_ IMPL_SEQFOR_MAP27_B
+#define IMPL_SEQFOR_MAP27_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP27_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP27_B(m, ...) (m(28, __VA_ARGS__)) IMPL_SEQFOR_MAP27_A(m,
+#define IMPL_SEQFOR_FILTER27_A(p, e) IMPL_SEQFOR_FILTER27_A_##e(p,
+#define IMPL_SEQFOR_FILTER27_A_ IMPL_SEQFOR_FILTER27_B
+#define IMPL_SEQFOR_FILTER27_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER27_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER27_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(28, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER27_A(p,
+#define IMPL_SEQFOR_MAP_G27_A(m, e) IMPL_SEQFOR_MAP_G27_A_##e(m,
+#define IMPL_SEQFOR_MAP_G27_A_ IMPL_SEQFOR_MAP_G27_B
+#define IMPL_SEQFOR_MAP_G27_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G27_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G27_B(m, ...) )m(28, __VA_ARGS__)) IMPL_SEQFOR_MAP_G27_A(m,
+#define IMPL_SEQFOR_FILTER_G27_A(p, e) IMPL_SEQFOR_FILTER_G27_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G27_A_ IMPL_SEQFOR_FILTER_G27_B
+#define IMPL_SEQFOR_FILTER_G27_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G27_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G27_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(28, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G27_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL27(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE27_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP27(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL27(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE27_A_
+#undef IMPL_SEQFOR_FOR_GUIDE27_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE27_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST27_A_
+#undef IMPL_SEQFOR_FAST27_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST27_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL27_A_
+#undef IMPL_SEQFOR_UNTIL27_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL27_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL27_B_1_1
+#undef IMPL_SEQFOR_ZIP27_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP27_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP27_B_1_0
+#undef IMPL_SEQFOR_ZIP27_B_1_1
+#undef IMPL_SEQFOR_SIMPLE27_A_
+#undef IMPL_SEQFOR_SIMPLE27_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE27_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE27_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE27_B
+#define IMPL_SEQFOR_FOR_GUIDE27_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL27
+#define IMPL_SEQFOR_FOR_GUIDE27_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL27
+#define IMPL_SEQFOR_FAST27_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST27_B
+#define IMPL_SEQFOR_FAST27_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL27
+#define IMPL_SEQFOR_FAST27_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL27
+#define IMPL_SEQFOR_UNTIL27_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL27_B
+#define IMPL_SEQFOR_UNTIL27_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL27
+#define IMPL_SEQFOR_UNTIL27_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL27
+#define IMPL_SEQFOR_UNTIL27_B_1_1 IMPL_SEQFOR_TRACE_STOP27
+#define IMPL_SEQFOR_ZIP27_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL27
+#define IMPL_SEQFOR_ZIP27_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL27
+#define IMPL_SEQFOR_ZIP27_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP27_C
+#define IMPL_SEQFOR_ZIP27_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL27(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE27_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE27_B
+#define IMPL_SEQFOR_SIMPLE27_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE27_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 28 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH28(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH28, 29) IMPL_SEQFOR_IDENTITY28( IMPL_SEQFOR_FOR_GUIDE28_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE28(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE28, 29) IMPL_SEQFOR_IDENTITY28( IMPL_SEQFOR_SIMPLE28_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST28(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST28, 29) IMPL_SEQFOR_IDENTITY28( IMPL_SEQFOR_FAST28_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL28(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL28, 29) IMPL_SEQFOR_IDENTITY28( IMPL_SEQFOR_UNTIL28_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP28(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP28, 29) IMPL_SEQFOR_IDENTITY28( IMPL_SEQFOR_ZIP28_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS28(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS28, 29) IMPL_SEQFOR_IDENTITY28( IMPL_SEQFOR_FOR_GUIDE28_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP28(m, seq) IMPL_SEQFOR_IDENTITY28( IMPL_SEQFOR_MAP28_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER28(p, seq) IMPL_SEQFOR_IDENTITY28( IMPL_SEQFOR_FILTER28_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G28(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G28, 29) IMPL_SEQFOR_FOR_GUIDE28_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G28(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G28, 29) IMPL_SEQFOR_SIMPLE28_A(m, g) )
+#define SF_FOR_EACH_FAST_G28(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G28, 29) IMPL_SEQFOR_FAST28_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G28(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G28, 29) IMPL_SEQFOR_UNTIL28_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G28(m, g) IMPL_SEQFOR_MAP_G28_A(m, g) )
+#define SF_SEQ_FILTER_G28(p, g) IMPL_SEQFOR_FILTER_G28_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY28(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE28_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE28_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE28_A_ IMPL_SEQFOR_FOR_GUIDE28_B
+#define IMPL_SEQFOR_FOR_GUIDE28_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE28_END
+#define IMPL_SEQFOR_FOR_GUIDE28_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE28_END
+#define IMPL_SEQFOR_FOR_GUIDE28_END(m, s, f, d, ...) f(29, d)
+#define IMPL_SEQFOR_FOR_GUIDE28_B(m, s, f, d, ...) m(29, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE28_B_0(m, s, f, s(29, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE28_B_0(...) IMPL_SEQFOR_FOR_GUIDE28_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE28_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE28_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST28_A(m, s, f, d, e) IMPL_SEQFOR_FAST28_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST28_A_ IMPL_SEQFOR_FAST28_B
+#define IMPL_SEQFOR_FAST28_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE28_END
+#define IMPL_SEQFOR_FAST28_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE28_END
+#define IMPL_SEQFOR_FAST28_B(m, s, f, d, ...) m(29, d, __VA_ARGS__) IMPL_SEQFOR_FAST28_A(m, s, f, s(29, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL28_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL28_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL28_A_ IMPL_SEQFOR_UNTIL28_B
+#define IMPL_SEQFOR_UNTIL28_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE28_END
+#define IMPL_SEQFOR_UNTIL28_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE28_END
+#define IMPL_SEQFOR_UNTIL28_B(m, s, f, d, ...) m(29, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL28_B_0(m, s, f, s(29, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL28_B_0(...) IMPL_SEQFOR_UNTIL28_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL28_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL28_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL28_B_1_0 IMPL_SEQFOR_UNTIL28_A
+#define IMPL_SEQFOR_UNTIL28_B_1_1 IMPL_SEQFOR_UNTIL28_STOP
+#define IMPL_SEQFOR_UNTIL28_STOP(m, s, f, d, e) f(29, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP28_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP28_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP28_A_ IMPL_SEQFOR_ZIP28_B
+#define IMPL_SEQFOR_ZIP28_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE28_END
+#define IMPL_SEQFOR_ZIP28_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE28_END
+#define IMPL_SEQFOR_ZIP28_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP28_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP28_B_0(...) IMPL_SEQFOR_ZIP28_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP28_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP28_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP28_B_1_0 IMPL_SEQFOR_ZIP28_C
+#define IMPL_SEQFOR_ZIP28_B_1_1(m, s, f, d, ...) f(29, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP28_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP28_C(m, s, f, d, r, ...) m(29, d, __VA_ARGS__) IMPL_SEQFOR_ZIP28_A(m, s, f, s(29, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE28_A(m, e) IMPL_SEQFOR_SIMPLE28_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE28_A_ IMPL_SEQFOR_SIMPLE28_B
+#define IMPL_SEQFOR_SIMPLE28_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE28_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE28_B(m, ...) m(29, __VA_ARGS__) IMPL_SEQFOR_SIMPLE28_A(m,
+#define IMPL_SEQFOR_MAP28_A(m, e) IMPL_SEQFOR_MAP28_A_##e(m,
+#define IMPL_SEQFOR_MAP28_A_ IMPL_SEQFOR_MAP28_B
+#define IMPL_SEQFOR_MAP28_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP28_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP28_B(m, ...) (m(29, __VA_ARGS__)) IMPL_SEQFOR_MAP28_A(m,
+#define IMPL_SEQFOR_FILTER28_A(p, e) IMPL_SEQFOR_FILTER28_A_##e(p,
+#define IMPL_SEQFOR_FILTER28_A_ IMPL_SEQFOR_FILTER28_B
+#define IMPL_SEQFOR_FILTER28_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER28_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER28_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(29, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER28_A(p,
+#define IMPL_SEQFOR_MAP_G28_A(m, e) IMPL_SEQFOR_MAP_G28_A_##e(m,
+#define IMPL_SEQFOR_MAP_G28_A_ IMPL_SEQFOR_MAP_G28_B
+#define IMPL_SEQFOR_MAP_G28_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G28_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G28_B(m, ...) )m(29, __VA_ARGS__)) IMPL_SEQFOR_MAP_G28_A(m,
+#define IMPL_SEQFOR_FILTER_G28_A(p, e) IMPL_SEQFOR_FILTER_G28_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G28_A_ IMPL_SEQFOR_FILTER_G28_B
+#define IMPL_SEQFOR_FILTER_G28_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G28_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G28_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(29, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G28_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL28(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE28_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP28(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL28(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE28_A_
+#undef IMPL_SEQFOR_FOR_GUIDE28_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE28_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST28_A_
+#undef IMPL_SEQFOR_FAST28_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST28_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL28_A_
+#undef IMPL_SEQFOR_UNTIL28_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL28_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL28_B_1_1
+#undef IMPL_SEQFOR_ZIP28_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP28_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP28_B_1_0
+#undef IMPL_SEQFOR_ZIP28_B_1_1
+#undef IMPL_SEQFOR_SIMPLE28_A_
+#undef IMPL_SEQFOR_SIMPLE28_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE28_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE28_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE28_B
+#define IMPL_SEQFOR_FOR_GUIDE28_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL28
+#define IMPL_SEQFOR_FOR_GUIDE28_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL28
+#define IMPL_SEQFOR_FAST28_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST28_B
+#define IMPL_SEQFOR_FAST28_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL28
+#define IMPL_SEQFOR_FAST28_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL28
+#define IMPL_SEQFOR_UNTIL28_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL28_B
+#define IMPL_SEQFOR_UNTIL28_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL28
+#define IMPL_SEQFOR_UNTIL28_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL28
+#define IMPL_SEQFOR_UNTIL28_B_1_1 IMPL_SEQFOR_TRACE_STOP28
+#define IMPL_SEQFOR_ZIP28_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL28
+#define IMPL_SEQFOR_ZIP28_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL28
+#define IMPL_SEQFOR_ZIP28_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP28_C
+#define IMPL_SEQFOR_ZIP28_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL28(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE28_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE28_B
+#define IMPL_SEQFOR_SIMPLE28_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE28_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
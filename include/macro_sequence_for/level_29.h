@@ -0,0 +1,113 @@
+// Nesting level 29 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH29(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH29, 30) IMPL_SEQFOR_IDENTITY29( IMPL_SEQFOR_FOR_GUIDE29_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE29(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE29, 30) IMPL_SEQFOR_IDENTITY29( IMPL_SEQFOR_SIMPLE29_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST29(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST29, 30) IMPL_SEQFOR_IDENTITY29( IMPL_SEQFOR_FAST29_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL29(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL29, 30) IMPL_SEQFOR_IDENTITY29( IMPL_SEQFOR_UNTIL29_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP29(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP29, 30) IMPL_SEQFOR_IDENTITY29( IMPL_SEQFOR_ZIP29_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS29(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS29, 30) IMPL_SEQFOR_IDENTITY29( IMPL_SEQFOR_FOR_GUIDE29_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP29(m, seq) IMPL_SEQFOR_IDENTITY29( IMPL_SEQFOR_MAP29_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER29(p, seq) IMPL_SEQFOR_IDENTITY29( IMPL_SEQFOR_FILTER29_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G29(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G29, 30) IMPL_SEQFOR_FOR_GUIDE29_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G29(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G29, 30) IMPL_SEQFOR_SIMPLE29_A(m, g) )
+#define SF_FOR_EACH_FAST_G29(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G29, 30) IMPL_SEQFOR_FAST29_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G29(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G29, 30) IMPL_SEQFOR_UNTIL29_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G29(m, g) IMPL_SEQFOR_MAP_G29_A(m, g) )
+#define SF_SEQ_FILTER_G29(p, g) IMPL_SEQFOR_FILTER_G29_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY29(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE29_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE29_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE29_A_ IMPL_SEQFOR_FOR_GUIDE29_B
+#define IMPL_SEQFOR_FOR_GUIDE29_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE29_END
+#define IMPL_SEQFOR_FOR_GUIDE29_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE29_END
+#define IMPL_SEQFOR_FOR_GUIDE29_END(m, s, f, d, ...) f(30, d)
+#define IMPL_SEQFOR_FOR_GUIDE29_B(m, s, f, d, ...) m(30, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE29_B_0(m, s, f, s(30, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE29_B_0(...) IMPL_SEQFOR_FOR_GUIDE29_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE29_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE29_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST29_A(m, s, f, d, e) IMPL_SEQFOR_FAST29_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST29_A_ IMPL_SEQFOR_FAST29_B
+#define IMPL_SEQFOR_FAST29_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE29_END
+#define IMPL_SEQFOR_FAST29_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE29_END
+#define IMPL_SEQFOR_FAST29_B(m, s, f, d, ...) m(30, d, __VA_ARGS__) IMPL_SEQFOR_FAST29_A(m, s, f, s(30, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL29_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL29_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL29_A_ IMPL_SEQFOR_UNTIL29_B
+#define IMPL_SEQFOR_UNTIL29_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE29_END
+#define IMPL_SEQFOR_UNTIL29_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE29_END
+#define IMPL_SEQFOR_UNTIL29_B(m, s, f, d, ...) m(30, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL29_B_0(m, s, f, s(30, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL29_B_0(...) IMPL_SEQFOR_UNTIL29_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL29_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL29_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL29_B_1_0 IMPL_SEQFOR_UNTIL29_A
+#define IMPL_SEQFOR_UNTIL29_B_1_1 IMPL_SEQFOR_UNTIL29_STOP
+#define IMPL_SEQFOR_UNTIL29_STOP(m, s, f, d, e) f(30, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP29_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP29_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP29_A_ IMPL_SEQFOR_ZIP29_B
+#define IMPL_SEQFOR_ZIP29_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE29_END
+#define IMPL_SEQFOR_ZIP29_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE29_END
+#define IMPL_SEQFOR_ZIP29_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP29_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP29_B_0(...) IMPL_SEQFOR_ZIP29_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP29_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP29_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP29_B_1_0 IMPL_SEQFOR_ZIP29_C
+#define IMPL_SEQFOR_ZIP29_B_1_1(m, s, f, d, ...) f(30, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP29_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP29_C(m, s, f, d, r, ...) m(30, d, __VA_ARGS__) IMPL_SEQFOR_ZIP29_A(m, s, f, s(30, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE29_A(m, e) IMPL_SEQFOR_SIMPLE29_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE29_A_ IMPL_SEQFOR_SIMPLE29_B
+#define IMPL_SEQFOR_SIMPLE29_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE29_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE29_B(m, ...) m(30, __VA_ARGS__) IMPL_SEQFOR_SIMPLE29_A(m,
+#define IMPL_SEQFOR_MAP29_A(m, e) IMPL_SEQFOR_MAP29_A_##e(m,
+#define IMPL_SEQFOR_MAP29_A_ IMPL_SEQFOR_MAP29_B
+#define IMPL_SEQFOR_MAP29_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP29_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP29_B(m, ...) (m(30, __VA_ARGS__)) IMPL_SEQFOR_MAP29_A(m,
+#define IMPL_SEQFOR_FILTER29_A(p, e) IMPL_SEQFOR_FILTER29_A_##e(p,
+#define IMPL_SEQFOR_FILTER29_A_ IMPL_SEQFOR_FILTER29_B
+#define IMPL_SEQFOR_FILTER29_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER29_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER29_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(30, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER29_A(p,
+#define IMPL_SEQFOR_MAP_G29_A(m, e) IMPL_SEQFOR_MAP_G29_A_##e(m,
+#define IMPL_SEQFOR_MAP_G29_A_ IMPL_SEQFOR_MAP_G29_B
+#define IMPL_SEQFOR_MAP_G29_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G29_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G29_B(m, ...) )m(30, __VA_ARGS__)) IMPL_SEQFOR_MAP_G29_A(m,
+#define IMPL_SEQFOR_FILTER_G29_A(p, e) IMPL_SEQFOR_FILTER_G29_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G29_A_ IMPL_SEQFOR_FILTER_G29_B
+#define IMPL_SEQFOR_FILTER_G29_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G29_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G29_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(30, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G29_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL29(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE29_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP29(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL29(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE29_A_
+#undef IMPL_SEQFOR_FOR_GUIDE29_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE29_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST29_A_
+#undef IMPL_SEQFOR_FAST29_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST29_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL29_A_
+#undef IMPL_SEQFOR_UNTIL29_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL29_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL29_B_1_1
+#undef IMPL_SEQFOR_ZIP29_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP29_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP29_B_1_0
+#undef IMPL_SEQFOR_ZIP29_B_1_1
+#undef IMPL_SEQFOR_SIMPLE29_A_
+#undef IMPL_SEQFOR_SIMPLE29_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE29_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE29_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE29_B
+#define IMPL_SEQFOR_FOR_GUIDE29_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL29
+#define IMPL_SEQFOR_FOR_GUIDE29_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL29
+#define IMPL_SEQFOR_FAST29_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST29_B
+#define IMPL_SEQFOR_FAST29_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL29
+#define IMPL_SEQFOR_FAST29_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL29
+#define IMPL_SEQFOR_UNTIL29_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL29_B
+#define IMPL_SEQFOR_UNTIL29_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL29
+#define IMPL_SEQFOR_UNTIL29_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL29
+#define IMPL_SEQFOR_UNTIL29_B_1_1 IMPL_SEQFOR_TRACE_STOP29
+#define IMPL_SEQFOR_ZIP29_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL29
+#define IMPL_SEQFOR_ZIP29_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL29
+#define IMPL_SEQFOR_ZIP29_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP29_C
+#define IMPL_SEQFOR_ZIP29_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL29(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE29_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE29_B
+#define IMPL_SEQFOR_SIMPLE29_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE29_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
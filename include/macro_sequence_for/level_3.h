@@ -0,0 +1,113 @@
+// Nesting level 3 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH3(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH3, 4) IMPL_SEQFOR_IDENTITY3( IMPL_SEQFOR_FOR_GUIDE3_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE3(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE3, 4) IMPL_SEQFOR_IDENTITY3( IMPL_SEQFOR_SIMPLE3_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST3(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST3, 4) IMPL_SEQFOR_IDENTITY3( IMPL_SEQFOR_FAST3_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL3(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL3, 4) IMPL_SEQFOR_IDENTITY3( IMPL_SEQFOR_UNTIL3_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP3(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP3, 4) IMPL_SEQFOR_IDENTITY3( IMPL_SEQFOR_ZIP3_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS3(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS3, 4) IMPL_SEQFOR_IDENTITY3( IMPL_SEQFOR_FOR_GUIDE3_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP3(m, seq) IMPL_SEQFOR_IDENTITY3( IMPL_SEQFOR_MAP3_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER3(p, seq) IMPL_SEQFOR_IDENTITY3( IMPL_SEQFOR_FILTER3_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G3(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G3, 4) IMPL_SEQFOR_FOR_GUIDE3_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G3(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G3, 4) IMPL_SEQFOR_SIMPLE3_A(m, g) )
+#define SF_FOR_EACH_FAST_G3(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G3, 4) IMPL_SEQFOR_FAST3_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G3(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G3, 4) IMPL_SEQFOR_UNTIL3_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G3(m, g) IMPL_SEQFOR_MAP_G3_A(m, g) )
+#define SF_SEQ_FILTER_G3(p, g) IMPL_SEQFOR_FILTER_G3_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY3(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE3_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE3_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE3_A_ IMPL_SEQFOR_FOR_GUIDE3_B
+#define IMPL_SEQFOR_FOR_GUIDE3_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE3_END
+#define IMPL_SEQFOR_FOR_GUIDE3_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE3_END
+#define IMPL_SEQFOR_FOR_GUIDE3_END(m, s, f, d, ...) f(4, d)
+#define IMPL_SEQFOR_FOR_GUIDE3_B(m, s, f, d, ...) m(4, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE3_B_0(m, s, f, s(4, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE3_B_0(...) IMPL_SEQFOR_FOR_GUIDE3_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE3_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE3_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST3_A(m, s, f, d, e) IMPL_SEQFOR_FAST3_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST3_A_ IMPL_SEQFOR_FAST3_B
+#define IMPL_SEQFOR_FAST3_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE3_END
+#define IMPL_SEQFOR_FAST3_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE3_END
+#define IMPL_SEQFOR_FAST3_B(m, s, f, d, ...) m(4, d, __VA_ARGS__) IMPL_SEQFOR_FAST3_A(m, s, f, s(4, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL3_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL3_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL3_A_ IMPL_SEQFOR_UNTIL3_B
+#define IMPL_SEQFOR_UNTIL3_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE3_END
+#define IMPL_SEQFOR_UNTIL3_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE3_END
+#define IMPL_SEQFOR_UNTIL3_B(m, s, f, d, ...) m(4, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL3_B_0(m, s, f, s(4, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL3_B_0(...) IMPL_SEQFOR_UNTIL3_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL3_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL3_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL3_B_1_0 IMPL_SEQFOR_UNTIL3_A
+#define IMPL_SEQFOR_UNTIL3_B_1_1 IMPL_SEQFOR_UNTIL3_STOP
+#define IMPL_SEQFOR_UNTIL3_STOP(m, s, f, d, e) f(4, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP3_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP3_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP3_A_ IMPL_SEQFOR_ZIP3_B
+#define IMPL_SEQFOR_ZIP3_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE3_END
+#define IMPL_SEQFOR_ZIP3_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE3_END
+#define IMPL_SEQFOR_ZIP3_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP3_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP3_B_0(...) IMPL_SEQFOR_ZIP3_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP3_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP3_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP3_B_1_0 IMPL_SEQFOR_ZIP3_C
+#define IMPL_SEQFOR_ZIP3_B_1_1(m, s, f, d, ...) f(4, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP3_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP3_C(m, s, f, d, r, ...) m(4, d, __VA_ARGS__) IMPL_SEQFOR_ZIP3_A(m, s, f, s(4, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE3_A(m, e) IMPL_SEQFOR_SIMPLE3_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE3_A_ IMPL_SEQFOR_SIMPLE3_B
+#define IMPL_SEQFOR_SIMPLE3_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE3_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE3_B(m, ...) m(4, __VA_ARGS__) IMPL_SEQFOR_SIMPLE3_A(m,
+#define IMPL_SEQFOR_MAP3_A(m, e) IMPL_SEQFOR_MAP3_A_##e(m,
+#define IMPL_SEQFOR_MAP3_A_ IMPL_SEQFOR_MAP3_B
+#define IMPL_SEQFOR_MAP3_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP3_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP3_B(m, ...) (m(4, __VA_ARGS__)) IMPL_SEQFOR_MAP3_A(m,
+#define IMPL_SEQFOR_FILTER3_A(p, e) IMPL_SEQFOR_FILTER3_A_##e(p,
+#define IMPL_SEQFOR_FILTER3_A_ IMPL_SEQFOR_FILTER3_B
+#define IMPL_SEQFOR_FILTER3_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER3_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER3_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(4, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER3_A(p,
+#define IMPL_SEQFOR_MAP_G3_A(m, e) IMPL_SEQFOR_MAP_G3_A_##e(m,
+#define IMPL_SEQFOR_MAP_G3_A_ IMPL_SEQFOR_MAP_G3_B
+#define IMPL_SEQFOR_MAP_G3_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G3_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G3_B(m, ...) )m(4, __VA_ARGS__)) IMPL_SEQFOR_MAP_G3_A(m,
+#define IMPL_SEQFOR_FILTER_G3_A(p, e) IMPL_SEQFOR_FILTER_G3_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G3_A_ IMPL_SEQFOR_FILTER_G3_B
+#define IMPL_SEQFOR_FILTER_G3_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G3_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G3_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(4, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G3_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL3(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE3_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP3(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL3(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE3_A_
+#undef IMPL_SEQFOR_FOR_GUIDE3_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE3_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST3_A_
+#undef IMPL_SEQFOR_FAST3_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST3_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL3_A_
+#undef IMPL_SEQFOR_UNTIL3_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL3_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL3_B_1_1
+#undef IMPL_SEQFOR_ZIP3_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP3_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP3_B_1_0
+#undef IMPL_SEQFOR_ZIP3_B_1_1
+#undef IMPL_SEQFOR_SIMPLE3_A_
+#undef IMPL_SEQFOR_SIMPLE3_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE3_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE3_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE3_B
+#define IMPL_SEQFOR_FOR_GUIDE3_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL3
+#define IMPL_SEQFOR_FOR_GUIDE3_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL3
+#define IMPL_SEQFOR_FAST3_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST3_B
+#define IMPL_SEQFOR_FAST3_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL3
+#define IMPL_SEQFOR_FAST3_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL3
+#define IMPL_SEQFOR_UNTIL3_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL3_B
+#define IMPL_SEQFOR_UNTIL3_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL3
+#define IMPL_SEQFOR_UNTIL3_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL3
+#define IMPL_SEQFOR_UNTIL3_B_1_1 IMPL_SEQFOR_TRACE_STOP3
+#define IMPL_SEQFOR_ZIP3_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL3
+#define IMPL_SEQFOR_ZIP3_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL3
+#define IMPL_SEQFOR_ZIP3_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP3_C
+#define IMPL_SEQFOR_ZIP3_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL3(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE3_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE3_B
+#define IMPL_SEQFOR_SIMPLE3_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE3_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
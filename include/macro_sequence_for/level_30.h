@@ -0,0 +1,113 @@
+// Nesting level 30 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH30(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH30, 31) IMPL_SEQFOR_IDENTITY30( IMPL_SEQFOR_FOR_GUIDE30_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE30(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE30, 31) IMPL_SEQFOR_IDENTITY30( IMPL_SEQFOR_SIMPLE30_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST30(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST30, 31) IMPL_SEQFOR_IDENTITY30( IMPL_SEQFOR_FAST30_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL30(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL30, 31) IMPL_SEQFOR_IDENTITY30( IMPL_SEQFOR_UNTIL30_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP30(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP30, 31) IMPL_SEQFOR_IDENTITY30( IMPL_SEQFOR_ZIP30_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS30(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS30, 31) IMPL_SEQFOR_IDENTITY30( IMPL_SEQFOR_FOR_GUIDE30_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP30(m, seq) IMPL_SEQFOR_IDENTITY30( IMPL_SEQFOR_MAP30_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER30(p, seq) IMPL_SEQFOR_IDENTITY30( IMPL_SEQFOR_FILTER30_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G30(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G30, 31) IMPL_SEQFOR_FOR_GUIDE30_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G30(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G30, 31) IMPL_SEQFOR_SIMPLE30_A(m, g) )
+#define SF_FOR_EACH_FAST_G30(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G30, 31) IMPL_SEQFOR_FAST30_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G30(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G30, 31) IMPL_SEQFOR_UNTIL30_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G30(m, g) IMPL_SEQFOR_MAP_G30_A(m, g) )
+#define SF_SEQ_FILTER_G30(p, g) IMPL_SEQFOR_FILTER_G30_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY30(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE30_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE30_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE30_A_ IMPL_SEQFOR_FOR_GUIDE30_B
+#define IMPL_SEQFOR_FOR_GUIDE30_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE30_END
+#define IMPL_SEQFOR_FOR_GUIDE30_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE30_END
+#define IMPL_SEQFOR_FOR_GUIDE30_END(m, s, f, d, ...) f(31, d)
+#define IMPL_SEQFOR_FOR_GUIDE30_B(m, s, f, d, ...) m(31, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE30_B_0(m, s, f, s(31, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE30_B_0(...) IMPL_SEQFOR_FOR_GUIDE30_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE30_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE30_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST30_A(m, s, f, d, e) IMPL_SEQFOR_FAST30_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST30_A_ IMPL_SEQFOR_FAST30_B
+#define IMPL_SEQFOR_FAST30_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE30_END
+#define IMPL_SEQFOR_FAST30_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE30_END
+#define IMPL_SEQFOR_FAST30_B(m, s, f, d, ...) m(31, d, __VA_ARGS__) IMPL_SEQFOR_FAST30_A(m, s, f, s(31, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL30_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL30_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL30_A_ IMPL_SEQFOR_UNTIL30_B
+#define IMPL_SEQFOR_UNTIL30_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE30_END
+#define IMPL_SEQFOR_UNTIL30_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE30_END
+#define IMPL_SEQFOR_UNTIL30_B(m, s, f, d, ...) m(31, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL30_B_0(m, s, f, s(31, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL30_B_0(...) IMPL_SEQFOR_UNTIL30_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL30_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL30_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL30_B_1_0 IMPL_SEQFOR_UNTIL30_A
+#define IMPL_SEQFOR_UNTIL30_B_1_1 IMPL_SEQFOR_UNTIL30_STOP
+#define IMPL_SEQFOR_UNTIL30_STOP(m, s, f, d, e) f(31, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP30_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP30_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP30_A_ IMPL_SEQFOR_ZIP30_B
+#define IMPL_SEQFOR_ZIP30_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE30_END
+#define IMPL_SEQFOR_ZIP30_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE30_END
+#define IMPL_SEQFOR_ZIP30_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP30_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP30_B_0(...) IMPL_SEQFOR_ZIP30_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP30_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP30_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP30_B_1_0 IMPL_SEQFOR_ZIP30_C
+#define IMPL_SEQFOR_ZIP30_B_1_1(m, s, f, d, ...) f(31, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP30_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP30_C(m, s, f, d, r, ...) m(31, d, __VA_ARGS__) IMPL_SEQFOR_ZIP30_A(m, s, f, s(31, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE30_A(m, e) IMPL_SEQFOR_SIMPLE30_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE30_A_ IMPL_SEQFOR_SIMPLE30_B
+#define IMPL_SEQFOR_SIMPLE30_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE30_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE30_B(m, ...) m(31, __VA_ARGS__) IMPL_SEQFOR_SIMPLE30_A(m,
+#define IMPL_SEQFOR_MAP30_A(m, e) IMPL_SEQFOR_MAP30_A_##e(m,
+#define IMPL_SEQFOR_MAP30_A_ IMPL_SEQFOR_MAP30_B
+#define IMPL_SEQFOR_MAP30_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP30_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP30_B(m, ...) (m(31, __VA_ARGS__)) IMPL_SEQFOR_MAP30_A(m,
+#define IMPL_SEQFOR_FILTER30_A(p, e) IMPL_SEQFOR_FILTER30_A_##e(p,
+#define IMPL_SEQFOR_FILTER30_A_ IMPL_SEQFOR_FILTER30_B
+#define IMPL_SEQFOR_FILTER30_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER30_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER30_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(31, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER30_A(p,
+#define IMPL_SEQFOR_MAP_G30_A(m, e) IMPL_SEQFOR_MAP_G30_A_##e(m,
+#define IMPL_SEQFOR_MAP_G30_A_ IMPL_SEQFOR_MAP_G30_B
+#define IMPL_SEQFOR_MAP_G30_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G30_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G30_B(m, ...) )m(31, __VA_ARGS__)) IMPL_SEQFOR_MAP_G30_A(m,
+#define IMPL_SEQFOR_FILTER_G30_A(p, e) IMPL_SEQFOR_FILTER_G30_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G30_A_ IMPL_SEQFOR_FILTER_G30_B
+#define IMPL_SEQFOR_FILTER_G30_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G30_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G30_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(31, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G30_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL30(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE30_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP30(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL30(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE30_A_
+#undef IMPL_SEQFOR_FOR_GUIDE30_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE30_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST30_A_
+#undef IMPL_SEQFOR_FAST30_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST30_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL30_A_
+#undef IMPL_SEQFOR_UNTIL30_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL30_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL30_B_1_1
+#undef IMPL_SEQFOR_ZIP30_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP30_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP30_B_1_0
+#undef IMPL_SEQFOR_ZIP30_B_1_1
+#undef IMPL_SEQFOR_SIMPLE30_A_
+#undef IMPL_SEQFOR_SIMPLE30_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE30_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE30_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE30_B
+#define IMPL_SEQFOR_FOR_GUIDE30_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL30
+#define IMPL_SEQFOR_FOR_GUIDE30_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL30
+#define IMPL_SEQFOR_FAST30_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST30_B
+#define IMPL_SEQFOR_FAST30_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL30
+#define IMPL_SEQFOR_FAST30_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL30
+#define IMPL_SEQFOR_UNTIL30_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL30_B
+#define IMPL_SEQFOR_UNTIL30_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL30
+#define IMPL_SEQFOR_UNTIL30_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL30
+#define IMPL_SEQFOR_UNTIL30_B_1_1 IMPL_SEQFOR_TRACE_STOP30
+#define IMPL_SEQFOR_ZIP30_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL30
+#define IMPL_SEQFOR_ZIP30_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL30
+#define IMPL_SEQFOR_ZIP30_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP30_C
+#define IMPL_SEQFOR_ZIP30_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL30(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE30_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE30_B
+#define IMPL_SEQFOR_SIMPLE30_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE30_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 31 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH31(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH31, 32) IMPL_SEQFOR_IDENTITY31( IMPL_SEQFOR_FOR_GUIDE31_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE31(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE31, 32) IMPL_SEQFOR_IDENTITY31( IMPL_SEQFOR_SIMPLE31_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST31(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST31, 32) IMPL_SEQFOR_IDENTITY31( IMPL_SEQFOR_FAST31_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL31(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL31, 32) IMPL_SEQFOR_IDENTITY31( IMPL_SEQFOR_UNTIL31_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP31(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP31, 32) IMPL_SEQFOR_IDENTITY31( IMPL_SEQFOR_ZIP31_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS31(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS31, 32) IMPL_SEQFOR_IDENTITY31( IMPL_SEQFOR_FOR_GUIDE31_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP31(m, seq) IMPL_SEQFOR_IDENTITY31( IMPL_SEQFOR_MAP31_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER31(p, seq) IMPL_SEQFOR_IDENTITY31( IMPL_SEQFOR_FILTER31_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G31(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G31, 32) IMPL_SEQFOR_FOR_GUIDE31_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G31(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G31, 32) IMPL_SEQFOR_SIMPLE31_A(m, g) )
+#define SF_FOR_EACH_FAST_G31(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G31, 32) IMPL_SEQFOR_FAST31_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G31(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G31, 32) IMPL_SEQFOR_UNTIL31_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G31(m, g) IMPL_SEQFOR_MAP_G31_A(m, g) )
+#define SF_SEQ_FILTER_G31(p, g) IMPL_SEQFOR_FILTER_G31_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY31(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE31_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE31_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE31_A_ IMPL_SEQFOR_FOR_GUIDE31_B
+#define IMPL_SEQFOR_FOR_GUIDE31_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE31_END
+#define IMPL_SEQFOR_FOR_GUIDE31_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE31_END
+#define IMPL_SEQFOR_FOR_GUIDE31_END(m, s, f, d, ...) f(32, d)
+#define IMPL_SEQFOR_FOR_GUIDE31_B(m, s, f, d, ...) m(32, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE31_B_0(m, s, f, s(32, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE31_B_0(...) IMPL_SEQFOR_FOR_GUIDE31_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE31_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE31_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST31_A(m, s, f, d, e) IMPL_SEQFOR_FAST31_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST31_A_ IMPL_SEQFOR_FAST31_B
+#define IMPL_SEQFOR_FAST31_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE31_END
+#define IMPL_SEQFOR_FAST31_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE31_END
+#define IMPL_SEQFOR_FAST31_B(m, s, f, d, ...) m(32, d, __VA_ARGS__) IMPL_SEQFOR_FAST31_A(m, s, f, s(32, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL31_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL31_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL31_A_ IMPL_SEQFOR_UNTIL31_B
+#define IMPL_SEQFOR_UNTIL31_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE31_END
+#define IMPL_SEQFOR_UNTIL31_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE31_END
+#define IMPL_SEQFOR_UNTIL31_B(m, s, f, d, ...) m(32, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL31_B_0(m, s, f, s(32, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL31_B_0(...) IMPL_SEQFOR_UNTIL31_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL31_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL31_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL31_B_1_0 IMPL_SEQFOR_UNTIL31_A
+#define IMPL_SEQFOR_UNTIL31_B_1_1 IMPL_SEQFOR_UNTIL31_STOP
+#define IMPL_SEQFOR_UNTIL31_STOP(m, s, f, d, e) f(32, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP31_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP31_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP31_A_ IMPL_SEQFOR_ZIP31_B
+#define IMPL_SEQFOR_ZIP31_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE31_END
+#define IMPL_SEQFOR_ZIP31_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE31_END
+#define IMPL_SEQFOR_ZIP31_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP31_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP31_B_0(...) IMPL_SEQFOR_ZIP31_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP31_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP31_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP31_B_1_0 IMPL_SEQFOR_ZIP31_C
+#define IMPL_SEQFOR_ZIP31_B_1_1(m, s, f, d, ...) f(32, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP31_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP31_C(m, s, f, d, r, ...) m(32, d, __VA_ARGS__) IMPL_SEQFOR_ZIP31_A(m, s, f, s(32, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE31_A(m, e) IMPL_SEQFOR_SIMPLE31_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE31_A_ IMPL_SEQFOR_SIMPLE31_B
+#define IMPL_SEQFOR_SIMPLE31_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE31_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE31_B(m, ...) m(32, __VA_ARGS__) IMPL_SEQFOR_SIMPLE31_A(m,
+#define IMPL_SEQFOR_MAP31_A(m, e) IMPL_SEQFOR_MAP31_A_##e(m,
+#define IMPL_SEQFOR_MAP31_A_ IMPL_SEQFOR_MAP31_B
+#define IMPL_SEQFOR_MAP31_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP31_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP31_B(m, ...) (m(32, __VA_ARGS__)) IMPL_SEQFOR_MAP31_A(m,
+#define IMPL_SEQFOR_FILTER31_A(p, e) IMPL_SEQFOR_FILTER31_A_##e(p,
+#define IMPL_SEQFOR_FILTER31_A_ IMPL_SEQFOR_FILTER31_B
+#define IMPL_SEQFOR_FILTER31_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER31_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER31_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(32, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER31_A(p,
+#define IMPL_SEQFOR_MAP_G31_A(m, e) IMPL_SEQFOR_MAP_G31_A_##e(m,
+#define IMPL_SEQFOR_MAP_G31_A_ IMPL_SEQFOR_MAP_G31_B
+#define IMPL_SEQFOR_MAP_G31_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G31_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G31_B(m, ...) )m(32, __VA_ARGS__)) IMPL_SEQFOR_MAP_G31_A(m,
+#define IMPL_SEQFOR_FILTER_G31_A(p, e) IMPL_SEQFOR_FILTER_G31_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G31_A_ IMPL_SEQFOR_FILTER_G31_B
+#define IMPL_SEQFOR_FILTER_G31_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G31_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G31_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(32, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G31_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL31(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE31_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP31(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL31(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE31_A_
+#undef IMPL_SEQFOR_FOR_GUIDE31_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE31_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST31_A_
+#undef IMPL_SEQFOR_FAST31_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST31_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL31_A_
+#undef IMPL_SEQFOR_UNTIL31_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL31_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL31_B_1_1
+#undef IMPL_SEQFOR_ZIP31_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP31_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP31_B_1_0
+#undef IMPL_SEQFOR_ZIP31_B_1_1
+#undef IMPL_SEQFOR_SIMPLE31_A_
+#undef IMPL_SEQFOR_SIMPLE31_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE31_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE31_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE31_B
+#define IMPL_SEQFOR_FOR_GUIDE31_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL31
+#define IMPL_SEQFOR_FOR_GUIDE31_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL31
+#define IMPL_SEQFOR_FAST31_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST31_B
+#define IMPL_SEQFOR_FAST31_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL31
+#define IMPL_SEQFOR_FAST31_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL31
+#define IMPL_SEQFOR_UNTIL31_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL31_B
+#define IMPL_SEQFOR_UNTIL31_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL31
+#define IMPL_SEQFOR_UNTIL31_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL31
+#define IMPL_SEQFOR_UNTIL31_B_1_1 IMPL_SEQFOR_TRACE_STOP31
+#define IMPL_SEQFOR_ZIP31_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL31
+#define IMPL_SEQFOR_ZIP31_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL31
+#define IMPL_SEQFOR_ZIP31_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP31_C
+#define IMPL_SEQFOR_ZIP31_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL31(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE31_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE31_B
+#define IMPL_SEQFOR_SIMPLE31_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE31_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 32 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH32(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH32, 33) IMPL_SEQFOR_IDENTITY32( IMPL_SEQFOR_FOR_GUIDE32_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE32(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE32, 33) IMPL_SEQFOR_IDENTITY32( IMPL_SEQFOR_SIMPLE32_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST32(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST32, 33) IMPL_SEQFOR_IDENTITY32( IMPL_SEQFOR_FAST32_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL32(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL32, 33) IMPL_SEQFOR_IDENTITY32( IMPL_SEQFOR_UNTIL32_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP32(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP32, 33) IMPL_SEQFOR_IDENTITY32( IMPL_SEQFOR_ZIP32_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS32(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS32, 33) IMPL_SEQFOR_IDENTITY32( IMPL_SEQFOR_FOR_GUIDE32_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP32(m, seq) IMPL_SEQFOR_IDENTITY32( IMPL_SEQFOR_MAP32_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER32(p, seq) IMPL_SEQFOR_IDENTITY32( IMPL_SEQFOR_FILTER32_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G32(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G32, 33) IMPL_SEQFOR_FOR_GUIDE32_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G32(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G32, 33) IMPL_SEQFOR_SIMPLE32_A(m, g) )
+#define SF_FOR_EACH_FAST_G32(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G32, 33) IMPL_SEQFOR_FAST32_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G32(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G32, 33) IMPL_SEQFOR_UNTIL32_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G32(m, g) IMPL_SEQFOR_MAP_G32_A(m, g) )
+#define SF_SEQ_FILTER_G32(p, g) IMPL_SEQFOR_FILTER_G32_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY32(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE32_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE32_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE32_A_ IMPL_SEQFOR_FOR_GUIDE32_B
+#define IMPL_SEQFOR_FOR_GUIDE32_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE32_END
+#define IMPL_SEQFOR_FOR_GUIDE32_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE32_END
+#define IMPL_SEQFOR_FOR_GUIDE32_END(m, s, f, d, ...) f(33, d)
+#define IMPL_SEQFOR_FOR_GUIDE32_B(m, s, f, d, ...) m(33, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE32_B_0(m, s, f, s(33, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE32_B_0(...) IMPL_SEQFOR_FOR_GUIDE32_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE32_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE32_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST32_A(m, s, f, d, e) IMPL_SEQFOR_FAST32_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST32_A_ IMPL_SEQFOR_FAST32_B
+#define IMPL_SEQFOR_FAST32_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE32_END
+#define IMPL_SEQFOR_FAST32_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE32_END
+#define IMPL_SEQFOR_FAST32_B(m, s, f, d, ...) m(33, d, __VA_ARGS__) IMPL_SEQFOR_FAST32_A(m, s, f, s(33, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL32_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL32_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL32_A_ IMPL_SEQFOR_UNTIL32_B
+#define IMPL_SEQFOR_UNTIL32_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE32_END
+#define IMPL_SEQFOR_UNTIL32_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE32_END
+#define IMPL_SEQFOR_UNTIL32_B(m, s, f, d, ...) m(33, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL32_B_0(m, s, f, s(33, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL32_B_0(...) IMPL_SEQFOR_UNTIL32_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL32_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL32_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL32_B_1_0 IMPL_SEQFOR_UNTIL32_A
+#define IMPL_SEQFOR_UNTIL32_B_1_1 IMPL_SEQFOR_UNTIL32_STOP
+#define IMPL_SEQFOR_UNTIL32_STOP(m, s, f, d, e) f(33, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP32_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP32_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP32_A_ IMPL_SEQFOR_ZIP32_B
+#define IMPL_SEQFOR_ZIP32_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE32_END
+#define IMPL_SEQFOR_ZIP32_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE32_END
+#define IMPL_SEQFOR_ZIP32_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP32_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP32_B_0(...) IMPL_SEQFOR_ZIP32_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP32_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP32_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP32_B_1_0 IMPL_SEQFOR_ZIP32_C
+#define IMPL_SEQFOR_ZIP32_B_1_1(m, s, f, d, ...) f(33, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP32_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP32_C(m, s, f, d, r, ...) m(33, d, __VA_ARGS__) IMPL_SEQFOR_ZIP32_A(m, s, f, s(33, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE32_A(m, e) IMPL_SEQFOR_SIMPLE32_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE32_A_ IMPL_SEQFOR_SIMPLE32_B
+#define IMPL_SEQFOR_SIMPLE32_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE32_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE32_B(m, ...) m(33, __VA_ARGS__) IMPL_SEQFOR_SIMPLE32_A(m,
+#define IMPL_SEQFOR_MAP32_A(m, e) IMPL_SEQFOR_MAP32_A_##e(m,
+#define IMPL_SEQFOR_MAP32_A_ IMPL_SEQFOR_MAP32_B
+#define IMPL_SEQFOR_MAP32_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP32_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP32_B(m, ...) (m(33, __VA_ARGS__)) IMPL_SEQFOR_MAP32_A(m,
+#define IMPL_SEQFOR_FILTER32_A(p, e) IMPL_SEQFOR_FILTER32_A_##e(p,
+#define IMPL_SEQFOR_FILTER32_A_ IMPL_SEQFOR_FILTER32_B
+#define IMPL_SEQFOR_FILTER32_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER32_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER32_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(33, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER32_A(p,
+#define IMPL_SEQFOR_MAP_G32_A(m, e) IMPL_SEQFOR_MAP_G32_A_##e(m,
+#define IMPL_SEQFOR_MAP_G32_A_ IMPL_SEQFOR_MAP_G32_B
+#define IMPL_SEQFOR_MAP_G32_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G32_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G32_B(m, ...) )m(33, __VA_ARGS__)) IMPL_SEQFOR_MAP_G32_A(m,
+#define IMPL_SEQFOR_FILTER_G32_A(p, e) IMPL_SEQFOR_FILTER_G32_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G32_A_ IMPL_SEQFOR_FILTER_G32_B
+#define IMPL_SEQFOR_FILTER_G32_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G32_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G32_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(33, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G32_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL32(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE32_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP32(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL32(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE32_A_
+#undef IMPL_SEQFOR_FOR_GUIDE32_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE32_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST32_A_
+#undef IMPL_SEQFOR_FAST32_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST32_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL32_A_
+#undef IMPL_SEQFOR_UNTIL32_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL32_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL32_B_1_1
+#undef IMPL_SEQFOR_ZIP32_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP32_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP32_B_1_0
+#undef IMPL_SEQFOR_ZIP32_B_1_1
+#undef IMPL_SEQFOR_SIMPLE32_A_
+#undef IMPL_SEQFOR_SIMPLE32_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE32_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE32_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE32_B
+#define IMPL_SEQFOR_FOR_GUIDE32_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL32
+#define IMPL_SEQFOR_FOR_GUIDE32_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL32
+#define IMPL_SEQFOR_FAST32_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST32_B
+#define IMPL_SEQFOR_FAST32_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL32
+#define IMPL_SEQFOR_FAST32_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL32
+#define IMPL_SEQFOR_UNTIL32_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL32_B
+#define IMPL_SEQFOR_UNTIL32_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL32
+#define IMPL_SEQFOR_UNTIL32_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL32
+#define IMPL_SEQFOR_UNTIL32_B_1_1 IMPL_SEQFOR_TRACE_STOP32
+#define IMPL_SEQFOR_ZIP32_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL32
+#define IMPL_SEQFOR_ZIP32_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL32
+#define IMPL_SEQFOR_ZIP32_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP32_C
+#define IMPL_SEQFOR_ZIP32_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL32(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE32_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE32_B
+#define IMPL_SEQFOR_SIMPLE32_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE32_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
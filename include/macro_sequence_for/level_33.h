@@ -0,0 +1,113 @@
+// Nesting level 33 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH33(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH33, 34) IMPL_SEQFOR_IDENTITY33( IMPL_SEQFOR_FOR_GUIDE33_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE33(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE33, 34) IMPL_SEQFOR_IDENTITY33( IMPL_SEQFOR_SIMPLE33_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST33(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST33, 34) IMPL_SEQFOR_IDENTITY33( IMPL_SEQFOR_FAST33_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL33(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL33, 34) IMPL_SEQFOR_IDENTITY33( IMPL_SEQFOR_UNTIL33_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP33(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP33, 34) IMPL_SEQFOR_IDENTITY33( IMPL_SEQFOR_ZIP33_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS33(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS33, 34) IMPL_SEQFOR_IDENTITY33( IMPL_SEQFOR_FOR_GUIDE33_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP33(m, seq) IMPL_SEQFOR_IDENTITY33( IMPL_SEQFOR_MAP33_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER33(p, seq) IMPL_SEQFOR_IDENTITY33( IMPL_SEQFOR_FILTER33_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G33(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G33, 34) IMPL_SEQFOR_FOR_GUIDE33_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G33(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G33, 34) IMPL_SEQFOR_SIMPLE33_A(m, g) )
+#define SF_FOR_EACH_FAST_G33(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G33, 34) IMPL_SEQFOR_FAST33_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G33(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G33, 34) IMPL_SEQFOR_UNTIL33_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G33(m, g) IMPL_SEQFOR_MAP_G33_A(m, g) )
+#define SF_SEQ_FILTER_G33(p, g) IMPL_SEQFOR_FILTER_G33_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY33(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE33_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE33_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE33_A_ IMPL_SEQFOR_FOR_GUIDE33_B
+#define IMPL_SEQFOR_FOR_GUIDE33_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE33_END
+#define IMPL_SEQFOR_FOR_GUIDE33_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE33_END
+#define IMPL_SEQFOR_FOR_GUIDE33_END(m, s, f, d, ...) f(34, d)
+#define IMPL_SEQFOR_FOR_GUIDE33_B(m, s, f, d, ...) m(34, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE33_B_0(m, s, f, s(34, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE33_B_0(...) IMPL_SEQFOR_FOR_GUIDE33_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE33_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE33_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST33_A(m, s, f, d, e) IMPL_SEQFOR_FAST33_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST33_A_ IMPL_SEQFOR_FAST33_B
+#define IMPL_SEQFOR_FAST33_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE33_END
+#define IMPL_SEQFOR_FAST33_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE33_END
+#define IMPL_SEQFOR_FAST33_B(m, s, f, d, ...) m(34, d, __VA_ARGS__) IMPL_SEQFOR_FAST33_A(m, s, f, s(34, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL33_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL33_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL33_A_ IMPL_SEQFOR_UNTIL33_B
+#define IMPL_SEQFOR_UNTIL33_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE33_END
+#define IMPL_SEQFOR_UNTIL33_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE33_END
+#define IMPL_SEQFOR_UNTIL33_B(m, s, f, d, ...) m(34, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL33_B_0(m, s, f, s(34, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL33_B_0(...) IMPL_SEQFOR_UNTIL33_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL33_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL33_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL33_B_1_0 IMPL_SEQFOR_UNTIL33_A
+#define IMPL_SEQFOR_UNTIL33_B_1_1 IMPL_SEQFOR_UNTIL33_STOP
+#define IMPL_SEQFOR_UNTIL33_STOP(m, s, f, d, e) f(34, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP33_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP33_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP33_A_ IMPL_SEQFOR_ZIP33_B
+#define IMPL_SEQFOR_ZIP33_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE33_END
+#define IMPL_SEQFOR_ZIP33_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE33_END
+#define IMPL_SEQFOR_ZIP33_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP33_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP33_B_0(...) IMPL_SEQFOR_ZIP33_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP33_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP33_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP33_B_1_0 IMPL_SEQFOR_ZIP33_C
+#define IMPL_SEQFOR_ZIP33_B_1_1(m, s, f, d, ...) f(34, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP33_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP33_C(m, s, f, d, r, ...) m(34, d, __VA_ARGS__) IMPL_SEQFOR_ZIP33_A(m, s, f, s(34, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE33_A(m, e) IMPL_SEQFOR_SIMPLE33_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE33_A_ IMPL_SEQFOR_SIMPLE33_B
+#define IMPL_SEQFOR_SIMPLE33_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE33_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE33_B(m, ...) m(34, __VA_ARGS__) IMPL_SEQFOR_SIMPLE33_A(m,
+#define IMPL_SEQFOR_MAP33_A(m, e) IMPL_SEQFOR_MAP33_A_##e(m,
+#define IMPL_SEQFOR_MAP33_A_ IMPL_SEQFOR_MAP33_B
+#define IMPL_SEQFOR_MAP33_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP33_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP33_B(m, ...) (m(34, __VA_ARGS__)) IMPL_SEQFOR_MAP33_A(m,
+#define IMPL_SEQFOR_FILTER33_A(p, e) IMPL_SEQFOR_FILTER33_A_##e(p,
+#define IMPL_SEQFOR_FILTER33_A_ IMPL_SEQFOR_FILTER33_B
+#define IMPL_SEQFOR_FILTER33_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER33_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER33_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(34, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER33_A(p,
+#define IMPL_SEQFOR_MAP_G33_A(m, e) IMPL_SEQFOR_MAP_G33_A_##e(m,
+#define IMPL_SEQFOR_MAP_G33_A_ IMPL_SEQFOR_MAP_G33_B
+#define IMPL_SEQFOR_MAP_G33_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G33_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G33_B(m, ...) )m(34, __VA_ARGS__)) IMPL_SEQFOR_MAP_G33_A(m,
+#define IMPL_SEQFOR_FILTER_G33_A(p, e) IMPL_SEQFOR_FILTER_G33_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G33_A_ IMPL_SEQFOR_FILTER_G33_B
+#define IMPL_SEQFOR_FILTER_G33_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G33_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G33_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(34, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G33_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL33(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE33_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP33(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL33(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE33_A_
+#undef IMPL_SEQFOR_FOR_GUIDE33_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE33_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST33_A_
+#undef IMPL_SEQFOR_FAST33_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST33_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL33_A_
+#undef IMPL_SEQFOR_UNTIL33_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL33_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL33_B_1_1
+#undef IMPL_SEQFOR_ZIP33_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP33_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP33_B_1_0
+#undef IMPL_SEQFOR_ZIP33_B_1_1
+#undef IMPL_SEQFOR_SIMPLE33_A_
+#undef IMPL_SEQFOR_SIMPLE33_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE33_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE33_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE33_B
+#define IMPL_SEQFOR_FOR_GUIDE33_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL33
+#define IMPL_SEQFOR_FOR_GUIDE33_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL33
+#define IMPL_SEQFOR_FAST33_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST33_B
+#define IMPL_SEQFOR_FAST33_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL33
+#define IMPL_SEQFOR_FAST33_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL33
+#define IMPL_SEQFOR_UNTIL33_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL33_B
+#define IMPL_SEQFOR_UNTIL33_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL33
+#define IMPL_SEQFOR_UNTIL33_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL33
+#define IMPL_SEQFOR_UNTIL33_B_1_1 IMPL_SEQFOR_TRACE_STOP33
+#define IMPL_SEQFOR_ZIP33_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL33
+#define IMPL_SEQFOR_ZIP33_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL33
+#define IMPL_SEQFOR_ZIP33_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP33_C
+#define IMPL_SEQFOR_ZIP33_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL33(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE33_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE33_B
+#define IMPL_SEQFOR_SIMPLE33_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE33_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 34 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH34(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH34, 35) IMPL_SEQFOR_IDENTITY34( IMPL_SEQFOR_FOR_GUIDE34_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE34(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE34, 35) IMPL_SEQFOR_IDENTITY34( IMPL_SEQFOR_SIMPLE34_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST34(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST34, 35) IMPL_SEQFOR_IDENTITY34( IMPL_SEQFOR_FAST34_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL34(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL34, 35) IMPL_SEQFOR_IDENTITY34( IMPL_SEQFOR_UNTIL34_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP34(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP34, 35) IMPL_SEQFOR_IDENTITY34( IMPL_SEQFOR_ZIP34_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS34(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS34, 35) IMPL_SEQFOR_IDENTITY34( IMPL_SEQFOR_FOR_GUIDE34_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP34(m, seq) IMPL_SEQFOR_IDENTITY34( IMPL_SEQFOR_MAP34_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER34(p, seq) IMPL_SEQFOR_IDENTITY34( IMPL_SEQFOR_FILTER34_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G34(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G34, 35) IMPL_SEQFOR_FOR_GUIDE34_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G34(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G34, 35) IMPL_SEQFOR_SIMPLE34_A(m, g) )
+#define SF_FOR_EACH_FAST_G34(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G34, 35) IMPL_SEQFOR_FAST34_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G34(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G34, 35) IMPL_SEQFOR_UNTIL34_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G34(m, g) IMPL_SEQFOR_MAP_G34_A(m, g) )
+#define SF_SEQ_FILTER_G34(p, g) IMPL_SEQFOR_FILTER_G34_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY34(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE34_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE34_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE34_A_ IMPL_SEQFOR_FOR_GUIDE34_B
+#define IMPL_SEQFOR_FOR_GUIDE34_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE34_END
+#define IMPL_SEQFOR_FOR_GUIDE34_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE34_END
+#define IMPL_SEQFOR_FOR_GUIDE34_END(m, s, f, d, ...) f(35, d)
+#define IMPL_SEQFOR_FOR_GUIDE34_B(m, s, f, d, ...) m(35, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE34_B_0(m, s, f, s(35, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE34_B_0(...) IMPL_SEQFOR_FOR_GUIDE34_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE34_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE34_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST34_A(m, s, f, d, e) IMPL_SEQFOR_FAST34_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST34_A_ IMPL_SEQFOR_FAST34_B
+#define IMPL_SEQFOR_FAST34_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE34_END
+#define IMPL_SEQFOR_FAST34_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE34_END
+#define IMPL_SEQFOR_FAST34_B(m, s, f, d, ...) m(35, d, __VA_ARGS__) IMPL_SEQFOR_FAST34_A(m, s, f, s(35, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL34_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL34_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL34_A_ IMPL_SEQFOR_UNTIL34_B
+#define IMPL_SEQFOR_UNTIL34_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE34_END
+#define IMPL_SEQFOR_UNTIL34_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE34_END
+#define IMPL_SEQFOR_UNTIL34_B(m, s, f, d, ...) m(35, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL34_B_0(m, s, f, s(35, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL34_B_0(...) IMPL_SEQFOR_UNTIL34_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL34_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL34_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL34_B_1_0 IMPL_SEQFOR_UNTIL34_A
+#define IMPL_SEQFOR_UNTIL34_B_1_1 IMPL_SEQFOR_UNTIL34_STOP
+#define IMPL_SEQFOR_UNTIL34_STOP(m, s, f, d, e) f(35, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP34_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP34_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP34_A_ IMPL_SEQFOR_ZIP34_B
+#define IMPL_SEQFOR_ZIP34_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE34_END
+#define IMPL_SEQFOR_ZIP34_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE34_END
+#define IMPL_SEQFOR_ZIP34_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP34_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP34_B_0(...) IMPL_SEQFOR_ZIP34_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP34_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP34_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP34_B_1_0 IMPL_SEQFOR_ZIP34_C
+#define IMPL_SEQFOR_ZIP34_B_1_1(m, s, f, d, ...) f(35, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP34_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP34_C(m, s, f, d, r, ...) m(35, d, __VA_ARGS__) IMPL_SEQFOR_ZIP34_A(m, s, f, s(35, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE34_A(m, e) IMPL_SEQFOR_SIMPLE34_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE34_A_ IMPL_SEQFOR_SIMPLE34_B
+#define IMPL_SEQFOR_SIMPLE34_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE34_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE34_B(m, ...) m(35, __VA_ARGS__) IMPL_SEQFOR_SIMPLE34_A(m,
+#define IMPL_SEQFOR_MAP34_A(m, e) IMPL_SEQFOR_MAP34_A_##e(m,
+#define IMPL_SEQFOR_MAP34_A_ IMPL_SEQFOR_MAP34_B
+#define IMPL_SEQFOR_MAP34_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP34_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP34_B(m, ...) (m(35, __VA_ARGS__)) IMPL_SEQFOR_MAP34_A(m,
+#define IMPL_SEQFOR_FILTER34_A(p, e) IMPL_SEQFOR_FILTER34_A_##e(p,
+#define IMPL_SEQFOR_FILTER34_A_ IMPL_SEQFOR_FILTER34_B
+#define IMPL_SEQFOR_FILTER34_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER34_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER34_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(35, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER34_A(p,
+#define IMPL_SEQFOR_MAP_G34_A(m, e) IMPL_SEQFOR_MAP_G34_A_##e(m,
+#define IMPL_SEQFOR_MAP_G34_A_ IMPL_SEQFOR_MAP_G34_B
+#define IMPL_SEQFOR_MAP_G34_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G34_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G34_B(m, ...) )m(35, __VA_ARGS__)) IMPL_SEQFOR_MAP_G34_A(m,
+#define IMPL_SEQFOR_FILTER_G34_A(p, e) IMPL_SEQFOR_FILTER_G34_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G34_A_ IMPL_SEQFOR_FILTER_G34_B
+#define IMPL_SEQFOR_FILTER_G34_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G34_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G34_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(35, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G34_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL34(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE34_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP34(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL34(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE34_A_
+#undef IMPL_SEQFOR_FOR_GUIDE34_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE34_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST34_A_
+#undef IMPL_SEQFOR_FAST34_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST34_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL34_A_
+#undef IMPL_SEQFOR_UNTIL34_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL34_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL34_B_1_1
+#undef IMPL_SEQFOR_ZIP34_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP34_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP34_B_1_0
+#undef IMPL_SEQFOR_ZIP34_B_1_1
+#undef IMPL_SEQFOR_SIMPLE34_A_
+#undef IMPL_SEQFOR_SIMPLE34_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE34_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE34_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE34_B
+#define IMPL_SEQFOR_FOR_GUIDE34_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL34
+#define IMPL_SEQFOR_FOR_GUIDE34_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL34
+#define IMPL_SEQFOR_FAST34_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST34_B
+#define IMPL_SEQFOR_FAST34_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL34
+#define IMPL_SEQFOR_FAST34_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL34
+#define IMPL_SEQFOR_UNTIL34_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL34_B
+#define IMPL_SEQFOR_UNTIL34_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL34
+#define IMPL_SEQFOR_UNTIL34_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL34
+#define IMPL_SEQFOR_UNTIL34_B_1_1 IMPL_SEQFOR_TRACE_STOP34
+#define IMPL_SEQFOR_ZIP34_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL34
+#define IMPL_SEQFOR_ZIP34_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL34
+#define IMPL_SEQFOR_ZIP34_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP34_C
+#define IMPL_SEQFOR_ZIP34_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL34(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE34_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE34_B
+#define IMPL_SEQFOR_SIMPLE34_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE34_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
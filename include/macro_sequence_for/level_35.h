@@ -0,0 +1,113 @@
+// Nesting level 35 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH35(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH35, 36) IMPL_SEQFOR_IDENTITY35( IMPL_SEQFOR_FOR_GUIDE35_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE35(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE35, 36) IMPL_SEQFOR_IDENTITY35( IMPL_SEQFOR_SIMPLE35_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST35(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST35, 36) IMPL_SEQFOR_IDENTITY35( IMPL_SEQFOR_FAST35_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL35(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL35, 36) IMPL_SEQFOR_IDENTITY35( IMPL_SEQFOR_UNTIL35_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP35(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP35, 36) IMPL_SEQFOR_IDENTITY35( IMPL_SEQFOR_ZIP35_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS35(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS35, 36) IMPL_SEQFOR_IDENTITY35( IMPL_SEQFOR_FOR_GUIDE35_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP35(m, seq) IMPL_SEQFOR_IDENTITY35( IMPL_SEQFOR_MAP35_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER35(p, seq) IMPL_SEQFOR_IDENTITY35( IMPL_SEQFOR_FILTER35_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G35(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G35, 36) IMPL_SEQFOR_FOR_GUIDE35_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G35(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G35, 36) IMPL_SEQFOR_SIMPLE35_A(m, g) )
+#define SF_FOR_EACH_FAST_G35(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G35, 36) IMPL_SEQFOR_FAST35_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G35(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G35, 36) IMPL_SEQFOR_UNTIL35_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G35(m, g) IMPL_SEQFOR_MAP_G35_A(m, g) )
+#define SF_SEQ_FILTER_G35(p, g) IMPL_SEQFOR_FILTER_G35_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY35(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE35_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE35_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE35_A_ IMPL_SEQFOR_FOR_GUIDE35_B
+#define IMPL_SEQFOR_FOR_GUIDE35_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE35_END
+#define IMPL_SEQFOR_FOR_GUIDE35_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE35_END
+#define IMPL_SEQFOR_FOR_GUIDE35_END(m, s, f, d, ...) f(36, d)
+#define IMPL_SEQFOR_FOR_GUIDE35_B(m, s, f, d, ...) m(36, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE35_B_0(m, s, f, s(36, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE35_B_0(...) IMPL_SEQFOR_FOR_GUIDE35_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE35_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE35_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST35_A(m, s, f, d, e) IMPL_SEQFOR_FAST35_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST35_A_ IMPL_SEQFOR_FAST35_B
+#define IMPL_SEQFOR_FAST35_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE35_END
+#define IMPL_SEQFOR_FAST35_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE35_END
+#define IMPL_SEQFOR_FAST35_B(m, s, f, d, ...) m(36, d, __VA_ARGS__) IMPL_SEQFOR_FAST35_A(m, s, f, s(36, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL35_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL35_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL35_A_ IMPL_SEQFOR_UNTIL35_B
+#define IMPL_SEQFOR_UNTIL35_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE35_END
+#define IMPL_SEQFOR_UNTIL35_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE35_END
+#define IMPL_SEQFOR_UNTIL35_B(m, s, f, d, ...) m(36, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL35_B_0(m, s, f, s(36, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL35_B_0(...) IMPL_SEQFOR_UNTIL35_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL35_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL35_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL35_B_1_0 IMPL_SEQFOR_UNTIL35_A
+#define IMPL_SEQFOR_UNTIL35_B_1_1 IMPL_SEQFOR_UNTIL35_STOP
+#define IMPL_SEQFOR_UNTIL35_STOP(m, s, f, d, e) f(36, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP35_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP35_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP35_A_ IMPL_SEQFOR_ZIP35_B
+#define IMPL_SEQFOR_ZIP35_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE35_END
+#define IMPL_SEQFOR_ZIP35_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE35_END
+#define IMPL_SEQFOR_ZIP35_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP35_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP35_B_0(...) IMPL_SEQFOR_ZIP35_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP35_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP35_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP35_B_1_0 IMPL_SEQFOR_ZIP35_C
+#define IMPL_SEQFOR_ZIP35_B_1_1(m, s, f, d, ...) f(36, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP35_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP35_C(m, s, f, d, r, ...) m(36, d, __VA_ARGS__) IMPL_SEQFOR_ZIP35_A(m, s, f, s(36, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE35_A(m, e) IMPL_SEQFOR_SIMPLE35_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE35_A_ IMPL_SEQFOR_SIMPLE35_B
+#define IMPL_SEQFOR_SIMPLE35_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE35_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE35_B(m, ...) m(36, __VA_ARGS__) IMPL_SEQFOR_SIMPLE35_A(m,
+#define IMPL_SEQFOR_MAP35_A(m, e) IMPL_SEQFOR_MAP35_A_##e(m,
+#define IMPL_SEQFOR_MAP35_A_ IMPL_SEQFOR_MAP35_B
+#define IMPL_SEQFOR_MAP35_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP35_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP35_B(m, ...) (m(36, __VA_ARGS__)) IMPL_SEQFOR_MAP35_A(m,
+#define IMPL_SEQFOR_FILTER35_A(p, e) IMPL_SEQFOR_FILTER35_A_##e(p,
+#define IMPL_SEQFOR_FILTER35_A_ IMPL_SEQFOR_FILTER35_B
+#define IMPL_SEQFOR_FILTER35_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER35_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER35_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(36, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER35_A(p,
+#define IMPL_SEQFOR_MAP_G35_A(m, e) IMPL_SEQFOR_MAP_G35_A_##e(m,
+#define IMPL_SEQFOR_MAP_G35_A_ IMPL_SEQFOR_MAP_G35_B
+#define IMPL_SEQFOR_MAP_G35_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G35_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G35_B(m, ...) )m(36, __VA_ARGS__)) IMPL_SEQFOR_MAP_G35_A(m,
+#define IMPL_SEQFOR_FILTER_G35_A(p, e) IMPL_SEQFOR_FILTER_G35_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G35_A_ IMPL_SEQFOR_FILTER_G35_B
+#define IMPL_SEQFOR_FILTER_G35_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G35_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G35_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(36, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G35_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL35(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE35_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP35(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL35(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE35_A_
+#undef IMPL_SEQFOR_FOR_GUIDE35_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE35_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST35_A_
+#undef IMPL_SEQFOR_FAST35_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST35_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL35_A_
+#undef IMPL_SEQFOR_UNTIL35_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL35_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL35_B_1_1
+#undef IMPL_SEQFOR_ZIP35_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP35_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP35_B_1_0
+#undef IMPL_SEQFOR_ZIP35_B_1_1
+#undef IMPL_SEQFOR_SIMPLE35_A_
+#undef IMPL_SEQFOR_SIMPLE35_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE35_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE35_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE35_B
+#define IMPL_SEQFOR_FOR_GUIDE35_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL35
+#define IMPL_SEQFOR_FOR_GUIDE35_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL35
+#define IMPL_SEQFOR_FAST35_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST35_B
+#define IMPL_SEQFOR_FAST35_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL35
+#define IMPL_SEQFOR_FAST35_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL35
+#define IMPL_SEQFOR_UNTIL35_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL35_B
+#define IMPL_SEQFOR_UNTIL35_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL35
+#define IMPL_SEQFOR_UNTIL35_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL35
+#define IMPL_SEQFOR_UNTIL35_B_1_1 IMPL_SEQFOR_TRACE_STOP35
+#define IMPL_SEQFOR_ZIP35_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL35
+#define IMPL_SEQFOR_ZIP35_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL35
+#define IMPL_SEQFOR_ZIP35_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP35_C
+#define IMPL_SEQFOR_ZIP35_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL35(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE35_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE35_B
+#define IMPL_SEQFOR_SIMPLE35_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE35_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 36 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH36(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH36, 37) IMPL_SEQFOR_IDENTITY36( IMPL_SEQFOR_FOR_GUIDE36_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE36(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE36, 37) IMPL_SEQFOR_IDENTITY36( IMPL_SEQFOR_SIMPLE36_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST36(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST36, 37) IMPL_SEQFOR_IDENTITY36( IMPL_SEQFOR_FAST36_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL36(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL36, 37) IMPL_SEQFOR_IDENTITY36( IMPL_SEQFOR_UNTIL36_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP36(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP36, 37) IMPL_SEQFOR_IDENTITY36( IMPL_SEQFOR_ZIP36_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS36(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS36, 37) IMPL_SEQFOR_IDENTITY36( IMPL_SEQFOR_FOR_GUIDE36_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP36(m, seq) IMPL_SEQFOR_IDENTITY36( IMPL_SEQFOR_MAP36_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER36(p, seq) IMPL_SEQFOR_IDENTITY36( IMPL_SEQFOR_FILTER36_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G36(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G36, 37) IMPL_SEQFOR_FOR_GUIDE36_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G36(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G36, 37) IMPL_SEQFOR_SIMPLE36_A(m, g) )
+#define SF_FOR_EACH_FAST_G36(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G36, 37) IMPL_SEQFOR_FAST36_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G36(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G36, 37) IMPL_SEQFOR_UNTIL36_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G36(m, g) IMPL_SEQFOR_MAP_G36_A(m, g) )
+#define SF_SEQ_FILTER_G36(p, g) IMPL_SEQFOR_FILTER_G36_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY36(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE36_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE36_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE36_A_ IMPL_SEQFOR_FOR_GUIDE36_B
+#define IMPL_SEQFOR_FOR_GUIDE36_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE36_END
+#define IMPL_SEQFOR_FOR_GUIDE36_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE36_END
+#define IMPL_SEQFOR_FOR_GUIDE36_END(m, s, f, d, ...) f(37, d)
+#define IMPL_SEQFOR_FOR_GUIDE36_B(m, s, f, d, ...) m(37, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE36_B_0(m, s, f, s(37, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE36_B_0(...) IMPL_SEQFOR_FOR_GUIDE36_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE36_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE36_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST36_A(m, s, f, d, e) IMPL_SEQFOR_FAST36_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST36_A_ IMPL_SEQFOR_FAST36_B
+#define IMPL_SEQFOR_FAST36_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE36_END
+#define IMPL_SEQFOR_FAST36_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE36_END
+#define IMPL_SEQFOR_FAST36_B(m, s, f, d, ...) m(37, d, __VA_ARGS__) IMPL_SEQFOR_FAST36_A(m, s, f, s(37, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL36_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL36_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL36_A_ IMPL_SEQFOR_UNTIL36_B
+#define IMPL_SEQFOR_UNTIL36_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE36_END
+#define IMPL_SEQFOR_UNTIL36_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE36_END
+#define IMPL_SEQFOR_UNTIL36_B(m, s, f, d, ...) m(37, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL36_B_0(m, s, f, s(37, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL36_B_0(...) IMPL_SEQFOR_UNTIL36_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL36_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL36_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL36_B_1_0 IMPL_SEQFOR_UNTIL36_A
+#define IMPL_SEQFOR_UNTIL36_B_1_1 IMPL_SEQFOR_UNTIL36_STOP
+#define IMPL_SEQFOR_UNTIL36_STOP(m, s, f, d, e) f(37, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP36_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP36_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP36_A_ IMPL_SEQFOR_ZIP36_B
+#define IMPL_SEQFOR_ZIP36_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE36_END
+#define IMPL_SEQFOR_ZIP36_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE36_END
+#define IMPL_SEQFOR_ZIP36_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP36_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP36_B_0(...) IMPL_SEQFOR_ZIP36_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP36_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP36_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP36_B_1_0 IMPL_SEQFOR_ZIP36_C
+#define IMPL_SEQFOR_ZIP36_B_1_1(m, s, f, d, ...) f(37, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP36_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP36_C(m, s, f, d, r, ...) m(37, d, __VA_ARGS__) IMPL_SEQFOR_ZIP36_A(m, s, f, s(37, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE36_A(m, e) IMPL_SEQFOR_SIMPLE36_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE36_A_ IMPL_SEQFOR_SIMPLE36_B
+#define IMPL_SEQFOR_SIMPLE36_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE36_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE36_B(m, ...) m(37, __VA_ARGS__) IMPL_SEQFOR_SIMPLE36_A(m,
+#define IMPL_SEQFOR_MAP36_A(m, e) IMPL_SEQFOR_MAP36_A_##e(m,
+#define IMPL_SEQFOR_MAP36_A_ IMPL_SEQFOR_MAP36_B
+#define IMPL_SEQFOR_MAP36_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP36_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP36_B(m, ...) (m(37, __VA_ARGS__)) IMPL_SEQFOR_MAP36_A(m,
+#define IMPL_SEQFOR_FILTER36_A(p, e) IMPL_SEQFOR_FILTER36_A_##e(p,
+#define IMPL_SEQFOR_FILTER36_A_ IMPL_SEQFOR_FILTER36_B
+#define IMPL_SEQFOR_FILTER36_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER36_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER36_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(37, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER36_A(p,
+#define IMPL_SEQFOR_MAP_G36_A(m, e) IMPL_SEQFOR_MAP_G36_A_##e(m,
+#define IMPL_SEQFOR_MAP_G36_A_ IMPL_SEQFOR_MAP_G36_B
+#define IMPL_SEQFOR_MAP_G36_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G36_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G36_B(m, ...) )m(37, __VA_ARGS__)) IMPL_SEQFOR_MAP_G36_A(m,
+#define IMPL_SEQFOR_FILTER_G36_A(p, e) IMPL_SEQFOR_FILTER_G36_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G36_A_ IMPL_SEQFOR_FILTER_G36_B
+#define IMPL_SEQFOR_FILTER_G36_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G36_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G36_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(37, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G36_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL36(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE36_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP36(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL36(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE36_A_
+#undef IMPL_SEQFOR_FOR_GUIDE36_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE36_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST36_A_
+#undef IMPL_SEQFOR_FAST36_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST36_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL36_A_
+#undef IMPL_SEQFOR_UNTIL36_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL36_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL36_B_1_1
+#undef IMPL_SEQFOR_ZIP36_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP36_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP36_B_1_0
+#undef IMPL_SEQFOR_ZIP36_B_1_1
+#undef IMPL_SEQFOR_SIMPLE36_A_
+#undef IMPL_SEQFOR_SIMPLE36_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE36_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE36_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE36_B
+#define IMPL_SEQFOR_FOR_GUIDE36_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL36
+#define IMPL_SEQFOR_FOR_GUIDE36_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL36
+#define IMPL_SEQFOR_FAST36_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST36_B
+#define IMPL_SEQFOR_FAST36_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL36
+#define IMPL_SEQFOR_FAST36_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL36
+#define IMPL_SEQFOR_UNTIL36_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL36_B
+#define IMPL_SEQFOR_UNTIL36_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL36
+#define IMPL_SEQFOR_UNTIL36_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL36
+#define IMPL_SEQFOR_UNTIL36_B_1_1 IMPL_SEQFOR_TRACE_STOP36
+#define IMPL_SEQFOR_ZIP36_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL36
+#define IMPL_SEQFOR_ZIP36_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL36
+#define IMPL_SEQFOR_ZIP36_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP36_C
+#define IMPL_SEQFOR_ZIP36_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL36(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE36_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE36_B
+#define IMPL_SEQFOR_SIMPLE36_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE36_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
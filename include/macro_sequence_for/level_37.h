@@ -0,0 +1,113 @@
+// Nesting level 37 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH37(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH37, 38) IMPL_SEQFOR_IDENTITY37( IMPL_SEQFOR_FOR_GUIDE37_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE37(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE37, 38) IMPL_SEQFOR_IDENTITY37( IMPL_SEQFOR_SIMPLE37_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST37(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST37, 38) IMPL_SEQFOR_IDENTITY37( IMPL_SEQFOR_FAST37_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL37(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL37, 38) IMPL_SEQFOR_IDENTITY37( IMPL_SEQFOR_UNTIL37_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP37(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP37, 38) IMPL_SEQFOR_IDENTITY37( IMPL_SEQFOR_ZIP37_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS37(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS37, 38) IMPL_SEQFOR_IDENTITY37( IMPL_SEQFOR_FOR_GUIDE37_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP37(m, seq) IMPL_SEQFOR_IDENTITY37( IMPL_SEQFOR_MAP37_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER37(p, seq) IMPL_SEQFOR_IDENTITY37( IMPL_SEQFOR_FILTER37_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G37(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G37, 38) IMPL_SEQFOR_FOR_GUIDE37_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G37(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G37, 38) IMPL_SEQFOR_SIMPLE37_A(m, g) )
+#define SF_FOR_EACH_FAST_G37(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G37, 38) IMPL_SEQFOR_FAST37_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G37(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G37, 38) IMPL_SEQFOR_UNTIL37_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G37(m, g) IMPL_SEQFOR_MAP_G37_A(m, g) )
+#define SF_SEQ_FILTER_G37(p, g) IMPL_SEQFOR_FILTER_G37_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY37(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE37_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE37_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE37_A_ IMPL_SEQFOR_FOR_GUIDE37_B
+#define IMPL_SEQFOR_FOR_GUIDE37_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE37_END
+#define IMPL_SEQFOR_FOR_GUIDE37_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE37_END
+#define IMPL_SEQFOR_FOR_GUIDE37_END(m, s, f, d, ...) f(38, d)
+#define IMPL_SEQFOR_FOR_GUIDE37_B(m, s, f, d, ...) m(38, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE37_B_0(m, s, f, s(38, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE37_B_0(...) IMPL_SEQFOR_FOR_GUIDE37_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE37_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE37_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST37_A(m, s, f, d, e) IMPL_SEQFOR_FAST37_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST37_A_ IMPL_SEQFOR_FAST37_B
+#define IMPL_SEQFOR_FAST37_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE37_END
+#define IMPL_SEQFOR_FAST37_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE37_END
+#define IMPL_SEQFOR_FAST37_B(m, s, f, d, ...) m(38, d, __VA_ARGS__) IMPL_SEQFOR_FAST37_A(m, s, f, s(38, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL37_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL37_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL37_A_ IMPL_SEQFOR_UNTIL37_B
+#define IMPL_SEQFOR_UNTIL37_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE37_END
+#define IMPL_SEQFOR_UNTIL37_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE37_END
+#define IMPL_SEQFOR_UNTIL37_B(m, s, f, d, ...) m(38, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL37_B_0(m, s, f, s(38, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL37_B_0(...) IMPL_SEQFOR_UNTIL37_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL37_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL37_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL37_B_1_0 IMPL_SEQFOR_UNTIL37_A
+#define IMPL_SEQFOR_UNTIL37_B_1_1 IMPL_SEQFOR_UNTIL37_STOP
+#define IMPL_SEQFOR_UNTIL37_STOP(m, s, f, d, e) f(38, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP37_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP37_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP37_A_ IMPL_SEQFOR_ZIP37_B
+#define IMPL_SEQFOR_ZIP37_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE37_END
+#define IMPL_SEQFOR_ZIP37_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE37_END
+#define IMPL_SEQFOR_ZIP37_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP37_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP37_B_0(...) IMPL_SEQFOR_ZIP37_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP37_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP37_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP37_B_1_0 IMPL_SEQFOR_ZIP37_C
+#define IMPL_SEQFOR_ZIP37_B_1_1(m, s, f, d, ...) f(38, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP37_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP37_C(m, s, f, d, r, ...) m(38, d, __VA_ARGS__) IMPL_SEQFOR_ZIP37_A(m, s, f, s(38, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE37_A(m, e) IMPL_SEQFOR_SIMPLE37_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE37_A_ IMPL_SEQFOR_SIMPLE37_B
+#define IMPL_SEQFOR_SIMPLE37_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE37_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE37_B(m, ...) m(38, __VA_ARGS__) IMPL_SEQFOR_SIMPLE37_A(m,
+#define IMPL_SEQFOR_MAP37_A(m, e) IMPL_SEQFOR_MAP37_A_##e(m,
+#define IMPL_SEQFOR_MAP37_A_ IMPL_SEQFOR_MAP37_B
+#define IMPL_SEQFOR_MAP37_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP37_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP37_B(m, ...) (m(38, __VA_ARGS__)) IMPL_SEQFOR_MAP37_A(m,
+#define IMPL_SEQFOR_FILTER37_A(p, e) IMPL_SEQFOR_FILTER37_A_##e(p,
+#define IMPL_SEQFOR_FILTER37_A_ IMPL_SEQFOR_FILTER37_B
+#define IMPL_SEQFOR_FILTER37_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER37_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER37_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(38, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER37_A(p,
+#define IMPL_SEQFOR_MAP_G37_A(m, e) IMPL_SEQFOR_MAP_G37_A_##e(m,
+#define IMPL_SEQFOR_MAP_G37_A_ IMPL_SEQFOR_MAP_G37_B
+#define IMPL_SEQFOR_MAP_G37_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G37_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G37_B(m, ...) )m(38, __VA_ARGS__)) IMPL_SEQFOR_MAP_G37_A(m,
+#define IMPL_SEQFOR_FILTER_G37_A(p, e) IMPL_SEQFOR_FILTER_G37_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G37_A_ IMPL_SEQFOR_FILTER_G37_B
+#define IMPL_SEQFOR_FILTER_G37_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G37_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G37_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(38, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G37_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL37(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE37_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP37(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL37(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE37_A_
+#undef IMPL_SEQFOR_FOR_GUIDE37_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE37_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST37_A_
+#undef IMPL_SEQFOR_FAST37_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST37_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL37_A_
+#undef IMPL_SEQFOR_UNTIL37_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL37_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL37_B_1_1
+#undef IMPL_SEQFOR_ZIP37_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP37_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP37_B_1_0
+#undef IMPL_SEQFOR_ZIP37_B_1_1
+#undef IMPL_SEQFOR_SIMPLE37_A_
+#undef IMPL_SEQFOR_SIMPLE37_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE37_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE37_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE37_B
+#define IMPL_SEQFOR_FOR_GUIDE37_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL37
+#define IMPL_SEQFOR_FOR_GUIDE37_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL37
+#define IMPL_SEQFOR_FAST37_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST37_B
+#define IMPL_SEQFOR_FAST37_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL37
+#define IMPL_SEQFOR_FAST37_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL37
+#define IMPL_SEQFOR_UNTIL37_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL37_B
+#define IMPL_SEQFOR_UNTIL37_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL37
+#define IMPL_SEQFOR_UNTIL37_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL37
+#define IMPL_SEQFOR_UNTIL37_B_1_1 IMPL_SEQFOR_TRACE_STOP37
+#define IMPL_SEQFOR_ZIP37_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL37
+#define IMPL_SEQFOR_ZIP37_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL37
+#define IMPL_SEQFOR_ZIP37_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP37_C
+#define IMPL_SEQFOR_ZIP37_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL37(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE37_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE37_B
+#define IMPL_SEQFOR_SIMPLE37_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE37_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 38 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH38(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH38, 39) IMPL_SEQFOR_IDENTITY38( IMPL_SEQFOR_FOR_GUIDE38_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE38(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE38, 39) IMPL_SEQFOR_IDENTITY38( IMPL_SEQFOR_SIMPLE38_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST38(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST38, 39) IMPL_SEQFOR_IDENTITY38( IMPL_SEQFOR_FAST38_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL38(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL38, 39) IMPL_SEQFOR_IDENTITY38( IMPL_SEQFOR_UNTIL38_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP38(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP38, 39) IMPL_SEQFOR_IDENTITY38( IMPL_SEQFOR_ZIP38_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS38(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS38, 39) IMPL_SEQFOR_IDENTITY38( IMPL_SEQFOR_FOR_GUIDE38_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP38(m, seq) IMPL_SEQFOR_IDENTITY38( IMPL_SEQFOR_MAP38_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER38(p, seq) IMPL_SEQFOR_IDENTITY38( IMPL_SEQFOR_FILTER38_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G38(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G38, 39) IMPL_SEQFOR_FOR_GUIDE38_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G38(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G38, 39) IMPL_SEQFOR_SIMPLE38_A(m, g) )
+#define SF_FOR_EACH_FAST_G38(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G38, 39) IMPL_SEQFOR_FAST38_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G38(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G38, 39) IMPL_SEQFOR_UNTIL38_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G38(m, g) IMPL_SEQFOR_MAP_G38_A(m, g) )
+#define SF_SEQ_FILTER_G38(p, g) IMPL_SEQFOR_FILTER_G38_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY38(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE38_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE38_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE38_A_ IMPL_SEQFOR_FOR_GUIDE38_B
+#define IMPL_SEQFOR_FOR_GUIDE38_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE38_END
+#define IMPL_SEQFOR_FOR_GUIDE38_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE38_END
+#define IMPL_SEQFOR_FOR_GUIDE38_END(m, s, f, d, ...) f(39, d)
+#define IMPL_SEQFOR_FOR_GUIDE38_B(m, s, f, d, ...) m(39, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE38_B_0(m, s, f, s(39, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE38_B_0(...) IMPL_SEQFOR_FOR_GUIDE38_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE38_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE38_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST38_A(m, s, f, d, e) IMPL_SEQFOR_FAST38_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST38_A_ IMPL_SEQFOR_FAST38_B
+#define IMPL_SEQFOR_FAST38_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE38_END
+#define IMPL_SEQFOR_FAST38_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE38_END
+#define IMPL_SEQFOR_FAST38_B(m, s, f, d, ...) m(39, d, __VA_ARGS__) IMPL_SEQFOR_FAST38_A(m, s, f, s(39, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL38_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL38_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL38_A_ IMPL_SEQFOR_UNTIL38_B
+#define IMPL_SEQFOR_UNTIL38_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE38_END
+#define IMPL_SEQFOR_UNTIL38_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE38_END
+#define IMPL_SEQFOR_UNTIL38_B(m, s, f, d, ...) m(39, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL38_B_0(m, s, f, s(39, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL38_B_0(...) IMPL_SEQFOR_UNTIL38_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL38_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL38_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL38_B_1_0 IMPL_SEQFOR_UNTIL38_A
+#define IMPL_SEQFOR_UNTIL38_B_1_1 IMPL_SEQFOR_UNTIL38_STOP
+#define IMPL_SEQFOR_UNTIL38_STOP(m, s, f, d, e) f(39, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP38_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP38_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP38_A_ IMPL_SEQFOR_ZIP38_B
+#define IMPL_SEQFOR_ZIP38_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE38_END
+#define IMPL_SEQFOR_ZIP38_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE38_END
+#define IMPL_SEQFOR_ZIP38_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP38_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP38_B_0(...) IMPL_SEQFOR_ZIP38_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP38_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP38_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP38_B_1_0 IMPL_SEQFOR_ZIP38_C
+#define IMPL_SEQFOR_ZIP38_B_1_1(m, s, f, d, ...) f(39, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP38_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP38_C(m, s, f, d, r, ...) m(39, d, __VA_ARGS__) IMPL_SEQFOR_ZIP38_A(m, s, f, s(39, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE38_A(m, e) IMPL_SEQFOR_SIMPLE38_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE38_A_ IMPL_SEQFOR_SIMPLE38_B
+#define IMPL_SEQFOR_SIMPLE38_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE38_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE38_B(m, ...) m(39, __VA_ARGS__) IMPL_SEQFOR_SIMPLE38_A(m,
+#define IMPL_SEQFOR_MAP38_A(m, e) IMPL_SEQFOR_MAP38_A_##e(m,
+#define IMPL_SEQFOR_MAP38_A_ IMPL_SEQFOR_MAP38_B
+#define IMPL_SEQFOR_MAP38_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP38_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP38_B(m, ...) (m(39, __VA_ARGS__)) IMPL_SEQFOR_MAP38_A(m,
+#define IMPL_SEQFOR_FILTER38_A(p, e) IMPL_SEQFOR_FILTER38_A_##e(p,
+#define IMPL_SEQFOR_FILTER38_A_ IMPL_SEQFOR_FILTER38_B
+#define IMPL_SEQFOR_FILTER38_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER38_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER38_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(39, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER38_A(p,
+#define IMPL_SEQFOR_MAP_G38_A(m, e) IMPL_SEQFOR_MAP_G38_A_##e(m,
+#define IMPL_SEQFOR_MAP_G38_A_ IMPL_SEQFOR_MAP_G38_B
+#define IMPL_SEQFOR_MAP_G38_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G38_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G38_B(m, ...) )m(39, __VA_ARGS__)) IMPL_SEQFOR_MAP_G38_A(m,
+#define IMPL_SEQFOR_FILTER_G38_A(p, e) IMPL_SEQFOR_FILTER_G38_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G38_A_ IMPL_SEQFOR_FILTER_G38_B
+#define IMPL_SEQFOR_FILTER_G38_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G38_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G38_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(39, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G38_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL38(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE38_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP38(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL38(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE38_A_
+#undef IMPL_SEQFOR_FOR_GUIDE38_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE38_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST38_A_
+#undef IMPL_SEQFOR_FAST38_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST38_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL38_A_
+#undef IMPL_SEQFOR_UNTIL38_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL38_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL38_B_1_1
+#undef IMPL_SEQFOR_ZIP38_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP38_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP38_B_1_0
+#undef IMPL_SEQFOR_ZIP38_B_1_1
+#undef IMPL_SEQFOR_SIMPLE38_A_
+#undef IMPL_SEQFOR_SIMPLE38_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE38_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE38_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE38_B
+#define IMPL_SEQFOR_FOR_GUIDE38_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL38
+#define IMPL_SEQFOR_FOR_GUIDE38_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL38
+#define IMPL_SEQFOR_FAST38_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST38_B
+#define IMPL_SEQFOR_FAST38_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL38
+#define IMPL_SEQFOR_FAST38_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL38
+#define IMPL_SEQFOR_UNTIL38_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL38_B
+#define IMPL_SEQFOR_UNTIL38_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL38
+#define IMPL_SEQFOR_UNTIL38_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL38
+#define IMPL_SEQFOR_UNTIL38_B_1_1 IMPL_SEQFOR_TRACE_STOP38
+#define IMPL_SEQFOR_ZIP38_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL38
+#define IMPL_SEQFOR_ZIP38_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL38
+#define IMPL_SEQFOR_ZIP38_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP38_C
+#define IMPL_SEQFOR_ZIP38_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL38(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE38_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE38_B
+#define IMPL_SEQFOR_SIMPLE38_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE38_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
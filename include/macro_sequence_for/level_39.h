@@ -0,0 +1,113 @@
+// Nesting level 39 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH39(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH39, 40) IMPL_SEQFOR_IDENTITY39( IMPL_SEQFOR_FOR_GUIDE39_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE39(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE39, 40) IMPL_SEQFOR_IDENTITY39( IMPL_SEQFOR_SIMPLE39_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST39(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST39, 40) IMPL_SEQFOR_IDENTITY39( IMPL_SEQFOR_FAST39_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL39(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL39, 40) IMPL_SEQFOR_IDENTITY39( IMPL_SEQFOR_UNTIL39_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP39(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP39, 40) IMPL_SEQFOR_IDENTITY39( IMPL_SEQFOR_ZIP39_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS39(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS39, 40) IMPL_SEQFOR_IDENTITY39( IMPL_SEQFOR_FOR_GUIDE39_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP39(m, seq) IMPL_SEQFOR_IDENTITY39( IMPL_SEQFOR_MAP39_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER39(p, seq) IMPL_SEQFOR_IDENTITY39( IMPL_SEQFOR_FILTER39_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G39(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G39, 40) IMPL_SEQFOR_FOR_GUIDE39_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G39(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G39, 40) IMPL_SEQFOR_SIMPLE39_A(m, g) )
+#define SF_FOR_EACH_FAST_G39(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G39, 40) IMPL_SEQFOR_FAST39_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G39(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G39, 40) IMPL_SEQFOR_UNTIL39_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G39(m, g) IMPL_SEQFOR_MAP_G39_A(m, g) )
+#define SF_SEQ_FILTER_G39(p, g) IMPL_SEQFOR_FILTER_G39_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY39(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE39_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE39_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE39_A_ IMPL_SEQFOR_FOR_GUIDE39_B
+#define IMPL_SEQFOR_FOR_GUIDE39_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE39_END
+#define IMPL_SEQFOR_FOR_GUIDE39_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE39_END
+#define IMPL_SEQFOR_FOR_GUIDE39_END(m, s, f, d, ...) f(40, d)
+#define IMPL_SEQFOR_FOR_GUIDE39_B(m, s, f, d, ...) m(40, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE39_B_0(m, s, f, s(40, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE39_B_0(...) IMPL_SEQFOR_FOR_GUIDE39_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE39_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE39_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST39_A(m, s, f, d, e) IMPL_SEQFOR_FAST39_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST39_A_ IMPL_SEQFOR_FAST39_B
+#define IMPL_SEQFOR_FAST39_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE39_END
+#define IMPL_SEQFOR_FAST39_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE39_END
+#define IMPL_SEQFOR_FAST39_B(m, s, f, d, ...) m(40, d, __VA_ARGS__) IMPL_SEQFOR_FAST39_A(m, s, f, s(40, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL39_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL39_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL39_A_ IMPL_SEQFOR_UNTIL39_B
+#define IMPL_SEQFOR_UNTIL39_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE39_END
+#define IMPL_SEQFOR_UNTIL39_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE39_END
+#define IMPL_SEQFOR_UNTIL39_B(m, s, f, d, ...) m(40, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL39_B_0(m, s, f, s(40, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL39_B_0(...) IMPL_SEQFOR_UNTIL39_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL39_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL39_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL39_B_1_0 IMPL_SEQFOR_UNTIL39_A
+#define IMPL_SEQFOR_UNTIL39_B_1_1 IMPL_SEQFOR_UNTIL39_STOP
+#define IMPL_SEQFOR_UNTIL39_STOP(m, s, f, d, e) f(40, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP39_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP39_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP39_A_ IMPL_SEQFOR_ZIP39_B
+#define IMPL_SEQFOR_ZIP39_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE39_END
+#define IMPL_SEQFOR_ZIP39_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE39_END
+#define IMPL_SEQFOR_ZIP39_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP39_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP39_B_0(...) IMPL_SEQFOR_ZIP39_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP39_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP39_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP39_B_1_0 IMPL_SEQFOR_ZIP39_C
+#define IMPL_SEQFOR_ZIP39_B_1_1(m, s, f, d, ...) f(40, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP39_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP39_C(m, s, f, d, r, ...) m(40, d, __VA_ARGS__) IMPL_SEQFOR_ZIP39_A(m, s, f, s(40, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE39_A(m, e) IMPL_SEQFOR_SIMPLE39_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE39_A_ IMPL_SEQFOR_SIMPLE39_B
+#define IMPL_SEQFOR_SIMPLE39_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE39_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE39_B(m, ...) m(40, __VA_ARGS__) IMPL_SEQFOR_SIMPLE39_A(m,
+#define IMPL_SEQFOR_MAP39_A(m, e) IMPL_SEQFOR_MAP39_A_##e(m,
+#define IMPL_SEQFOR_MAP39_A_ IMPL_SEQFOR_MAP39_B
+#define IMPL_SEQFOR_MAP39_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP39_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP39_B(m, ...) (m(40, __VA_ARGS__)) IMPL_SEQFOR_MAP39_A(m,
+#define IMPL_SEQFOR_FILTER39_A(p, e) IMPL_SEQFOR_FILTER39_A_##e(p,
+#define IMPL_SEQFOR_FILTER39_A_ IMPL_SEQFOR_FILTER39_B
+#define IMPL_SEQFOR_FILTER39_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER39_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER39_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(40, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER39_A(p,
+#define IMPL_SEQFOR_MAP_G39_A(m, e) IMPL_SEQFOR_MAP_G39_A_##e(m,
+#define IMPL_SEQFOR_MAP_G39_A_ IMPL_SEQFOR_MAP_G39_B
+#define IMPL_SEQFOR_MAP_G39_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G39_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G39_B(m, ...) )m(40, __VA_ARGS__)) IMPL_SEQFOR_MAP_G39_A(m,
+#define IMPL_SEQFOR_FILTER_G39_A(p, e) IMPL_SEQFOR_FILTER_G39_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G39_A_ IMPL_SEQFOR_FILTER_G39_B
+#define IMPL_SEQFOR_FILTER_G39_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G39_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G39_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(40, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G39_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL39(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE39_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP39(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL39(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE39_A_
+#undef IMPL_SEQFOR_FOR_GUIDE39_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE39_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST39_A_
+#undef IMPL_SEQFOR_FAST39_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST39_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL39_A_
+#undef IMPL_SEQFOR_UNTIL39_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL39_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL39_B_1_1
+#undef IMPL_SEQFOR_ZIP39_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP39_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP39_B_1_0
+#undef IMPL_SEQFOR_ZIP39_B_1_1
+#undef IMPL_SEQFOR_SIMPLE39_A_
+#undef IMPL_SEQFOR_SIMPLE39_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE39_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE39_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE39_B
+#define IMPL_SEQFOR_FOR_GUIDE39_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL39
+#define IMPL_SEQFOR_FOR_GUIDE39_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL39
+#define IMPL_SEQFOR_FAST39_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST39_B
+#define IMPL_SEQFOR_FAST39_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL39
+#define IMPL_SEQFOR_FAST39_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL39
+#define IMPL_SEQFOR_UNTIL39_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL39_B
+#define IMPL_SEQFOR_UNTIL39_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL39
+#define IMPL_SEQFOR_UNTIL39_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL39
+#define IMPL_SEQFOR_UNTIL39_B_1_1 IMPL_SEQFOR_TRACE_STOP39
+#define IMPL_SEQFOR_ZIP39_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL39
+#define IMPL_SEQFOR_ZIP39_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL39
+#define IMPL_SEQFOR_ZIP39_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP39_C
+#define IMPL_SEQFOR_ZIP39_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL39(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE39_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE39_B
+#define IMPL_SEQFOR_SIMPLE39_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE39_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 4 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH4(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH4, 5) IMPL_SEQFOR_IDENTITY4( IMPL_SEQFOR_FOR_GUIDE4_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE4(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE4, 5) IMPL_SEQFOR_IDENTITY4( IMPL_SEQFOR_SIMPLE4_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST4(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST4, 5) IMPL_SEQFOR_IDENTITY4( IMPL_SEQFOR_FAST4_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL4(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL4, 5) IMPL_SEQFOR_IDENTITY4( IMPL_SEQFOR_UNTIL4_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP4(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP4, 5) IMPL_SEQFOR_IDENTITY4( IMPL_SEQFOR_ZIP4_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS4(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS4, 5) IMPL_SEQFOR_IDENTITY4( IMPL_SEQFOR_FOR_GUIDE4_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP4(m, seq) IMPL_SEQFOR_IDENTITY4( IMPL_SEQFOR_MAP4_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER4(p, seq) IMPL_SEQFOR_IDENTITY4( IMPL_SEQFOR_FILTER4_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G4(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G4, 5) IMPL_SEQFOR_FOR_GUIDE4_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G4(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G4, 5) IMPL_SEQFOR_SIMPLE4_A(m, g) )
+#define SF_FOR_EACH_FAST_G4(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G4, 5) IMPL_SEQFOR_FAST4_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G4(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G4, 5) IMPL_SEQFOR_UNTIL4_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G4(m, g) IMPL_SEQFOR_MAP_G4_A(m, g) )
+#define SF_SEQ_FILTER_G4(p, g) IMPL_SEQFOR_FILTER_G4_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY4(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE4_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE4_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE4_A_ IMPL_SEQFOR_FOR_GUIDE4_B
+#define IMPL_SEQFOR_FOR_GUIDE4_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE4_END
+#define IMPL_SEQFOR_FOR_GUIDE4_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE4_END
+#define IMPL_SEQFOR_FOR_GUIDE4_END(m, s, f, d, ...) f(5, d)
+#define IMPL_SEQFOR_FOR_GUIDE4_B(m, s, f, d, ...) m(5, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE4_B_0(m, s, f, s(5, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE4_B_0(...) IMPL_SEQFOR_FOR_GUIDE4_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE4_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE4_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST4_A(m, s, f, d, e) IMPL_SEQFOR_FAST4_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST4_A_ IMPL_SEQFOR_FAST4_B
+#define IMPL_SEQFOR_FAST4_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE4_END
+#define IMPL_SEQFOR_FAST4_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE4_END
+#define IMPL_SEQFOR_FAST4_B(m, s, f, d, ...) m(5, d, __VA_ARGS__) IMPL_SEQFOR_FAST4_A(m, s, f, s(5, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL4_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL4_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL4_A_ IMPL_SEQFOR_UNTIL4_B
+#define IMPL_SEQFOR_UNTIL4_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE4_END
+#define IMPL_SEQFOR_UNTIL4_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE4_END
+#define IMPL_SEQFOR_UNTIL4_B(m, s, f, d, ...) m(5, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL4_B_0(m, s, f, s(5, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL4_B_0(...) IMPL_SEQFOR_UNTIL4_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL4_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL4_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL4_B_1_0 IMPL_SEQFOR_UNTIL4_A
+#define IMPL_SEQFOR_UNTIL4_B_1_1 IMPL_SEQFOR_UNTIL4_STOP
+#define IMPL_SEQFOR_UNTIL4_STOP(m, s, f, d, e) f(5, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP4_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP4_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP4_A_ IMPL_SEQFOR_ZIP4_B
+#define IMPL_SEQFOR_ZIP4_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE4_END
+#define IMPL_SEQFOR_ZIP4_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE4_END
+#define IMPL_SEQFOR_ZIP4_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP4_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP4_B_0(...) IMPL_SEQFOR_ZIP4_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP4_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP4_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP4_B_1_0 IMPL_SEQFOR_ZIP4_C
+#define IMPL_SEQFOR_ZIP4_B_1_1(m, s, f, d, ...) f(5, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP4_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP4_C(m, s, f, d, r, ...) m(5, d, __VA_ARGS__) IMPL_SEQFOR_ZIP4_A(m, s, f, s(5, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE4_A(m, e) IMPL_SEQFOR_SIMPLE4_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE4_A_ IMPL_SEQFOR_SIMPLE4_B
+#define IMPL_SEQFOR_SIMPLE4_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE4_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE4_B(m, ...) m(5, __VA_ARGS__) IMPL_SEQFOR_SIMPLE4_A(m,
+#define IMPL_SEQFOR_MAP4_A(m, e) IMPL_SEQFOR_MAP4_A_##e(m,
+#define IMPL_SEQFOR_MAP4_A_ IMPL_SEQFOR_MAP4_B
+#define IMPL_SEQFOR_MAP4_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP4_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP4_B(m, ...) (m(5, __VA_ARGS__)) IMPL_SEQFOR_MAP4_A(m,
+#define IMPL_SEQFOR_FILTER4_A(p, e) IMPL_SEQFOR_FILTER4_A_##e(p,
+#define IMPL_SEQFOR_FILTER4_A_ IMPL_SEQFOR_FILTER4_B
+#define IMPL_SEQFOR_FILTER4_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER4_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER4_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(5, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER4_A(p,
+#define IMPL_SEQFOR_MAP_G4_A(m, e) IMPL_SEQFOR_MAP_G4_A_##e(m,
+#define IMPL_SEQFOR_MAP_G4_A_ IMPL_SEQFOR_MAP_G4_B
+#define IMPL_SEQFOR_MAP_G4_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G4_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G4_B(m, ...) )m(5, __VA_ARGS__)) IMPL_SEQFOR_MAP_G4_A(m,
+#define IMPL_SEQFOR_FILTER_G4_A(p, e) IMPL_SEQFOR_FILTER_G4_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G4_A_ IMPL_SEQFOR_FILTER_G4_B
+#define IMPL_SEQFOR_FILTER_G4_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G4_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G4_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(5, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G4_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL4(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE4_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP4(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL4(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE4_A_
+#undef IMPL_SEQFOR_FOR_GUIDE4_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE4_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST4_A_
+#undef IMPL_SEQFOR_FAST4_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST4_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL4_A_
+#undef IMPL_SEQFOR_UNTIL4_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL4_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL4_B_1_1
+#undef IMPL_SEQFOR_ZIP4_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP4_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP4_B_1_0
+#undef IMPL_SEQFOR_ZIP4_B_1_1
+#undef IMPL_SEQFOR_SIMPLE4_A_
+#undef IMPL_SEQFOR_SIMPLE4_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE4_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE4_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE4_B
+#define IMPL_SEQFOR_FOR_GUIDE4_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL4
+#define IMPL_SEQFOR_FOR_GUIDE4_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL4
+#define IMPL_SEQFOR_FAST4_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST4_B
+#define IMPL_SEQFOR_FAST4_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL4
+#define IMPL_SEQFOR_FAST4_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL4
+#define IMPL_SEQFOR_UNTIL4_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL4_B
+#define IMPL_SEQFOR_UNTIL4_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL4
+#define IMPL_SEQFOR_UNTIL4_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL4
+#define IMPL_SEQFOR_UNTIL4_B_1_1 IMPL_SEQFOR_TRACE_STOP4
+#define IMPL_SEQFOR_ZIP4_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL4
+#define IMPL_SEQFOR_ZIP4_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL4
+#define IMPL_SEQFOR_ZIP4_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP4_C
+#define IMPL_SEQFOR_ZIP4_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL4(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE4_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE4_B
+#define IMPL_SEQFOR_SIMPLE4_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE4_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 40 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH40(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH40, 41) IMPL_SEQFOR_IDENTITY40( IMPL_SEQFOR_FOR_GUIDE40_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE40(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE40, 41) IMPL_SEQFOR_IDENTITY40( IMPL_SEQFOR_SIMPLE40_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST40(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST40, 41) IMPL_SEQFOR_IDENTITY40( IMPL_SEQFOR_FAST40_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL40(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL40, 41) IMPL_SEQFOR_IDENTITY40( IMPL_SEQFOR_UNTIL40_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP40(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP40, 41) IMPL_SEQFOR_IDENTITY40( IMPL_SEQFOR_ZIP40_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS40(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS40, 41) IMPL_SEQFOR_IDENTITY40( IMPL_SEQFOR_FOR_GUIDE40_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP40(m, seq) IMPL_SEQFOR_IDENTITY40( IMPL_SEQFOR_MAP40_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER40(p, seq) IMPL_SEQFOR_IDENTITY40( IMPL_SEQFOR_FILTER40_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G40(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G40, 41) IMPL_SEQFOR_FOR_GUIDE40_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G40(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G40, 41) IMPL_SEQFOR_SIMPLE40_A(m, g) )
+#define SF_FOR_EACH_FAST_G40(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G40, 41) IMPL_SEQFOR_FAST40_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G40(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G40, 41) IMPL_SEQFOR_UNTIL40_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G40(m, g) IMPL_SEQFOR_MAP_G40_A(m, g) )
+#define SF_SEQ_FILTER_G40(p, g) IMPL_SEQFOR_FILTER_G40_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY40(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE40_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE40_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE40_A_ IMPL_SEQFOR_FOR_GUIDE40_B
+#define IMPL_SEQFOR_FOR_GUIDE40_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE40_END
+#define IMPL_SEQFOR_FOR_GUIDE40_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE40_END
+#define IMPL_SEQFOR_FOR_GUIDE40_END(m, s, f, d, ...) f(41, d)
+#define IMPL_SEQFOR_FOR_GUIDE40_B(m, s, f, d, ...) m(41, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE40_B_0(m, s, f, s(41, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE40_B_0(...) IMPL_SEQFOR_FOR_GUIDE40_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE40_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE40_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST40_A(m, s, f, d, e) IMPL_SEQFOR_FAST40_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST40_A_ IMPL_SEQFOR_FAST40_B
+#define IMPL_SEQFOR_FAST40_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE40_END
+#define IMPL_SEQFOR_FAST40_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE40_END
+#define IMPL_SEQFOR_FAST40_B(m, s, f, d, ...) m(41, d, __VA_ARGS__) IMPL_SEQFOR_FAST40_A(m, s, f, s(41, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL40_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL40_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL40_A_ IMPL_SEQFOR_UNTIL40_B
+#define IMPL_SEQFOR_UNTIL40_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE40_END
+#define IMPL_SEQFOR_UNTIL40_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE40_END
+#define IMPL_SEQFOR_UNTIL40_B(m, s, f, d, ...) m(41, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL40_B_0(m, s, f, s(41, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL40_B_0(...) IMPL_SEQFOR_UNTIL40_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL40_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL40_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL40_B_1_0 IMPL_SEQFOR_UNTIL40_A
+#define IMPL_SEQFOR_UNTIL40_B_1_1 IMPL_SEQFOR_UNTIL40_STOP
+#define IMPL_SEQFOR_UNTIL40_STOP(m, s, f, d, e) f(41, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP40_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP40_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP40_A_ IMPL_SEQFOR_ZIP40_B
+#define IMPL_SEQFOR_ZIP40_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE40_END
+#define IMPL_SEQFOR_ZIP40_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE40_END
+#define IMPL_SEQFOR_ZIP40_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP40_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP40_B_0(...) IMPL_SEQFOR_ZIP40_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP40_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP40_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP40_B_1_0 IMPL_SEQFOR_ZIP40_C
+#define IMPL_SEQFOR_ZIP40_B_1_1(m, s, f, d, ...) f(41, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP40_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP40_C(m, s, f, d, r, ...) m(41, d, __VA_ARGS__) IMPL_SEQFOR_ZIP40_A(m, s, f, s(41, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE40_A(m, e) IMPL_SEQFOR_SIMPLE40_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE40_A_ IMPL_SEQFOR_SIMPLE40_B
+#define IMPL_SEQFOR_SIMPLE40_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE40_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE40_B(m, ...) m(41, __VA_ARGS__) IMPL_SEQFOR_SIMPLE40_A(m,
+#define IMPL_SEQFOR_MAP40_A(m, e) IMPL_SEQFOR_MAP40_A_##e(m,
+#define IMPL_SEQFOR_MAP40_A_ IMPL_SEQFOR_MAP40_B
+#define IMPL_SEQFOR_MAP40_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP40_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP40_B(m, ...) (m(41, __VA_ARGS__)) IMPL_SEQFOR_MAP40_A(m,
+#define IMPL_SEQFOR_FILTER40_A(p, e) IMPL_SEQFOR_FILTER40_A_##e(p,
+#define IMPL_SEQFOR_FILTER40_A_ IMPL_SEQFOR_FILTER40_B
+#define IMPL_SEQFOR_FILTER40_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER40_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER40_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(41, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER40_A(p,
+#define IMPL_SEQFOR_MAP_G40_A(m, e) IMPL_SEQFOR_MAP_G40_A_##e(m,
+#define IMPL_SEQFOR_MAP_G40_A_ IMPL_SEQFOR_MAP_G40_B
+#define IMPL_SEQFOR_MAP_G40_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G40_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G40_B(m, ...) )m(41, __VA_ARGS__)) IMPL_SEQFOR_MAP_G40_A(m,
+#define IMPL_SEQFOR_FILTER_G40_A(p, e) IMPL_SEQFOR_FILTER_G40_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G40_A_ IMPL_SEQFOR_FILTER_G40_B
+#define IMPL_SEQFOR_FILTER_G40_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G40_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G40_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(41, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G40_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL40(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE40_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP40(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL40(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE40_A_
+#undef IMPL_SEQFOR_FOR_GUIDE40_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE40_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST40_A_
+#undef IMPL_SEQFOR_FAST40_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST40_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL40_A_
+#undef IMPL_SEQFOR_UNTIL40_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL40_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL40_B_1_1
+#undef IMPL_SEQFOR_ZIP40_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP40_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP40_B_1_0
+#undef IMPL_SEQFOR_ZIP40_B_1_1
+#undef IMPL_SEQFOR_SIMPLE40_A_
+#undef IMPL_SEQFOR_SIMPLE40_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE40_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE40_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE40_B
+#define IMPL_SEQFOR_FOR_GUIDE40_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL40
+#define IMPL_SEQFOR_FOR_GUIDE40_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL40
+#define IMPL_SEQFOR_FAST40_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST40_B
+#define IMPL_SEQFOR_FAST40_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL40
+#define IMPL_SEQFOR_FAST40_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL40
+#define IMPL_SEQFOR_UNTIL40_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL40_B
+#define IMPL_SEQFOR_UNTIL40_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL40
+#define IMPL_SEQFOR_UNTIL40_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL40
+#define IMPL_SEQFOR_UNTIL40_B_1_1 IMPL_SEQFOR_TRACE_STOP40
+#define IMPL_SEQFOR_ZIP40_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL40
+#define IMPL_SEQFOR_ZIP40_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL40
+#define IMPL_SEQFOR_ZIP40_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP40_C
+#define IMPL_SEQFOR_ZIP40_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL40(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE40_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE40_B
+#define IMPL_SEQFOR_SIMPLE40_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE40_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
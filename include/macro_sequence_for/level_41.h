@@ -0,0 +1,113 @@
+// Nesting level 41 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH41(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH41, 42) IMPL_SEQFOR_IDENTITY41( IMPL_SEQFOR_FOR_GUIDE41_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE41(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE41, 42) IMPL_SEQFOR_IDENTITY41( IMPL_SEQFOR_SIMPLE41_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST41(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST41, 42) IMPL_SEQFOR_IDENTITY41( IMPL_SEQFOR_FAST41_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL41(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL41, 42) IMPL_SEQFOR_IDENTITY41( IMPL_SEQFOR_UNTIL41_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP41(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP41, 42) IMPL_SEQFOR_IDENTITY41( IMPL_SEQFOR_ZIP41_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS41(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS41, 42) IMPL_SEQFOR_IDENTITY41( IMPL_SEQFOR_FOR_GUIDE41_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP41(m, seq) IMPL_SEQFOR_IDENTITY41( IMPL_SEQFOR_MAP41_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER41(p, seq) IMPL_SEQFOR_IDENTITY41( IMPL_SEQFOR_FILTER41_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G41(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G41, 42) IMPL_SEQFOR_FOR_GUIDE41_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G41(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G41, 42) IMPL_SEQFOR_SIMPLE41_A(m, g) )
+#define SF_FOR_EACH_FAST_G41(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G41, 42) IMPL_SEQFOR_FAST41_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G41(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G41, 42) IMPL_SEQFOR_UNTIL41_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G41(m, g) IMPL_SEQFOR_MAP_G41_A(m, g) )
+#define SF_SEQ_FILTER_G41(p, g) IMPL_SEQFOR_FILTER_G41_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY41(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE41_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE41_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE41_A_ IMPL_SEQFOR_FOR_GUIDE41_B
+#define IMPL_SEQFOR_FOR_GUIDE41_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE41_END
+#define IMPL_SEQFOR_FOR_GUIDE41_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE41_END
+#define IMPL_SEQFOR_FOR_GUIDE41_END(m, s, f, d, ...) f(42, d)
+#define IMPL_SEQFOR_FOR_GUIDE41_B(m, s, f, d, ...) m(42, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE41_B_0(m, s, f, s(42, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE41_B_0(...) IMPL_SEQFOR_FOR_GUIDE41_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE41_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE41_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST41_A(m, s, f, d, e) IMPL_SEQFOR_FAST41_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST41_A_ IMPL_SEQFOR_FAST41_B
+#define IMPL_SEQFOR_FAST41_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE41_END
+#define IMPL_SEQFOR_FAST41_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE41_END
+#define IMPL_SEQFOR_FAST41_B(m, s, f, d, ...) m(42, d, __VA_ARGS__) IMPL_SEQFOR_FAST41_A(m, s, f, s(42, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL41_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL41_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL41_A_ IMPL_SEQFOR_UNTIL41_B
+#define IMPL_SEQFOR_UNTIL41_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE41_END
+#define IMPL_SEQFOR_UNTIL41_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE41_END
+#define IMPL_SEQFOR_UNTIL41_B(m, s, f, d, ...) m(42, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL41_B_0(m, s, f, s(42, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL41_B_0(...) IMPL_SEQFOR_UNTIL41_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL41_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL41_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL41_B_1_0 IMPL_SEQFOR_UNTIL41_A
+#define IMPL_SEQFOR_UNTIL41_B_1_1 IMPL_SEQFOR_UNTIL41_STOP
+#define IMPL_SEQFOR_UNTIL41_STOP(m, s, f, d, e) f(42, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP41_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP41_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP41_A_ IMPL_SEQFOR_ZIP41_B
+#define IMPL_SEQFOR_ZIP41_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE41_END
+#define IMPL_SEQFOR_ZIP41_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE41_END
+#define IMPL_SEQFOR_ZIP41_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP41_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP41_B_0(...) IMPL_SEQFOR_ZIP41_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP41_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP41_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP41_B_1_0 IMPL_SEQFOR_ZIP41_C
+#define IMPL_SEQFOR_ZIP41_B_1_1(m, s, f, d, ...) f(42, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP41_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP41_C(m, s, f, d, r, ...) m(42, d, __VA_ARGS__) IMPL_SEQFOR_ZIP41_A(m, s, f, s(42, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE41_A(m, e) IMPL_SEQFOR_SIMPLE41_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE41_A_ IMPL_SEQFOR_SIMPLE41_B
+#define IMPL_SEQFOR_SIMPLE41_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE41_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE41_B(m, ...) m(42, __VA_ARGS__) IMPL_SEQFOR_SIMPLE41_A(m,
+#define IMPL_SEQFOR_MAP41_A(m, e) IMPL_SEQFOR_MAP41_A_##e(m,
+#define IMPL_SEQFOR_MAP41_A_ IMPL_SEQFOR_MAP41_B
+#define IMPL_SEQFOR_MAP41_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP41_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP41_B(m, ...) (m(42, __VA_ARGS__)) IMPL_SEQFOR_MAP41_A(m,
+#define IMPL_SEQFOR_FILTER41_A(p, e) IMPL_SEQFOR_FILTER41_A_##e(p,
+#define IMPL_SEQFOR_FILTER41_A_ IMPL_SEQFOR_FILTER41_B
+#define IMPL_SEQFOR_FILTER41_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER41_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER41_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(42, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER41_A(p,
+#define IMPL_SEQFOR_MAP_G41_A(m, e) IMPL_SEQFOR_MAP_G41_A_##e(m,
+#define IMPL_SEQFOR_MAP_G41_A_ IMPL_SEQFOR_MAP_G41_B
+#define IMPL_SEQFOR_MAP_G41_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G41_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G41_B(m, ...) )m(42, __VA_ARGS__)) IMPL_SEQFOR_MAP_G41_A(m,
+#define IMPL_SEQFOR_FILTER_G41_A(p, e) IMPL_SEQFOR_FILTER_G41_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G41_A_ IMPL_SEQFOR_FILTER_G41_B
+#define IMPL_SEQFOR_FILTER_G41_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G41_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G41_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(42, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G41_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL41(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE41_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP41(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL41(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE41_A_
+#undef IMPL_SEQFOR_FOR_GUIDE41_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE41_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST41_A_
+#undef IMPL_SEQFOR_FAST41_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST41_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL41_A_
+#undef IMPL_SEQFOR_UNTIL41_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL41_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL41_B_1_1
+#undef IMPL_SEQFOR_ZIP41_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP41_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP41_B_1_0
+#undef IMPL_SEQFOR_ZIP41_B_1_1
+#undef IMPL_SEQFOR_SIMPLE41_A_
+#undef IMPL_SEQFOR_SIMPLE41_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE41_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE41_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE41_B
+#define IMPL_SEQFOR_FOR_GUIDE41_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL41
+#define IMPL_SEQFOR_FOR_GUIDE41_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL41
+#define IMPL_SEQFOR_FAST41_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST41_B
+#define IMPL_SEQFOR_FAST41_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL41
+#define IMPL_SEQFOR_FAST41_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL41
+#define IMPL_SEQFOR_UNTIL41_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL41_B
+#define IMPL_SEQFOR_UNTIL41_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL41
+#define IMPL_SEQFOR_UNTIL41_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL41
+#define IMPL_SEQFOR_UNTIL41_B_1_1 IMPL_SEQFOR_TRACE_STOP41
+#define IMPL_SEQFOR_ZIP41_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL41
+#define IMPL_SEQFOR_ZIP41_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL41
+#define IMPL_SEQFOR_ZIP41_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP41_C
+#define IMPL_SEQFOR_ZIP41_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL41(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE41_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE41_B
+#define IMPL_SEQFOR_SIMPLE41_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE41_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 42 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH42(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH42, 43) IMPL_SEQFOR_IDENTITY42( IMPL_SEQFOR_FOR_GUIDE42_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE42(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE42, 43) IMPL_SEQFOR_IDENTITY42( IMPL_SEQFOR_SIMPLE42_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST42(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST42, 43) IMPL_SEQFOR_IDENTITY42( IMPL_SEQFOR_FAST42_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL42(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL42, 43) IMPL_SEQFOR_IDENTITY42( IMPL_SEQFOR_UNTIL42_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP42(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP42, 43) IMPL_SEQFOR_IDENTITY42( IMPL_SEQFOR_ZIP42_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS42(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS42, 43) IMPL_SEQFOR_IDENTITY42( IMPL_SEQFOR_FOR_GUIDE42_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP42(m, seq) IMPL_SEQFOR_IDENTITY42( IMPL_SEQFOR_MAP42_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER42(p, seq) IMPL_SEQFOR_IDENTITY42( IMPL_SEQFOR_FILTER42_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G42(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G42, 43) IMPL_SEQFOR_FOR_GUIDE42_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G42(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G42, 43) IMPL_SEQFOR_SIMPLE42_A(m, g) )
+#define SF_FOR_EACH_FAST_G42(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G42, 43) IMPL_SEQFOR_FAST42_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G42(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G42, 43) IMPL_SEQFOR_UNTIL42_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G42(m, g) IMPL_SEQFOR_MAP_G42_A(m, g) )
+#define SF_SEQ_FILTER_G42(p, g) IMPL_SEQFOR_FILTER_G42_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY42(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE42_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE42_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE42_A_ IMPL_SEQFOR_FOR_GUIDE42_B
+#define IMPL_SEQFOR_FOR_GUIDE42_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE42_END
+#define IMPL_SEQFOR_FOR_GUIDE42_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE42_END
+#define IMPL_SEQFOR_FOR_GUIDE42_END(m, s, f, d, ...) f(43, d)
+#define IMPL_SEQFOR_FOR_GUIDE42_B(m, s, f, d, ...) m(43, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE42_B_0(m, s, f, s(43, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE42_B_0(...) IMPL_SEQFOR_FOR_GUIDE42_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE42_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE42_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST42_A(m, s, f, d, e) IMPL_SEQFOR_FAST42_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST42_A_ IMPL_SEQFOR_FAST42_B
+#define IMPL_SEQFOR_FAST42_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE42_END
+#define IMPL_SEQFOR_FAST42_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE42_END
+#define IMPL_SEQFOR_FAST42_B(m, s, f, d, ...) m(43, d, __VA_ARGS__) IMPL_SEQFOR_FAST42_A(m, s, f, s(43, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL42_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL42_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL42_A_ IMPL_SEQFOR_UNTIL42_B
+#define IMPL_SEQFOR_UNTIL42_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE42_END
+#define IMPL_SEQFOR_UNTIL42_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE42_END
+#define IMPL_SEQFOR_UNTIL42_B(m, s, f, d, ...) m(43, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL42_B_0(m, s, f, s(43, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL42_B_0(...) IMPL_SEQFOR_UNTIL42_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL42_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL42_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL42_B_1_0 IMPL_SEQFOR_UNTIL42_A
+#define IMPL_SEQFOR_UNTIL42_B_1_1 IMPL_SEQFOR_UNTIL42_STOP
+#define IMPL_SEQFOR_UNTIL42_STOP(m, s, f, d, e) f(43, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP42_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP42_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP42_A_ IMPL_SEQFOR_ZIP42_B
+#define IMPL_SEQFOR_ZIP42_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE42_END
+#define IMPL_SEQFOR_ZIP42_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE42_END
+#define IMPL_SEQFOR_ZIP42_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP42_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP42_B_0(...) IMPL_SEQFOR_ZIP42_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP42_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP42_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP42_B_1_0 IMPL_SEQFOR_ZIP42_C
+#define IMPL_SEQFOR_ZIP42_B_1_1(m, s, f, d, ...) f(43, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP42_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP42_C(m, s, f, d, r, ...) m(43, d, __VA_ARGS__) IMPL_SEQFOR_ZIP42_A(m, s, f, s(43, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE42_A(m, e) IMPL_SEQFOR_SIMPLE42_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE42_A_ IMPL_SEQFOR_SIMPLE42_B
+#define IMPL_SEQFOR_SIMPLE42_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE42_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE42_B(m, ...) m(43, __VA_ARGS__) IMPL_SEQFOR_SIMPLE42_A(m,
+#define IMPL_SEQFOR_MAP42_A(m, e) IMPL_SEQFOR_MAP42_A_##e(m,
+#define IMPL_SEQFOR_MAP42_A_ IMPL_SEQFOR_MAP42_B
+#define IMPL_SEQFOR_MAP42_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP42_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP42_B(m, ...) (m(43, __VA_ARGS__)) IMPL_SEQFOR_MAP42_A(m,
+#define IMPL_SEQFOR_FILTER42_A(p, e) IMPL_SEQFOR_FILTER42_A_##e(p,
+#define IMPL_SEQFOR_FILTER42_A_ IMPL_SEQFOR_FILTER42_B
+#define IMPL_SEQFOR_FILTER42_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER42_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER42_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(43, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER42_A(p,
+#define IMPL_SEQFOR_MAP_G42_A(m, e) IMPL_SEQFOR_MAP_G42_A_##e(m,
+#define IMPL_SEQFOR_MAP_G42_A_ IMPL_SEQFOR_MAP_G42_B
+#define IMPL_SEQFOR_MAP_G42_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G42_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G42_B(m, ...) )m(43, __VA_ARGS__)) IMPL_SEQFOR_MAP_G42_A(m,
+#define IMPL_SEQFOR_FILTER_G42_A(p, e) IMPL_SEQFOR_FILTER_G42_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G42_A_ IMPL_SEQFOR_FILTER_G42_B
+#define IMPL_SEQFOR_FILTER_G42_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G42_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G42_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(43, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G42_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL42(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE42_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP42(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL42(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE42_A_
+#undef IMPL_SEQFOR_FOR_GUIDE42_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE42_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST42_A_
+#undef IMPL_SEQFOR_FAST42_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST42_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL42_A_
+#undef IMPL_SEQFOR_UNTIL42_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL42_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL42_B_1_1
+#undef IMPL_SEQFOR_ZIP42_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP42_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP42_B_1_0
+#undef IMPL_SEQFOR_ZIP42_B_1_1
+#undef IMPL_SEQFOR_SIMPLE42_A_
+#undef IMPL_SEQFOR_SIMPLE42_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE42_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE42_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE42_B
+#define IMPL_SEQFOR_FOR_GUIDE42_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL42
+#define IMPL_SEQFOR_FOR_GUIDE42_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL42
+#define IMPL_SEQFOR_FAST42_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST42_B
+#define IMPL_SEQFOR_FAST42_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL42
+#define IMPL_SEQFOR_FAST42_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL42
+#define IMPL_SEQFOR_UNTIL42_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL42_B
+#define IMPL_SEQFOR_UNTIL42_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL42
+#define IMPL_SEQFOR_UNTIL42_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL42
+#define IMPL_SEQFOR_UNTIL42_B_1_1 IMPL_SEQFOR_TRACE_STOP42
+#define IMPL_SEQFOR_ZIP42_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL42
+#define IMPL_SEQFOR_ZIP42_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL42
+#define IMPL_SEQFOR_ZIP42_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP42_C
+#define IMPL_SEQFOR_ZIP42_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL42(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE42_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE42_B
+#define IMPL_SEQFOR_SIMPLE42_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE42_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 43 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH43(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH43, 44) IMPL_SEQFOR_IDENTITY43( IMPL_SEQFOR_FOR_GUIDE43_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE43(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE43, 44) IMPL_SEQFOR_IDENTITY43( IMPL_SEQFOR_SIMPLE43_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST43(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST43, 44) IMPL_SEQFOR_IDENTITY43( IMPL_SEQFOR_FAST43_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL43(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL43, 44) IMPL_SEQFOR_IDENTITY43( IMPL_SEQFOR_UNTIL43_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP43(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP43, 44) IMPL_SEQFOR_IDENTITY43( IMPL_SEQFOR_ZIP43_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS43(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS43, 44) IMPL_SEQFOR_IDENTITY43( IMPL_SEQFOR_FOR_GUIDE43_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP43(m, seq) IMPL_SEQFOR_IDENTITY43( IMPL_SEQFOR_MAP43_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER43(p, seq) IMPL_SEQFOR_IDENTITY43( IMPL_SEQFOR_FILTER43_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G43(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G43, 44) IMPL_SEQFOR_FOR_GUIDE43_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G43(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G43, 44) IMPL_SEQFOR_SIMPLE43_A(m, g) )
+#define SF_FOR_EACH_FAST_G43(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G43, 44) IMPL_SEQFOR_FAST43_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G43(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G43, 44) IMPL_SEQFOR_UNTIL43_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G43(m, g) IMPL_SEQFOR_MAP_G43_A(m, g) )
+#define SF_SEQ_FILTER_G43(p, g) IMPL_SEQFOR_FILTER_G43_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY43(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE43_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE43_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE43_A_ IMPL_SEQFOR_FOR_GUIDE43_B
+#define IMPL_SEQFOR_FOR_GUIDE43_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE43_END
+#define IMPL_SEQFOR_FOR_GUIDE43_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE43_END
+#define IMPL_SEQFOR_FOR_GUIDE43_END(m, s, f, d, ...) f(44, d)
+#define IMPL_SEQFOR_FOR_GUIDE43_B(m, s, f, d, ...) m(44, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE43_B_0(m, s, f, s(44, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE43_B_0(...) IMPL_SEQFOR_FOR_GUIDE43_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE43_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE43_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST43_A(m, s, f, d, e) IMPL_SEQFOR_FAST43_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST43_A_ IMPL_SEQFOR_FAST43_B
+#define IMPL_SEQFOR_FAST43_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE43_END
+#define IMPL_SEQFOR_FAST43_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE43_END
+#define IMPL_SEQFOR_FAST43_B(m, s, f, d, ...) m(44, d, __VA_ARGS__) IMPL_SEQFOR_FAST43_A(m, s, f, s(44, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL43_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL43_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL43_A_ IMPL_SEQFOR_UNTIL43_B
+#define IMPL_SEQFOR_UNTIL43_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE43_END
+#define IMPL_SEQFOR_UNTIL43_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE43_END
+#define IMPL_SEQFOR_UNTIL43_B(m, s, f, d, ...) m(44, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL43_B_0(m, s, f, s(44, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL43_B_0(...) IMPL_SEQFOR_UNTIL43_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL43_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL43_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL43_B_1_0 IMPL_SEQFOR_UNTIL43_A
+#define IMPL_SEQFOR_UNTIL43_B_1_1 IMPL_SEQFOR_UNTIL43_STOP
+#define IMPL_SEQFOR_UNTIL43_STOP(m, s, f, d, e) f(44, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP43_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP43_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP43_A_ IMPL_SEQFOR_ZIP43_B
+#define IMPL_SEQFOR_ZIP43_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE43_END
+#define IMPL_SEQFOR_ZIP43_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE43_END
+#define IMPL_SEQFOR_ZIP43_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP43_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP43_B_0(...) IMPL_SEQFOR_ZIP43_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP43_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP43_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP43_B_1_0 IMPL_SEQFOR_ZIP43_C
+#define IMPL_SEQFOR_ZIP43_B_1_1(m, s, f, d, ...) f(44, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP43_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP43_C(m, s, f, d, r, ...) m(44, d, __VA_ARGS__) IMPL_SEQFOR_ZIP43_A(m, s, f, s(44, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE43_A(m, e) IMPL_SEQFOR_SIMPLE43_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE43_A_ IMPL_SEQFOR_SIMPLE43_B
+#define IMPL_SEQFOR_SIMPLE43_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE43_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE43_B(m, ...) m(44, __VA_ARGS__) IMPL_SEQFOR_SIMPLE43_A(m,
+#define IMPL_SEQFOR_MAP43_A(m, e) IMPL_SEQFOR_MAP43_A_##e(m,
+#define IMPL_SEQFOR_MAP43_A_ IMPL_SEQFOR_MAP43_B
+#define IMPL_SEQFOR_MAP43_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP43_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP43_B(m, ...) (m(44, __VA_ARGS__)) IMPL_SEQFOR_MAP43_A(m,
+#define IMPL_SEQFOR_FILTER43_A(p, e) IMPL_SEQFOR_FILTER43_A_##e(p,
+#define IMPL_SEQFOR_FILTER43_A_ IMPL_SEQFOR_FILTER43_B
+#define IMPL_SEQFOR_FILTER43_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER43_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER43_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(44, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER43_A(p,
+#define IMPL_SEQFOR_MAP_G43_A(m, e) IMPL_SEQFOR_MAP_G43_A_##e(m,
+#define IMPL_SEQFOR_MAP_G43_A_ IMPL_SEQFOR_MAP_G43_B
+#define IMPL_SEQFOR_MAP_G43_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G43_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G43_B(m, ...) )m(44, __VA_ARGS__)) IMPL_SEQFOR_MAP_G43_A(m,
+#define IMPL_SEQFOR_FILTER_G43_A(p, e) IMPL_SEQFOR_FILTER_G43_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G43_A_ IMPL_SEQFOR_FILTER_G43_B
+#define IMPL_SEQFOR_FILTER_G43_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G43_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G43_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(44, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G43_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL43(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE43_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP43(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL43(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE43_A_
+#undef IMPL_SEQFOR_FOR_GUIDE43_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE43_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST43_A_
+#undef IMPL_SEQFOR_FAST43_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST43_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL43_A_
+#undef IMPL_SEQFOR_UNTIL43_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL43_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL43_B_1_1
+#undef IMPL_SEQFOR_ZIP43_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP43_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP43_B_1_0
+#undef IMPL_SEQFOR_ZIP43_B_1_1
+#undef IMPL_SEQFOR_SIMPLE43_A_
+#undef IMPL_SEQFOR_SIMPLE43_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE43_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE43_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE43_B
+#define IMPL_SEQFOR_FOR_GUIDE43_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL43
+#define IMPL_SEQFOR_FOR_GUIDE43_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL43
+#define IMPL_SEQFOR_FAST43_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST43_B
+#define IMPL_SEQFOR_FAST43_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL43
+#define IMPL_SEQFOR_FAST43_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL43
+#define IMPL_SEQFOR_UNTIL43_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL43_B
+#define IMPL_SEQFOR_UNTIL43_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL43
+#define IMPL_SEQFOR_UNTIL43_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL43
+#define IMPL_SEQFOR_UNTIL43_B_1_1 IMPL_SEQFOR_TRACE_STOP43
+#define IMPL_SEQFOR_ZIP43_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL43
+#define IMPL_SEQFOR_ZIP43_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL43
+#define IMPL_SEQFOR_ZIP43_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP43_C
+#define IMPL_SEQFOR_ZIP43_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL43(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE43_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE43_B
+#define IMPL_SEQFOR_SIMPLE43_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE43_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
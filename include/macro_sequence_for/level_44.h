@@ -0,0 +1,113 @@
+// Nesting level 44 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH44(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH44, 45) IMPL_SEQFOR_IDENTITY44( IMPL_SEQFOR_FOR_GUIDE44_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE44(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE44, 45) IMPL_SEQFOR_IDENTITY44( IMPL_SEQFOR_SIMPLE44_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST44(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST44, 45) IMPL_SEQFOR_IDENTITY44( IMPL_SEQFOR_FAST44_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL44(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL44, 45) IMPL_SEQFOR_IDENTITY44( IMPL_SEQFOR_UNTIL44_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP44(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP44, 45) IMPL_SEQFOR_IDENTITY44( IMPL_SEQFOR_ZIP44_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS44(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS44, 45) IMPL_SEQFOR_IDENTITY44( IMPL_SEQFOR_FOR_GUIDE44_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP44(m, seq) IMPL_SEQFOR_IDENTITY44( IMPL_SEQFOR_MAP44_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER44(p, seq) IMPL_SEQFOR_IDENTITY44( IMPL_SEQFOR_FILTER44_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G44(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G44, 45) IMPL_SEQFOR_FOR_GUIDE44_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G44(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G44, 45) IMPL_SEQFOR_SIMPLE44_A(m, g) )
+#define SF_FOR_EACH_FAST_G44(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G44, 45) IMPL_SEQFOR_FAST44_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G44(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G44, 45) IMPL_SEQFOR_UNTIL44_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G44(m, g) IMPL_SEQFOR_MAP_G44_A(m, g) )
+#define SF_SEQ_FILTER_G44(p, g) IMPL_SEQFOR_FILTER_G44_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY44(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE44_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE44_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE44_A_ IMPL_SEQFOR_FOR_GUIDE44_B
+#define IMPL_SEQFOR_FOR_GUIDE44_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE44_END
+#define IMPL_SEQFOR_FOR_GUIDE44_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE44_END
+#define IMPL_SEQFOR_FOR_GUIDE44_END(m, s, f, d, ...) f(45, d)
+#define IMPL_SEQFOR_FOR_GUIDE44_B(m, s, f, d, ...) m(45, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE44_B_0(m, s, f, s(45, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE44_B_0(...) IMPL_SEQFOR_FOR_GUIDE44_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE44_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE44_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST44_A(m, s, f, d, e) IMPL_SEQFOR_FAST44_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST44_A_ IMPL_SEQFOR_FAST44_B
+#define IMPL_SEQFOR_FAST44_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE44_END
+#define IMPL_SEQFOR_FAST44_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE44_END
+#define IMPL_SEQFOR_FAST44_B(m, s, f, d, ...) m(45, d, __VA_ARGS__) IMPL_SEQFOR_FAST44_A(m, s, f, s(45, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL44_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL44_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL44_A_ IMPL_SEQFOR_UNTIL44_B
+#define IMPL_SEQFOR_UNTIL44_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE44_END
+#define IMPL_SEQFOR_UNTIL44_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE44_END
+#define IMPL_SEQFOR_UNTIL44_B(m, s, f, d, ...) m(45, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL44_B_0(m, s, f, s(45, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL44_B_0(...) IMPL_SEQFOR_UNTIL44_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL44_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL44_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL44_B_1_0 IMPL_SEQFOR_UNTIL44_A
+#define IMPL_SEQFOR_UNTIL44_B_1_1 IMPL_SEQFOR_UNTIL44_STOP
+#define IMPL_SEQFOR_UNTIL44_STOP(m, s, f, d, e) f(45, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP44_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP44_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP44_A_ IMPL_SEQFOR_ZIP44_B
+#define IMPL_SEQFOR_ZIP44_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE44_END
+#define IMPL_SEQFOR_ZIP44_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE44_END
+#define IMPL_SEQFOR_ZIP44_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP44_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP44_B_0(...) IMPL_SEQFOR_ZIP44_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP44_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP44_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP44_B_1_0 IMPL_SEQFOR_ZIP44_C
+#define IMPL_SEQFOR_ZIP44_B_1_1(m, s, f, d, ...) f(45, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP44_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP44_C(m, s, f, d, r, ...) m(45, d, __VA_ARGS__) IMPL_SEQFOR_ZIP44_A(m, s, f, s(45, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE44_A(m, e) IMPL_SEQFOR_SIMPLE44_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE44_A_ IMPL_SEQFOR_SIMPLE44_B
+#define IMPL_SEQFOR_SIMPLE44_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE44_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE44_B(m, ...) m(45, __VA_ARGS__) IMPL_SEQFOR_SIMPLE44_A(m,
+#define IMPL_SEQFOR_MAP44_A(m, e) IMPL_SEQFOR_MAP44_A_##e(m,
+#define IMPL_SEQFOR_MAP44_A_ IMPL_SEQFOR_MAP44_B
+#define IMPL_SEQFOR_MAP44_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP44_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP44_B(m, ...) (m(45, __VA_ARGS__)) IMPL_SEQFOR_MAP44_A(m,
+#define IMPL_SEQFOR_FILTER44_A(p, e) IMPL_SEQFOR_FILTER44_A_##e(p,
+#define IMPL_SEQFOR_FILTER44_A_ IMPL_SEQFOR_FILTER44_B
+#define IMPL_SEQFOR_FILTER44_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER44_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER44_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(45, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER44_A(p,
+#define IMPL_SEQFOR_MAP_G44_A(m, e) IMPL_SEQFOR_MAP_G44_A_##e(m,
+#define IMPL_SEQFOR_MAP_G44_A_ IMPL_SEQFOR_MAP_G44_B
+#define IMPL_SEQFOR_MAP_G44_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G44_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G44_B(m, ...) )m(45, __VA_ARGS__)) IMPL_SEQFOR_MAP_G44_A(m,
+#define IMPL_SEQFOR_FILTER_G44_A(p, e) IMPL_SEQFOR_FILTER_G44_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G44_A_ IMPL_SEQFOR_FILTER_G44_B
+#define IMPL_SEQFOR_FILTER_G44_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G44_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G44_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(45, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G44_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL44(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE44_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP44(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL44(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE44_A_
+#undef IMPL_SEQFOR_FOR_GUIDE44_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE44_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST44_A_
+#undef IMPL_SEQFOR_FAST44_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST44_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL44_A_
+#undef IMPL_SEQFOR_UNTIL44_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL44_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL44_B_1_1
+#undef IMPL_SEQFOR_ZIP44_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP44_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP44_B_1_0
+#undef IMPL_SEQFOR_ZIP44_B_1_1
+#undef IMPL_SEQFOR_SIMPLE44_A_
+#undef IMPL_SEQFOR_SIMPLE44_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE44_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE44_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE44_B
+#define IMPL_SEQFOR_FOR_GUIDE44_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL44
+#define IMPL_SEQFOR_FOR_GUIDE44_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL44
+#define IMPL_SEQFOR_FAST44_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST44_B
+#define IMPL_SEQFOR_FAST44_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL44
+#define IMPL_SEQFOR_FAST44_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL44
+#define IMPL_SEQFOR_UNTIL44_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL44_B
+#define IMPL_SEQFOR_UNTIL44_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL44
+#define IMPL_SEQFOR_UNTIL44_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL44
+#define IMPL_SEQFOR_UNTIL44_B_1_1 IMPL_SEQFOR_TRACE_STOP44
+#define IMPL_SEQFOR_ZIP44_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL44
+#define IMPL_SEQFOR_ZIP44_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL44
+#define IMPL_SEQFOR_ZIP44_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP44_C
+#define IMPL_SEQFOR_ZIP44_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL44(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE44_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE44_B
+#define IMPL_SEQFOR_SIMPLE44_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE44_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
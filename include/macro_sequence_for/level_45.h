@@ -0,0 +1,113 @@
+// Nesting level 45 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH45(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH45, 46) IMPL_SEQFOR_IDENTITY45( IMPL_SEQFOR_FOR_GUIDE45_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE45(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE45, 46) IMPL_SEQFOR_IDENTITY45( IMPL_SEQFOR_SIMPLE45_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST45(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST45, 46) IMPL_SEQFOR_IDENTITY45( IMPL_SEQFOR_FAST45_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL45(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL45, 46) IMPL_SEQFOR_IDENTITY45( IMPL_SEQFOR_UNTIL45_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP45(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP45, 46) IMPL_SEQFOR_IDENTITY45( IMPL_SEQFOR_ZIP45_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS45(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS45, 46) IMPL_SEQFOR_IDENTITY45( IMPL_SEQFOR_FOR_GUIDE45_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP45(m, seq) IMPL_SEQFOR_IDENTITY45( IMPL_SEQFOR_MAP45_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER45(p, seq) IMPL_SEQFOR_IDENTITY45( IMPL_SEQFOR_FILTER45_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G45(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G45, 46) IMPL_SEQFOR_FOR_GUIDE45_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G45(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G45, 46) IMPL_SEQFOR_SIMPLE45_A(m, g) )
+#define SF_FOR_EACH_FAST_G45(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G45, 46) IMPL_SEQFOR_FAST45_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G45(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G45, 46) IMPL_SEQFOR_UNTIL45_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G45(m, g) IMPL_SEQFOR_MAP_G45_A(m, g) )
+#define SF_SEQ_FILTER_G45(p, g) IMPL_SEQFOR_FILTER_G45_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY45(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE45_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE45_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE45_A_ IMPL_SEQFOR_FOR_GUIDE45_B
+#define IMPL_SEQFOR_FOR_GUIDE45_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE45_END
+#define IMPL_SEQFOR_FOR_GUIDE45_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE45_END
+#define IMPL_SEQFOR_FOR_GUIDE45_END(m, s, f, d, ...) f(46, d)
+#define IMPL_SEQFOR_FOR_GUIDE45_B(m, s, f, d, ...) m(46, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE45_B_0(m, s, f, s(46, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE45_B_0(...) IMPL_SEQFOR_FOR_GUIDE45_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE45_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE45_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST45_A(m, s, f, d, e) IMPL_SEQFOR_FAST45_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST45_A_ IMPL_SEQFOR_FAST45_B
+#define IMPL_SEQFOR_FAST45_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE45_END
+#define IMPL_SEQFOR_FAST45_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE45_END
+#define IMPL_SEQFOR_FAST45_B(m, s, f, d, ...) m(46, d, __VA_ARGS__) IMPL_SEQFOR_FAST45_A(m, s, f, s(46, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL45_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL45_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL45_A_ IMPL_SEQFOR_UNTIL45_B
+#define IMPL_SEQFOR_UNTIL45_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE45_END
+#define IMPL_SEQFOR_UNTIL45_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE45_END
+#define IMPL_SEQFOR_UNTIL45_B(m, s, f, d, ...) m(46, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL45_B_0(m, s, f, s(46, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL45_B_0(...) IMPL_SEQFOR_UNTIL45_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL45_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL45_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL45_B_1_0 IMPL_SEQFOR_UNTIL45_A
+#define IMPL_SEQFOR_UNTIL45_B_1_1 IMPL_SEQFOR_UNTIL45_STOP
+#define IMPL_SEQFOR_UNTIL45_STOP(m, s, f, d, e) f(46, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP45_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP45_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP45_A_ IMPL_SEQFOR_ZIP45_B
+#define IMPL_SEQFOR_ZIP45_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE45_END
+#define IMPL_SEQFOR_ZIP45_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE45_END
+#define IMPL_SEQFOR_ZIP45_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP45_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP45_B_0(...) IMPL_SEQFOR_ZIP45_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP45_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP45_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP45_B_1_0 IMPL_SEQFOR_ZIP45_C
+#define IMPL_SEQFOR_ZIP45_B_1_1(m, s, f, d, ...) f(46, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP45_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP45_C(m, s, f, d, r, ...) m(46, d, __VA_ARGS__) IMPL_SEQFOR_ZIP45_A(m, s, f, s(46, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE45_A(m, e) IMPL_SEQFOR_SIMPLE45_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE45_A_ IMPL_SEQFOR_SIMPLE45_B
+#define IMPL_SEQFOR_SIMPLE45_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE45_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE45_B(m, ...) m(46, __VA_ARGS__) IMPL_SEQFOR_SIMPLE45_A(m,
+#define IMPL_SEQFOR_MAP45_A(m, e) IMPL_SEQFOR_MAP45_A_##e(m,
+#define IMPL_SEQFOR_MAP45_A_ IMPL_SEQFOR_MAP45_B
+#define IMPL_SEQFOR_MAP45_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP45_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP45_B(m, ...) (m(46, __VA_ARGS__)) IMPL_SEQFOR_MAP45_A(m,
+#define IMPL_SEQFOR_FILTER45_A(p, e) IMPL_SEQFOR_FILTER45_A_##e(p,
+#define IMPL_SEQFOR_FILTER45_A_ IMPL_SEQFOR_FILTER45_B
+#define IMPL_SEQFOR_FILTER45_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER45_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER45_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(46, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER45_A(p,
+#define IMPL_SEQFOR_MAP_G45_A(m, e) IMPL_SEQFOR_MAP_G45_A_##e(m,
+#define IMPL_SEQFOR_MAP_G45_A_ IMPL_SEQFOR_MAP_G45_B
+#define IMPL_SEQFOR_MAP_G45_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G45_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G45_B(m, ...) )m(46, __VA_ARGS__)) IMPL_SEQFOR_MAP_G45_A(m,
+#define IMPL_SEQFOR_FILTER_G45_A(p, e) IMPL_SEQFOR_FILTER_G45_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G45_A_ IMPL_SEQFOR_FILTER_G45_B
+#define IMPL_SEQFOR_FILTER_G45_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G45_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G45_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(46, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G45_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL45(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE45_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP45(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL45(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE45_A_
+#undef IMPL_SEQFOR_FOR_GUIDE45_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE45_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST45_A_
+#undef IMPL_SEQFOR_FAST45_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST45_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL45_A_
+#undef IMPL_SEQFOR_UNTIL45_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL45_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL45_B_1_1
+#undef IMPL_SEQFOR_ZIP45_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP45_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP45_B_1_0
+#undef IMPL_SEQFOR_ZIP45_B_1_1
+#undef IMPL_SEQFOR_SIMPLE45_A_
+#undef IMPL_SEQFOR_SIMPLE45_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE45_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE45_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE45_B
+#define IMPL_SEQFOR_FOR_GUIDE45_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL45
+#define IMPL_SEQFOR_FOR_GUIDE45_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL45
+#define IMPL_SEQFOR_FAST45_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST45_B
+#define IMPL_SEQFOR_FAST45_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL45
+#define IMPL_SEQFOR_FAST45_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL45
+#define IMPL_SEQFOR_UNTIL45_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL45_B
+#define IMPL_SEQFOR_UNTIL45_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL45
+#define IMPL_SEQFOR_UNTIL45_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL45
+#define IMPL_SEQFOR_UNTIL45_B_1_1 IMPL_SEQFOR_TRACE_STOP45
+#define IMPL_SEQFOR_ZIP45_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL45
+#define IMPL_SEQFOR_ZIP45_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL45
+#define IMPL_SEQFOR_ZIP45_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP45_C
+#define IMPL_SEQFOR_ZIP45_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL45(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE45_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE45_B
+#define IMPL_SEQFOR_SIMPLE45_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE45_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
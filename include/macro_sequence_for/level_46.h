@@ -0,0 +1,113 @@
+// Nesting level 46 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH46(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH46, 47) IMPL_SEQFOR_IDENTITY46( IMPL_SEQFOR_FOR_GUIDE46_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE46(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE46, 47) IMPL_SEQFOR_IDENTITY46( IMPL_SEQFOR_SIMPLE46_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST46(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST46, 47) IMPL_SEQFOR_IDENTITY46( IMPL_SEQFOR_FAST46_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL46(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL46, 47) IMPL_SEQFOR_IDENTITY46( IMPL_SEQFOR_UNTIL46_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP46(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP46, 47) IMPL_SEQFOR_IDENTITY46( IMPL_SEQFOR_ZIP46_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS46(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS46, 47) IMPL_SEQFOR_IDENTITY46( IMPL_SEQFOR_FOR_GUIDE46_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP46(m, seq) IMPL_SEQFOR_IDENTITY46( IMPL_SEQFOR_MAP46_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER46(p, seq) IMPL_SEQFOR_IDENTITY46( IMPL_SEQFOR_FILTER46_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G46(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G46, 47) IMPL_SEQFOR_FOR_GUIDE46_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G46(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G46, 47) IMPL_SEQFOR_SIMPLE46_A(m, g) )
+#define SF_FOR_EACH_FAST_G46(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G46, 47) IMPL_SEQFOR_FAST46_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G46(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G46, 47) IMPL_SEQFOR_UNTIL46_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G46(m, g) IMPL_SEQFOR_MAP_G46_A(m, g) )
+#define SF_SEQ_FILTER_G46(p, g) IMPL_SEQFOR_FILTER_G46_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY46(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE46_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE46_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE46_A_ IMPL_SEQFOR_FOR_GUIDE46_B
+#define IMPL_SEQFOR_FOR_GUIDE46_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE46_END
+#define IMPL_SEQFOR_FOR_GUIDE46_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE46_END
+#define IMPL_SEQFOR_FOR_GUIDE46_END(m, s, f, d, ...) f(47, d)
+#define IMPL_SEQFOR_FOR_GUIDE46_B(m, s, f, d, ...) m(47, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE46_B_0(m, s, f, s(47, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE46_B_0(...) IMPL_SEQFOR_FOR_GUIDE46_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE46_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE46_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST46_A(m, s, f, d, e) IMPL_SEQFOR_FAST46_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST46_A_ IMPL_SEQFOR_FAST46_B
+#define IMPL_SEQFOR_FAST46_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE46_END
+#define IMPL_SEQFOR_FAST46_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE46_END
+#define IMPL_SEQFOR_FAST46_B(m, s, f, d, ...) m(47, d, __VA_ARGS__) IMPL_SEQFOR_FAST46_A(m, s, f, s(47, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL46_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL46_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL46_A_ IMPL_SEQFOR_UNTIL46_B
+#define IMPL_SEQFOR_UNTIL46_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE46_END
+#define IMPL_SEQFOR_UNTIL46_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE46_END
+#define IMPL_SEQFOR_UNTIL46_B(m, s, f, d, ...) m(47, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL46_B_0(m, s, f, s(47, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL46_B_0(...) IMPL_SEQFOR_UNTIL46_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL46_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL46_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL46_B_1_0 IMPL_SEQFOR_UNTIL46_A
+#define IMPL_SEQFOR_UNTIL46_B_1_1 IMPL_SEQFOR_UNTIL46_STOP
+#define IMPL_SEQFOR_UNTIL46_STOP(m, s, f, d, e) f(47, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP46_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP46_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP46_A_ IMPL_SEQFOR_ZIP46_B
+#define IMPL_SEQFOR_ZIP46_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE46_END
+#define IMPL_SEQFOR_ZIP46_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE46_END
+#define IMPL_SEQFOR_ZIP46_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP46_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP46_B_0(...) IMPL_SEQFOR_ZIP46_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP46_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP46_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP46_B_1_0 IMPL_SEQFOR_ZIP46_C
+#define IMPL_SEQFOR_ZIP46_B_1_1(m, s, f, d, ...) f(47, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP46_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP46_C(m, s, f, d, r, ...) m(47, d, __VA_ARGS__) IMPL_SEQFOR_ZIP46_A(m, s, f, s(47, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE46_A(m, e) IMPL_SEQFOR_SIMPLE46_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE46_A_ IMPL_SEQFOR_SIMPLE46_B
+#define IMPL_SEQFOR_SIMPLE46_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE46_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE46_B(m, ...) m(47, __VA_ARGS__) IMPL_SEQFOR_SIMPLE46_A(m,
+#define IMPL_SEQFOR_MAP46_A(m, e) IMPL_SEQFOR_MAP46_A_##e(m,
+#define IMPL_SEQFOR_MAP46_A_ IMPL_SEQFOR_MAP46_B
+#define IMPL_SEQFOR_MAP46_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP46_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP46_B(m, ...) (m(47, __VA_ARGS__)) IMPL_SEQFOR_MAP46_A(m,
+#define IMPL_SEQFOR_FILTER46_A(p, e) IMPL_SEQFOR_FILTER46_A_##e(p,
+#define IMPL_SEQFOR_FILTER46_A_ IMPL_SEQFOR_FILTER46_B
+#define IMPL_SEQFOR_FILTER46_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER46_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER46_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(47, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER46_A(p,
+#define IMPL_SEQFOR_MAP_G46_A(m, e) IMPL_SEQFOR_MAP_G46_A_##e(m,
+#define IMPL_SEQFOR_MAP_G46_A_ IMPL_SEQFOR_MAP_G46_B
+#define IMPL_SEQFOR_MAP_G46_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G46_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G46_B(m, ...) )m(47, __VA_ARGS__)) IMPL_SEQFOR_MAP_G46_A(m,
+#define IMPL_SEQFOR_FILTER_G46_A(p, e) IMPL_SEQFOR_FILTER_G46_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G46_A_ IMPL_SEQFOR_FILTER_G46_B
+#define IMPL_SEQFOR_FILTER_G46_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G46_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G46_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(47, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G46_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL46(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE46_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP46(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL46(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE46_A_
+#undef IMPL_SEQFOR_FOR_GUIDE46_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE46_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST46_A_
+#undef IMPL_SEQFOR_FAST46_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST46_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL46_A_
+#undef IMPL_SEQFOR_UNTIL46_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL46_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL46_B_1_1
+#undef IMPL_SEQFOR_ZIP46_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP46_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP46_B_1_0
+#undef IMPL_SEQFOR_ZIP46_B_1_1
+#undef IMPL_SEQFOR_SIMPLE46_A_
+#undef IMPL_SEQFOR_SIMPLE46_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE46_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE46_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE46_B
+#define IMPL_SEQFOR_FOR_GUIDE46_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL46
+#define IMPL_SEQFOR_FOR_GUIDE46_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL46
+#define IMPL_SEQFOR_FAST46_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST46_B
+#define IMPL_SEQFOR_FAST46_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL46
+#define IMPL_SEQFOR_FAST46_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL46
+#define IMPL_SEQFOR_UNTIL46_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL46_B
+#define IMPL_SEQFOR_UNTIL46_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL46
+#define IMPL_SEQFOR_UNTIL46_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL46
+#define IMPL_SEQFOR_UNTIL46_B_1_1 IMPL_SEQFOR_TRACE_STOP46
+#define IMPL_SEQFOR_ZIP46_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL46
+#define IMPL_SEQFOR_ZIP46_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL46
+#define IMPL_SEQFOR_ZIP46_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP46_C
+#define IMPL_SEQFOR_ZIP46_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL46(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE46_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE46_B
+#define IMPL_SEQFOR_SIMPLE46_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE46_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 47 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH47(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH47, 48) IMPL_SEQFOR_IDENTITY47( IMPL_SEQFOR_FOR_GUIDE47_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE47(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE47, 48) IMPL_SEQFOR_IDENTITY47( IMPL_SEQFOR_SIMPLE47_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST47(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST47, 48) IMPL_SEQFOR_IDENTITY47( IMPL_SEQFOR_FAST47_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL47(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL47, 48) IMPL_SEQFOR_IDENTITY47( IMPL_SEQFOR_UNTIL47_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP47(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP47, 48) IMPL_SEQFOR_IDENTITY47( IMPL_SEQFOR_ZIP47_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS47(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS47, 48) IMPL_SEQFOR_IDENTITY47( IMPL_SEQFOR_FOR_GUIDE47_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP47(m, seq) IMPL_SEQFOR_IDENTITY47( IMPL_SEQFOR_MAP47_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER47(p, seq) IMPL_SEQFOR_IDENTITY47( IMPL_SEQFOR_FILTER47_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G47(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G47, 48) IMPL_SEQFOR_FOR_GUIDE47_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G47(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G47, 48) IMPL_SEQFOR_SIMPLE47_A(m, g) )
+#define SF_FOR_EACH_FAST_G47(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G47, 48) IMPL_SEQFOR_FAST47_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G47(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G47, 48) IMPL_SEQFOR_UNTIL47_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G47(m, g) IMPL_SEQFOR_MAP_G47_A(m, g) )
+#define SF_SEQ_FILTER_G47(p, g) IMPL_SEQFOR_FILTER_G47_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY47(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE47_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE47_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE47_A_ IMPL_SEQFOR_FOR_GUIDE47_B
+#define IMPL_SEQFOR_FOR_GUIDE47_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE47_END
+#define IMPL_SEQFOR_FOR_GUIDE47_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE47_END
+#define IMPL_SEQFOR_FOR_GUIDE47_END(m, s, f, d, ...) f(48, d)
+#define IMPL_SEQFOR_FOR_GUIDE47_B(m, s, f, d, ...) m(48, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE47_B_0(m, s, f, s(48, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE47_B_0(...) IMPL_SEQFOR_FOR_GUIDE47_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE47_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE47_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST47_A(m, s, f, d, e) IMPL_SEQFOR_FAST47_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST47_A_ IMPL_SEQFOR_FAST47_B
+#define IMPL_SEQFOR_FAST47_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE47_END
+#define IMPL_SEQFOR_FAST47_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE47_END
+#define IMPL_SEQFOR_FAST47_B(m, s, f, d, ...) m(48, d, __VA_ARGS__) IMPL_SEQFOR_FAST47_A(m, s, f, s(48, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL47_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL47_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL47_A_ IMPL_SEQFOR_UNTIL47_B
+#define IMPL_SEQFOR_UNTIL47_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE47_END
+#define IMPL_SEQFOR_UNTIL47_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE47_END
+#define IMPL_SEQFOR_UNTIL47_B(m, s, f, d, ...) m(48, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL47_B_0(m, s, f, s(48, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL47_B_0(...) IMPL_SEQFOR_UNTIL47_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL47_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL47_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL47_B_1_0 IMPL_SEQFOR_UNTIL47_A
+#define IMPL_SEQFOR_UNTIL47_B_1_1 IMPL_SEQFOR_UNTIL47_STOP
+#define IMPL_SEQFOR_UNTIL47_STOP(m, s, f, d, e) f(48, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP47_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP47_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP47_A_ IMPL_SEQFOR_ZIP47_B
+#define IMPL_SEQFOR_ZIP47_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE47_END
+#define IMPL_SEQFOR_ZIP47_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE47_END
+#define IMPL_SEQFOR_ZIP47_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP47_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP47_B_0(...) IMPL_SEQFOR_ZIP47_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP47_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP47_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP47_B_1_0 IMPL_SEQFOR_ZIP47_C
+#define IMPL_SEQFOR_ZIP47_B_1_1(m, s, f, d, ...) f(48, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP47_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP47_C(m, s, f, d, r, ...) m(48, d, __VA_ARGS__) IMPL_SEQFOR_ZIP47_A(m, s, f, s(48, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE47_A(m, e) IMPL_SEQFOR_SIMPLE47_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE47_A_ IMPL_SEQFOR_SIMPLE47_B
+#define IMPL_SEQFOR_SIMPLE47_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE47_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE47_B(m, ...) m(48, __VA_ARGS__) IMPL_SEQFOR_SIMPLE47_A(m,
+#define IMPL_SEQFOR_MAP47_A(m, e) IMPL_SEQFOR_MAP47_A_##e(m,
+#define IMPL_SEQFOR_MAP47_A_ IMPL_SEQFOR_MAP47_B
+#define IMPL_SEQFOR_MAP47_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP47_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP47_B(m, ...) (m(48, __VA_ARGS__)) IMPL_SEQFOR_MAP47_A(m,
+#define IMPL_SEQFOR_FILTER47_A(p, e) IMPL_SEQFOR_FILTER47_A_##e(p,
+#define IMPL_SEQFOR_FILTER47_A_ IMPL_SEQFOR_FILTER47_B
+#define IMPL_SEQFOR_FILTER47_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER47_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER47_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(48, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER47_A(p,
+#define IMPL_SEQFOR_MAP_G47_A(m, e) IMPL_SEQFOR_MAP_G47_A_##e(m,
+#define IMPL_SEQFOR_MAP_G47_A_ IMPL_SEQFOR_MAP_G47_B
+#define IMPL_SEQFOR_MAP_G47_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G47_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G47_B(m, ...) )m(48, __VA_ARGS__)) IMPL_SEQFOR_MAP_G47_A(m,
+#define IMPL_SEQFOR_FILTER_G47_A(p, e) IMPL_SEQFOR_FILTER_G47_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G47_A_ IMPL_SEQFOR_FILTER_G47_B
+#define IMPL_SEQFOR_FILTER_G47_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G47_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G47_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(48, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G47_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL47(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE47_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP47(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL47(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE47_A_
+#undef IMPL_SEQFOR_FOR_GUIDE47_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE47_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST47_A_
+#undef IMPL_SEQFOR_FAST47_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST47_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL47_A_
+#undef IMPL_SEQFOR_UNTIL47_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL47_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL47_B_1_1
+#undef IMPL_SEQFOR_ZIP47_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP47_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP47_B_1_0
+#undef IMPL_SEQFOR_ZIP47_B_1_1
+#undef IMPL_SEQFOR_SIMPLE47_A_
+#undef IMPL_SEQFOR_SIMPLE47_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE47_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE47_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE47_B
+#define IMPL_SEQFOR_FOR_GUIDE47_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL47
+#define IMPL_SEQFOR_FOR_GUIDE47_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL47
+#define IMPL_SEQFOR_FAST47_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST47_B
+#define IMPL_SEQFOR_FAST47_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL47
+#define IMPL_SEQFOR_FAST47_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL47
+#define IMPL_SEQFOR_UNTIL47_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL47_B
+#define IMPL_SEQFOR_UNTIL47_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL47
+#define IMPL_SEQFOR_UNTIL47_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL47
+#define IMPL_SEQFOR_UNTIL47_B_1_1 IMPL_SEQFOR_TRACE_STOP47
+#define IMPL_SEQFOR_ZIP47_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL47
+#define IMPL_SEQFOR_ZIP47_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL47
+#define IMPL_SEQFOR_ZIP47_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP47_C
+#define IMPL_SEQFOR_ZIP47_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL47(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE47_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE47_B
+#define IMPL_SEQFOR_SIMPLE47_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE47_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
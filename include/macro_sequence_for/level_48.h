@@ -0,0 +1,113 @@
+// Nesting level 48 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH48(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH48, 49) IMPL_SEQFOR_IDENTITY48( IMPL_SEQFOR_FOR_GUIDE48_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE48(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE48, 49) IMPL_SEQFOR_IDENTITY48( IMPL_SEQFOR_SIMPLE48_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST48(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST48, 49) IMPL_SEQFOR_IDENTITY48( IMPL_SEQFOR_FAST48_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL48(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL48, 49) IMPL_SEQFOR_IDENTITY48( IMPL_SEQFOR_UNTIL48_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP48(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP48, 49) IMPL_SEQFOR_IDENTITY48( IMPL_SEQFOR_ZIP48_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS48(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS48, 49) IMPL_SEQFOR_IDENTITY48( IMPL_SEQFOR_FOR_GUIDE48_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP48(m, seq) IMPL_SEQFOR_IDENTITY48( IMPL_SEQFOR_MAP48_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER48(p, seq) IMPL_SEQFOR_IDENTITY48( IMPL_SEQFOR_FILTER48_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G48(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G48, 49) IMPL_SEQFOR_FOR_GUIDE48_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G48(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G48, 49) IMPL_SEQFOR_SIMPLE48_A(m, g) )
+#define SF_FOR_EACH_FAST_G48(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G48, 49) IMPL_SEQFOR_FAST48_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G48(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G48, 49) IMPL_SEQFOR_UNTIL48_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G48(m, g) IMPL_SEQFOR_MAP_G48_A(m, g) )
+#define SF_SEQ_FILTER_G48(p, g) IMPL_SEQFOR_FILTER_G48_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY48(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE48_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE48_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE48_A_ IMPL_SEQFOR_FOR_GUIDE48_B
+#define IMPL_SEQFOR_FOR_GUIDE48_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE48_END
+#define IMPL_SEQFOR_FOR_GUIDE48_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE48_END
+#define IMPL_SEQFOR_FOR_GUIDE48_END(m, s, f, d, ...) f(49, d)
+#define IMPL_SEQFOR_FOR_GUIDE48_B(m, s, f, d, ...) m(49, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE48_B_0(m, s, f, s(49, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE48_B_0(...) IMPL_SEQFOR_FOR_GUIDE48_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE48_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE48_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST48_A(m, s, f, d, e) IMPL_SEQFOR_FAST48_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST48_A_ IMPL_SEQFOR_FAST48_B
+#define IMPL_SEQFOR_FAST48_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE48_END
+#define IMPL_SEQFOR_FAST48_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE48_END
+#define IMPL_SEQFOR_FAST48_B(m, s, f, d, ...) m(49, d, __VA_ARGS__) IMPL_SEQFOR_FAST48_A(m, s, f, s(49, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL48_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL48_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL48_A_ IMPL_SEQFOR_UNTIL48_B
+#define IMPL_SEQFOR_UNTIL48_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE48_END
+#define IMPL_SEQFOR_UNTIL48_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE48_END
+#define IMPL_SEQFOR_UNTIL48_B(m, s, f, d, ...) m(49, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL48_B_0(m, s, f, s(49, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL48_B_0(...) IMPL_SEQFOR_UNTIL48_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL48_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL48_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL48_B_1_0 IMPL_SEQFOR_UNTIL48_A
+#define IMPL_SEQFOR_UNTIL48_B_1_1 IMPL_SEQFOR_UNTIL48_STOP
+#define IMPL_SEQFOR_UNTIL48_STOP(m, s, f, d, e) f(49, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP48_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP48_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP48_A_ IMPL_SEQFOR_ZIP48_B
+#define IMPL_SEQFOR_ZIP48_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE48_END
+#define IMPL_SEQFOR_ZIP48_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE48_END
+#define IMPL_SEQFOR_ZIP48_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP48_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP48_B_0(...) IMPL_SEQFOR_ZIP48_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP48_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP48_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP48_B_1_0 IMPL_SEQFOR_ZIP48_C
+#define IMPL_SEQFOR_ZIP48_B_1_1(m, s, f, d, ...) f(49, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP48_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP48_C(m, s, f, d, r, ...) m(49, d, __VA_ARGS__) IMPL_SEQFOR_ZIP48_A(m, s, f, s(49, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE48_A(m, e) IMPL_SEQFOR_SIMPLE48_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE48_A_ IMPL_SEQFOR_SIMPLE48_B
+#define IMPL_SEQFOR_SIMPLE48_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE48_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE48_B(m, ...) m(49, __VA_ARGS__) IMPL_SEQFOR_SIMPLE48_A(m,
+#define IMPL_SEQFOR_MAP48_A(m, e) IMPL_SEQFOR_MAP48_A_##e(m,
+#define IMPL_SEQFOR_MAP48_A_ IMPL_SEQFOR_MAP48_B
+#define IMPL_SEQFOR_MAP48_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP48_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP48_B(m, ...) (m(49, __VA_ARGS__)) IMPL_SEQFOR_MAP48_A(m,
+#define IMPL_SEQFOR_FILTER48_A(p, e) IMPL_SEQFOR_FILTER48_A_##e(p,
+#define IMPL_SEQFOR_FILTER48_A_ IMPL_SEQFOR_FILTER48_B
+#define IMPL_SEQFOR_FILTER48_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER48_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER48_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(49, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER48_A(p,
+#define IMPL_SEQFOR_MAP_G48_A(m, e) IMPL_SEQFOR_MAP_G48_A_##e(m,
+#define IMPL_SEQFOR_MAP_G48_A_ IMPL_SEQFOR_MAP_G48_B
+#define IMPL_SEQFOR_MAP_G48_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G48_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G48_B(m, ...) )m(49, __VA_ARGS__)) IMPL_SEQFOR_MAP_G48_A(m,
+#define IMPL_SEQFOR_FILTER_G48_A(p, e) IMPL_SEQFOR_FILTER_G48_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G48_A_ IMPL_SEQFOR_FILTER_G48_B
+#define IMPL_SEQFOR_FILTER_G48_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G48_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G48_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(49, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G48_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL48(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE48_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP48(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL48(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE48_A_
+#undef IMPL_SEQFOR_FOR_GUIDE48_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE48_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST48_A_
+#undef IMPL_SEQFOR_FAST48_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST48_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL48_A_
+#undef IMPL_SEQFOR_UNTIL48_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL48_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL48_B_1_1
+#undef IMPL_SEQFOR_ZIP48_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP48_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP48_B_1_0
+#undef IMPL_SEQFOR_ZIP48_B_1_1
+#undef IMPL_SEQFOR_SIMPLE48_A_
+#undef IMPL_SEQFOR_SIMPLE48_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE48_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE48_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE48_B
+#define IMPL_SEQFOR_FOR_GUIDE48_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL48
+#define IMPL_SEQFOR_FOR_GUIDE48_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL48
+#define IMPL_SEQFOR_FAST48_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST48_B
+#define IMPL_SEQFOR_FAST48_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL48
+#define IMPL_SEQFOR_FAST48_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL48
+#define IMPL_SEQFOR_UNTIL48_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL48_B
+#define IMPL_SEQFOR_UNTIL48_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL48
+#define IMPL_SEQFOR_UNTIL48_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL48
+#define IMPL_SEQFOR_UNTIL48_B_1_1 IMPL_SEQFOR_TRACE_STOP48
+#define IMPL_SEQFOR_ZIP48_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL48
+#define IMPL_SEQFOR_ZIP48_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL48
+#define IMPL_SEQFOR_ZIP48_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP48_C
+#define IMPL_SEQFOR_ZIP48_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL48(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE48_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE48_B
+#define IMPL_SEQFOR_SIMPLE48_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE48_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 49 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH49(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH49, 50) IMPL_SEQFOR_IDENTITY49( IMPL_SEQFOR_FOR_GUIDE49_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE49(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE49, 50) IMPL_SEQFOR_IDENTITY49( IMPL_SEQFOR_SIMPLE49_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST49(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST49, 50) IMPL_SEQFOR_IDENTITY49( IMPL_SEQFOR_FAST49_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL49(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL49, 50) IMPL_SEQFOR_IDENTITY49( IMPL_SEQFOR_UNTIL49_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP49(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP49, 50) IMPL_SEQFOR_IDENTITY49( IMPL_SEQFOR_ZIP49_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS49(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS49, 50) IMPL_SEQFOR_IDENTITY49( IMPL_SEQFOR_FOR_GUIDE49_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP49(m, seq) IMPL_SEQFOR_IDENTITY49( IMPL_SEQFOR_MAP49_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER49(p, seq) IMPL_SEQFOR_IDENTITY49( IMPL_SEQFOR_FILTER49_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G49(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G49, 50) IMPL_SEQFOR_FOR_GUIDE49_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G49(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G49, 50) IMPL_SEQFOR_SIMPLE49_A(m, g) )
+#define SF_FOR_EACH_FAST_G49(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G49, 50) IMPL_SEQFOR_FAST49_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G49(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G49, 50) IMPL_SEQFOR_UNTIL49_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G49(m, g) IMPL_SEQFOR_MAP_G49_A(m, g) )
+#define SF_SEQ_FILTER_G49(p, g) IMPL_SEQFOR_FILTER_G49_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY49(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE49_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE49_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE49_A_ IMPL_SEQFOR_FOR_GUIDE49_B
+#define IMPL_SEQFOR_FOR_GUIDE49_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE49_END
+#define IMPL_SEQFOR_FOR_GUIDE49_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE49_END
+#define IMPL_SEQFOR_FOR_GUIDE49_END(m, s, f, d, ...) f(50, d)
+#define IMPL_SEQFOR_FOR_GUIDE49_B(m, s, f, d, ...) m(50, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE49_B_0(m, s, f, s(50, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE49_B_0(...) IMPL_SEQFOR_FOR_GUIDE49_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE49_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE49_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST49_A(m, s, f, d, e) IMPL_SEQFOR_FAST49_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST49_A_ IMPL_SEQFOR_FAST49_B
+#define IMPL_SEQFOR_FAST49_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE49_END
+#define IMPL_SEQFOR_FAST49_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE49_END
+#define IMPL_SEQFOR_FAST49_B(m, s, f, d, ...) m(50, d, __VA_ARGS__) IMPL_SEQFOR_FAST49_A(m, s, f, s(50, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL49_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL49_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL49_A_ IMPL_SEQFOR_UNTIL49_B
+#define IMPL_SEQFOR_UNTIL49_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE49_END
+#define IMPL_SEQFOR_UNTIL49_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE49_END
+#define IMPL_SEQFOR_UNTIL49_B(m, s, f, d, ...) m(50, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL49_B_0(m, s, f, s(50, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL49_B_0(...) IMPL_SEQFOR_UNTIL49_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL49_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL49_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL49_B_1_0 IMPL_SEQFOR_UNTIL49_A
+#define IMPL_SEQFOR_UNTIL49_B_1_1 IMPL_SEQFOR_UNTIL49_STOP
+#define IMPL_SEQFOR_UNTIL49_STOP(m, s, f, d, e) f(50, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP49_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP49_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP49_A_ IMPL_SEQFOR_ZIP49_B
+#define IMPL_SEQFOR_ZIP49_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE49_END
+#define IMPL_SEQFOR_ZIP49_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE49_END
+#define IMPL_SEQFOR_ZIP49_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP49_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP49_B_0(...) IMPL_SEQFOR_ZIP49_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP49_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP49_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP49_B_1_0 IMPL_SEQFOR_ZIP49_C
+#define IMPL_SEQFOR_ZIP49_B_1_1(m, s, f, d, ...) f(50, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP49_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP49_C(m, s, f, d, r, ...) m(50, d, __VA_ARGS__) IMPL_SEQFOR_ZIP49_A(m, s, f, s(50, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE49_A(m, e) IMPL_SEQFOR_SIMPLE49_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE49_A_ IMPL_SEQFOR_SIMPLE49_B
+#define IMPL_SEQFOR_SIMPLE49_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE49_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE49_B(m, ...) m(50, __VA_ARGS__) IMPL_SEQFOR_SIMPLE49_A(m,
+#define IMPL_SEQFOR_MAP49_A(m, e) IMPL_SEQFOR_MAP49_A_##e(m,
+#define IMPL_SEQFOR_MAP49_A_ IMPL_SEQFOR_MAP49_B
+#define IMPL_SEQFOR_MAP49_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP49_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP49_B(m, ...) (m(50, __VA_ARGS__)) IMPL_SEQFOR_MAP49_A(m,
+#define IMPL_SEQFOR_FILTER49_A(p, e) IMPL_SEQFOR_FILTER49_A_##e(p,
+#define IMPL_SEQFOR_FILTER49_A_ IMPL_SEQFOR_FILTER49_B
+#define IMPL_SEQFOR_FILTER49_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER49_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER49_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(50, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER49_A(p,
+#define IMPL_SEQFOR_MAP_G49_A(m, e) IMPL_SEQFOR_MAP_G49_A_##e(m,
+#define IMPL_SEQFOR_MAP_G49_A_ IMPL_SEQFOR_MAP_G49_B
+#define IMPL_SEQFOR_MAP_G49_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G49_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G49_B(m, ...) )m(50, __VA_ARGS__)) IMPL_SEQFOR_MAP_G49_A(m,
+#define IMPL_SEQFOR_FILTER_G49_A(p, e) IMPL_SEQFOR_FILTER_G49_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G49_A_ IMPL_SEQFOR_FILTER_G49_B
+#define IMPL_SEQFOR_FILTER_G49_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G49_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G49_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(50, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G49_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL49(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE49_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP49(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL49(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE49_A_
+#undef IMPL_SEQFOR_FOR_GUIDE49_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE49_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST49_A_
+#undef IMPL_SEQFOR_FAST49_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST49_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL49_A_
+#undef IMPL_SEQFOR_UNTIL49_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL49_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL49_B_1_1
+#undef IMPL_SEQFOR_ZIP49_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP49_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP49_B_1_0
+#undef IMPL_SEQFOR_ZIP49_B_1_1
+#undef IMPL_SEQFOR_SIMPLE49_A_
+#undef IMPL_SEQFOR_SIMPLE49_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE49_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE49_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE49_B
+#define IMPL_SEQFOR_FOR_GUIDE49_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL49
+#define IMPL_SEQFOR_FOR_GUIDE49_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL49
+#define IMPL_SEQFOR_FAST49_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST49_B
+#define IMPL_SEQFOR_FAST49_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL49
+#define IMPL_SEQFOR_FAST49_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL49
+#define IMPL_SEQFOR_UNTIL49_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL49_B
+#define IMPL_SEQFOR_UNTIL49_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL49
+#define IMPL_SEQFOR_UNTIL49_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL49
+#define IMPL_SEQFOR_UNTIL49_B_1_1 IMPL_SEQFOR_TRACE_STOP49
+#define IMPL_SEQFOR_ZIP49_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL49
+#define IMPL_SEQFOR_ZIP49_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL49
+#define IMPL_SEQFOR_ZIP49_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP49_C
+#define IMPL_SEQFOR_ZIP49_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL49(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE49_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE49_B
+#define IMPL_SEQFOR_SIMPLE49_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE49_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
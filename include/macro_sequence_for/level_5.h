@@ -0,0 +1,113 @@
+// Nesting level 5 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH5(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH5, 6) IMPL_SEQFOR_IDENTITY5( IMPL_SEQFOR_FOR_GUIDE5_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE5(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE5, 6) IMPL_SEQFOR_IDENTITY5( IMPL_SEQFOR_SIMPLE5_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST5(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST5, 6) IMPL_SEQFOR_IDENTITY5( IMPL_SEQFOR_FAST5_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL5(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL5, 6) IMPL_SEQFOR_IDENTITY5( IMPL_SEQFOR_UNTIL5_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP5(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP5, 6) IMPL_SEQFOR_IDENTITY5( IMPL_SEQFOR_ZIP5_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS5(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS5, 6) IMPL_SEQFOR_IDENTITY5( IMPL_SEQFOR_FOR_GUIDE5_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP5(m, seq) IMPL_SEQFOR_IDENTITY5( IMPL_SEQFOR_MAP5_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER5(p, seq) IMPL_SEQFOR_IDENTITY5( IMPL_SEQFOR_FILTER5_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G5(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G5, 6) IMPL_SEQFOR_FOR_GUIDE5_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G5(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G5, 6) IMPL_SEQFOR_SIMPLE5_A(m, g) )
+#define SF_FOR_EACH_FAST_G5(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G5, 6) IMPL_SEQFOR_FAST5_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G5(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G5, 6) IMPL_SEQFOR_UNTIL5_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G5(m, g) IMPL_SEQFOR_MAP_G5_A(m, g) )
+#define SF_SEQ_FILTER_G5(p, g) IMPL_SEQFOR_FILTER_G5_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY5(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE5_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE5_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE5_A_ IMPL_SEQFOR_FOR_GUIDE5_B
+#define IMPL_SEQFOR_FOR_GUIDE5_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE5_END
+#define IMPL_SEQFOR_FOR_GUIDE5_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE5_END
+#define IMPL_SEQFOR_FOR_GUIDE5_END(m, s, f, d, ...) f(6, d)
+#define IMPL_SEQFOR_FOR_GUIDE5_B(m, s, f, d, ...) m(6, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE5_B_0(m, s, f, s(6, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE5_B_0(...) IMPL_SEQFOR_FOR_GUIDE5_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE5_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE5_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST5_A(m, s, f, d, e) IMPL_SEQFOR_FAST5_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST5_A_ IMPL_SEQFOR_FAST5_B
+#define IMPL_SEQFOR_FAST5_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE5_END
+#define IMPL_SEQFOR_FAST5_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE5_END
+#define IMPL_SEQFOR_FAST5_B(m, s, f, d, ...) m(6, d, __VA_ARGS__) IMPL_SEQFOR_FAST5_A(m, s, f, s(6, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL5_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL5_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL5_A_ IMPL_SEQFOR_UNTIL5_B
+#define IMPL_SEQFOR_UNTIL5_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE5_END
+#define IMPL_SEQFOR_UNTIL5_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE5_END
+#define IMPL_SEQFOR_UNTIL5_B(m, s, f, d, ...) m(6, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL5_B_0(m, s, f, s(6, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL5_B_0(...) IMPL_SEQFOR_UNTIL5_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL5_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL5_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL5_B_1_0 IMPL_SEQFOR_UNTIL5_A
+#define IMPL_SEQFOR_UNTIL5_B_1_1 IMPL_SEQFOR_UNTIL5_STOP
+#define IMPL_SEQFOR_UNTIL5_STOP(m, s, f, d, e) f(6, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP5_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP5_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP5_A_ IMPL_SEQFOR_ZIP5_B
+#define IMPL_SEQFOR_ZIP5_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE5_END
+#define IMPL_SEQFOR_ZIP5_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE5_END
+#define IMPL_SEQFOR_ZIP5_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP5_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP5_B_0(...) IMPL_SEQFOR_ZIP5_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP5_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP5_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP5_B_1_0 IMPL_SEQFOR_ZIP5_C
+#define IMPL_SEQFOR_ZIP5_B_1_1(m, s, f, d, ...) f(6, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP5_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP5_C(m, s, f, d, r, ...) m(6, d, __VA_ARGS__) IMPL_SEQFOR_ZIP5_A(m, s, f, s(6, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE5_A(m, e) IMPL_SEQFOR_SIMPLE5_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE5_A_ IMPL_SEQFOR_SIMPLE5_B
+#define IMPL_SEQFOR_SIMPLE5_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE5_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE5_B(m, ...) m(6, __VA_ARGS__) IMPL_SEQFOR_SIMPLE5_A(m,
+#define IMPL_SEQFOR_MAP5_A(m, e) IMPL_SEQFOR_MAP5_A_##e(m,
+#define IMPL_SEQFOR_MAP5_A_ IMPL_SEQFOR_MAP5_B
+#define IMPL_SEQFOR_MAP5_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP5_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP5_B(m, ...) (m(6, __VA_ARGS__)) IMPL_SEQFOR_MAP5_A(m,
+#define IMPL_SEQFOR_FILTER5_A(p, e) IMPL_SEQFOR_FILTER5_A_##e(p,
+#define IMPL_SEQFOR_FILTER5_A_ IMPL_SEQFOR_FILTER5_B
+#define IMPL_SEQFOR_FILTER5_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER5_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER5_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(6, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER5_A(p,
+#define IMPL_SEQFOR_MAP_G5_A(m, e) IMPL_SEQFOR_MAP_G5_A_##e(m,
+#define IMPL_SEQFOR_MAP_G5_A_ IMPL_SEQFOR_MAP_G5_B
+#define IMPL_SEQFOR_MAP_G5_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G5_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G5_B(m, ...) )m(6, __VA_ARGS__)) IMPL_SEQFOR_MAP_G5_A(m,
+#define IMPL_SEQFOR_FILTER_G5_A(p, e) IMPL_SEQFOR_FILTER_G5_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G5_A_ IMPL_SEQFOR_FILTER_G5_B
+#define IMPL_SEQFOR_FILTER_G5_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G5_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G5_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(6, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G5_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL5(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE5_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP5(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL5(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE5_A_
+#undef IMPL_SEQFOR_FOR_GUIDE5_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE5_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST5_A_
+#undef IMPL_SEQFOR_FAST5_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST5_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL5_A_
+#undef IMPL_SEQFOR_UNTIL5_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL5_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL5_B_1_1
+#undef IMPL_SEQFOR_ZIP5_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP5_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP5_B_1_0
+#undef IMPL_SEQFOR_ZIP5_B_1_1
+#undef IMPL_SEQFOR_SIMPLE5_A_
+#undef IMPL_SEQFOR_SIMPLE5_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE5_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE5_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE5_B
+#define IMPL_SEQFOR_FOR_GUIDE5_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL5
+#define IMPL_SEQFOR_FOR_GUIDE5_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL5
+#define IMPL_SEQFOR_FAST5_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST5_B
+#define IMPL_SEQFOR_FAST5_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL5
+#define IMPL_SEQFOR_FAST5_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL5
+#define IMPL_SEQFOR_UNTIL5_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL5_B
+#define IMPL_SEQFOR_UNTIL5_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL5
+#define IMPL_SEQFOR_UNTIL5_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL5
+#define IMPL_SEQFOR_UNTIL5_B_1_1 IMPL_SEQFOR_TRACE_STOP5
+#define IMPL_SEQFOR_ZIP5_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL5
+#define IMPL_SEQFOR_ZIP5_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL5
+#define IMPL_SEQFOR_ZIP5_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP5_C
+#define IMPL_SEQFOR_ZIP5_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL5(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE5_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE5_B
+#define IMPL_SEQFOR_SIMPLE5_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE5_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 50 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH50(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH50, 51) IMPL_SEQFOR_IDENTITY50( IMPL_SEQFOR_FOR_GUIDE50_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE50(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE50, 51) IMPL_SEQFOR_IDENTITY50( IMPL_SEQFOR_SIMPLE50_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST50(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST50, 51) IMPL_SEQFOR_IDENTITY50( IMPL_SEQFOR_FAST50_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL50(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL50, 51) IMPL_SEQFOR_IDENTITY50( IMPL_SEQFOR_UNTIL50_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP50(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP50, 51) IMPL_SEQFOR_IDENTITY50( IMPL_SEQFOR_ZIP50_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS50(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS50, 51) IMPL_SEQFOR_IDENTITY50( IMPL_SEQFOR_FOR_GUIDE50_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP50(m, seq) IMPL_SEQFOR_IDENTITY50( IMPL_SEQFOR_MAP50_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER50(p, seq) IMPL_SEQFOR_IDENTITY50( IMPL_SEQFOR_FILTER50_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G50(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G50, 51) IMPL_SEQFOR_FOR_GUIDE50_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G50(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G50, 51) IMPL_SEQFOR_SIMPLE50_A(m, g) )
+#define SF_FOR_EACH_FAST_G50(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G50, 51) IMPL_SEQFOR_FAST50_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G50(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G50, 51) IMPL_SEQFOR_UNTIL50_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G50(m, g) IMPL_SEQFOR_MAP_G50_A(m, g) )
+#define SF_SEQ_FILTER_G50(p, g) IMPL_SEQFOR_FILTER_G50_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY50(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE50_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE50_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE50_A_ IMPL_SEQFOR_FOR_GUIDE50_B
+#define IMPL_SEQFOR_FOR_GUIDE50_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE50_END
+#define IMPL_SEQFOR_FOR_GUIDE50_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE50_END
+#define IMPL_SEQFOR_FOR_GUIDE50_END(m, s, f, d, ...) f(51, d)
+#define IMPL_SEQFOR_FOR_GUIDE50_B(m, s, f, d, ...) m(51, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE50_B_0(m, s, f, s(51, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE50_B_0(...) IMPL_SEQFOR_FOR_GUIDE50_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE50_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE50_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST50_A(m, s, f, d, e) IMPL_SEQFOR_FAST50_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST50_A_ IMPL_SEQFOR_FAST50_B
+#define IMPL_SEQFOR_FAST50_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE50_END
+#define IMPL_SEQFOR_FAST50_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE50_END
+#define IMPL_SEQFOR_FAST50_B(m, s, f, d, ...) m(51, d, __VA_ARGS__) IMPL_SEQFOR_FAST50_A(m, s, f, s(51, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL50_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL50_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL50_A_ IMPL_SEQFOR_UNTIL50_B
+#define IMPL_SEQFOR_UNTIL50_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE50_END
+#define IMPL_SEQFOR_UNTIL50_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE50_END
+#define IMPL_SEQFOR_UNTIL50_B(m, s, f, d, ...) m(51, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL50_B_0(m, s, f, s(51, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL50_B_0(...) IMPL_SEQFOR_UNTIL50_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL50_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL50_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL50_B_1_0 IMPL_SEQFOR_UNTIL50_A
+#define IMPL_SEQFOR_UNTIL50_B_1_1 IMPL_SEQFOR_UNTIL50_STOP
+#define IMPL_SEQFOR_UNTIL50_STOP(m, s, f, d, e) f(51, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP50_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP50_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP50_A_ IMPL_SEQFOR_ZIP50_B
+#define IMPL_SEQFOR_ZIP50_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE50_END
+#define IMPL_SEQFOR_ZIP50_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE50_END
+#define IMPL_SEQFOR_ZIP50_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP50_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP50_B_0(...) IMPL_SEQFOR_ZIP50_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP50_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP50_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP50_B_1_0 IMPL_SEQFOR_ZIP50_C
+#define IMPL_SEQFOR_ZIP50_B_1_1(m, s, f, d, ...) f(51, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP50_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP50_C(m, s, f, d, r, ...) m(51, d, __VA_ARGS__) IMPL_SEQFOR_ZIP50_A(m, s, f, s(51, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE50_A(m, e) IMPL_SEQFOR_SIMPLE50_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE50_A_ IMPL_SEQFOR_SIMPLE50_B
+#define IMPL_SEQFOR_SIMPLE50_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE50_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE50_B(m, ...) m(51, __VA_ARGS__) IMPL_SEQFOR_SIMPLE50_A(m,
+#define IMPL_SEQFOR_MAP50_A(m, e) IMPL_SEQFOR_MAP50_A_##e(m,
+#define IMPL_SEQFOR_MAP50_A_ IMPL_SEQFOR_MAP50_B
+#define IMPL_SEQFOR_MAP50_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP50_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP50_B(m, ...) (m(51, __VA_ARGS__)) IMPL_SEQFOR_MAP50_A(m,
+#define IMPL_SEQFOR_FILTER50_A(p, e) IMPL_SEQFOR_FILTER50_A_##e(p,
+#define IMPL_SEQFOR_FILTER50_A_ IMPL_SEQFOR_FILTER50_B
+#define IMPL_SEQFOR_FILTER50_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER50_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER50_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(51, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER50_A(p,
+#define IMPL_SEQFOR_MAP_G50_A(m, e) IMPL_SEQFOR_MAP_G50_A_##e(m,
+#define IMPL_SEQFOR_MAP_G50_A_ IMPL_SEQFOR_MAP_G50_B
+#define IMPL_SEQFOR_MAP_G50_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G50_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G50_B(m, ...) )m(51, __VA_ARGS__)) IMPL_SEQFOR_MAP_G50_A(m,
+#define IMPL_SEQFOR_FILTER_G50_A(p, e) IMPL_SEQFOR_FILTER_G50_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G50_A_ IMPL_SEQFOR_FILTER_G50_B
+#define IMPL_SEQFOR_FILTER_G50_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G50_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G50_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(51, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G50_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL50(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE50_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP50(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL50(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE50_A_
+#undef IMPL_SEQFOR_FOR_GUIDE50_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE50_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST50_A_
+#undef IMPL_SEQFOR_FAST50_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST50_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL50_A_
+#undef IMPL_SEQFOR_UNTIL50_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL50_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL50_B_1_1
+#undef IMPL_SEQFOR_ZIP50_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP50_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP50_B_1_0
+#undef IMPL_SEQFOR_ZIP50_B_1_1
+#undef IMPL_SEQFOR_SIMPLE50_A_
+#undef IMPL_SEQFOR_SIMPLE50_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE50_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE50_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE50_B
+#define IMPL_SEQFOR_FOR_GUIDE50_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL50
+#define IMPL_SEQFOR_FOR_GUIDE50_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL50
+#define IMPL_SEQFOR_FAST50_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST50_B
+#define IMPL_SEQFOR_FAST50_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL50
+#define IMPL_SEQFOR_FAST50_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL50
+#define IMPL_SEQFOR_UNTIL50_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL50_B
+#define IMPL_SEQFOR_UNTIL50_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL50
+#define IMPL_SEQFOR_UNTIL50_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL50
+#define IMPL_SEQFOR_UNTIL50_B_1_1 IMPL_SEQFOR_TRACE_STOP50
+#define IMPL_SEQFOR_ZIP50_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL50
+#define IMPL_SEQFOR_ZIP50_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL50
+#define IMPL_SEQFOR_ZIP50_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP50_C
+#define IMPL_SEQFOR_ZIP50_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL50(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE50_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE50_B
+#define IMPL_SEQFOR_SIMPLE50_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE50_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 51 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH51(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH51, 52) IMPL_SEQFOR_IDENTITY51( IMPL_SEQFOR_FOR_GUIDE51_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE51(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE51, 52) IMPL_SEQFOR_IDENTITY51( IMPL_SEQFOR_SIMPLE51_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST51(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST51, 52) IMPL_SEQFOR_IDENTITY51( IMPL_SEQFOR_FAST51_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL51(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL51, 52) IMPL_SEQFOR_IDENTITY51( IMPL_SEQFOR_UNTIL51_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP51(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP51, 52) IMPL_SEQFOR_IDENTITY51( IMPL_SEQFOR_ZIP51_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS51(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS51, 52) IMPL_SEQFOR_IDENTITY51( IMPL_SEQFOR_FOR_GUIDE51_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP51(m, seq) IMPL_SEQFOR_IDENTITY51( IMPL_SEQFOR_MAP51_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER51(p, seq) IMPL_SEQFOR_IDENTITY51( IMPL_SEQFOR_FILTER51_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G51(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G51, 52) IMPL_SEQFOR_FOR_GUIDE51_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G51(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G51, 52) IMPL_SEQFOR_SIMPLE51_A(m, g) )
+#define SF_FOR_EACH_FAST_G51(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G51, 52) IMPL_SEQFOR_FAST51_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G51(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G51, 52) IMPL_SEQFOR_UNTIL51_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G51(m, g) IMPL_SEQFOR_MAP_G51_A(m, g) )
+#define SF_SEQ_FILTER_G51(p, g) IMPL_SEQFOR_FILTER_G51_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY51(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE51_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE51_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE51_A_ IMPL_SEQFOR_FOR_GUIDE51_B
+#define IMPL_SEQFOR_FOR_GUIDE51_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE51_END
+#define IMPL_SEQFOR_FOR_GUIDE51_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE51_END
+#define IMPL_SEQFOR_FOR_GUIDE51_END(m, s, f, d, ...) f(52, d)
+#define IMPL_SEQFOR_FOR_GUIDE51_B(m, s, f, d, ...) m(52, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE51_B_0(m, s, f, s(52, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE51_B_0(...) IMPL_SEQFOR_FOR_GUIDE51_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE51_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE51_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST51_A(m, s, f, d, e) IMPL_SEQFOR_FAST51_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST51_A_ IMPL_SEQFOR_FAST51_B
+#define IMPL_SEQFOR_FAST51_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE51_END
+#define IMPL_SEQFOR_FAST51_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE51_END
+#define IMPL_SEQFOR_FAST51_B(m, s, f, d, ...) m(52, d, __VA_ARGS__) IMPL_SEQFOR_FAST51_A(m, s, f, s(52, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL51_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL51_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL51_A_ IMPL_SEQFOR_UNTIL51_B
+#define IMPL_SEQFOR_UNTIL51_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE51_END
+#define IMPL_SEQFOR_UNTIL51_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE51_END
+#define IMPL_SEQFOR_UNTIL51_B(m, s, f, d, ...) m(52, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL51_B_0(m, s, f, s(52, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL51_B_0(...) IMPL_SEQFOR_UNTIL51_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL51_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL51_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL51_B_1_0 IMPL_SEQFOR_UNTIL51_A
+#define IMPL_SEQFOR_UNTIL51_B_1_1 IMPL_SEQFOR_UNTIL51_STOP
+#define IMPL_SEQFOR_UNTIL51_STOP(m, s, f, d, e) f(52, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP51_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP51_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP51_A_ IMPL_SEQFOR_ZIP51_B
+#define IMPL_SEQFOR_ZIP51_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE51_END
+#define IMPL_SEQFOR_ZIP51_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE51_END
+#define IMPL_SEQFOR_ZIP51_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP51_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP51_B_0(...) IMPL_SEQFOR_ZIP51_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP51_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP51_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP51_B_1_0 IMPL_SEQFOR_ZIP51_C
+#define IMPL_SEQFOR_ZIP51_B_1_1(m, s, f, d, ...) f(52, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP51_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP51_C(m, s, f, d, r, ...) m(52, d, __VA_ARGS__) IMPL_SEQFOR_ZIP51_A(m, s, f, s(52, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE51_A(m, e) IMPL_SEQFOR_SIMPLE51_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE51_A_ IMPL_SEQFOR_SIMPLE51_B
+#define IMPL_SEQFOR_SIMPLE51_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE51_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE51_B(m, ...) m(52, __VA_ARGS__) IMPL_SEQFOR_SIMPLE51_A(m,
+#define IMPL_SEQFOR_MAP51_A(m, e) IMPL_SEQFOR_MAP51_A_##e(m,
+#define IMPL_SEQFOR_MAP51_A_ IMPL_SEQFOR_MAP51_B
+#define IMPL_SEQFOR_MAP51_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP51_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP51_B(m, ...) (m(52, __VA_ARGS__)) IMPL_SEQFOR_MAP51_A(m,
+#define IMPL_SEQFOR_FILTER51_A(p, e) IMPL_SEQFOR_FILTER51_A_##e(p,
+#define IMPL_SEQFOR_FILTER51_A_ IMPL_SEQFOR_FILTER51_B
+#define IMPL_SEQFOR_FILTER51_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER51_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER51_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(52, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER51_A(p,
+#define IMPL_SEQFOR_MAP_G51_A(m, e) IMPL_SEQFOR_MAP_G51_A_##e(m,
+#define IMPL_SEQFOR_MAP_G51_A_ IMPL_SEQFOR_MAP_G51_B
+#define IMPL_SEQFOR_MAP_G51_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G51_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G51_B(m, ...) )m(52, __VA_ARGS__)) IMPL_SEQFOR_MAP_G51_A(m,
+#define IMPL_SEQFOR_FILTER_G51_A(p, e) IMPL_SEQFOR_FILTER_G51_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G51_A_ IMPL_SEQFOR_FILTER_G51_B
+#define IMPL_SEQFOR_FILTER_G51_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G51_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G51_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(52, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G51_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL51(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE51_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP51(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL51(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE51_A_
+#undef IMPL_SEQFOR_FOR_GUIDE51_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE51_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST51_A_
+#undef IMPL_SEQFOR_FAST51_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST51_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL51_A_
+#undef IMPL_SEQFOR_UNTIL51_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL51_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL51_B_1_1
+#undef IMPL_SEQFOR_ZIP51_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP51_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP51_B_1_0
+#undef IMPL_SEQFOR_ZIP51_B_1_1
+#undef IMPL_SEQFOR_SIMPLE51_A_
+#undef IMPL_SEQFOR_SIMPLE51_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE51_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE51_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE51_B
+#define IMPL_SEQFOR_FOR_GUIDE51_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL51
+#define IMPL_SEQFOR_FOR_GUIDE51_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL51
+#define IMPL_SEQFOR_FAST51_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST51_B
+#define IMPL_SEQFOR_FAST51_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL51
+#define IMPL_SEQFOR_FAST51_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL51
+#define IMPL_SEQFOR_UNTIL51_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL51_B
+#define IMPL_SEQFOR_UNTIL51_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL51
+#define IMPL_SEQFOR_UNTIL51_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL51
+#define IMPL_SEQFOR_UNTIL51_B_1_1 IMPL_SEQFOR_TRACE_STOP51
+#define IMPL_SEQFOR_ZIP51_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL51
+#define IMPL_SEQFOR_ZIP51_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL51
+#define IMPL_SEQFOR_ZIP51_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP51_C
+#define IMPL_SEQFOR_ZIP51_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL51(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE51_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE51_B
+#define IMPL_SEQFOR_SIMPLE51_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE51_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 52 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH52(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH52, 53) IMPL_SEQFOR_IDENTITY52( IMPL_SEQFOR_FOR_GUIDE52_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE52(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE52, 53) IMPL_SEQFOR_IDENTITY52( IMPL_SEQFOR_SIMPLE52_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST52(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST52, 53) IMPL_SEQFOR_IDENTITY52( IMPL_SEQFOR_FAST52_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL52(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL52, 53) IMPL_SEQFOR_IDENTITY52( IMPL_SEQFOR_UNTIL52_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP52(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP52, 53) IMPL_SEQFOR_IDENTITY52( IMPL_SEQFOR_ZIP52_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS52(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS52, 53) IMPL_SEQFOR_IDENTITY52( IMPL_SEQFOR_FOR_GUIDE52_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP52(m, seq) IMPL_SEQFOR_IDENTITY52( IMPL_SEQFOR_MAP52_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER52(p, seq) IMPL_SEQFOR_IDENTITY52( IMPL_SEQFOR_FILTER52_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G52(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G52, 53) IMPL_SEQFOR_FOR_GUIDE52_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G52(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G52, 53) IMPL_SEQFOR_SIMPLE52_A(m, g) )
+#define SF_FOR_EACH_FAST_G52(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G52, 53) IMPL_SEQFOR_FAST52_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G52(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G52, 53) IMPL_SEQFOR_UNTIL52_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G52(m, g) IMPL_SEQFOR_MAP_G52_A(m, g) )
+#define SF_SEQ_FILTER_G52(p, g) IMPL_SEQFOR_FILTER_G52_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY52(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE52_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE52_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE52_A_ IMPL_SEQFOR_FOR_GUIDE52_B
+#define IMPL_SEQFOR_FOR_GUIDE52_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE52_END
+#define IMPL_SEQFOR_FOR_GUIDE52_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE52_END
+#define IMPL_SEQFOR_FOR_GUIDE52_END(m, s, f, d, ...) f(53, d)
+#define IMPL_SEQFOR_FOR_GUIDE52_B(m, s, f, d, ...) m(53, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE52_B_0(m, s, f, s(53, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE52_B_0(...) IMPL_SEQFOR_FOR_GUIDE52_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE52_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE52_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST52_A(m, s, f, d, e) IMPL_SEQFOR_FAST52_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST52_A_ IMPL_SEQFOR_FAST52_B
+#define IMPL_SEQFOR_FAST52_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE52_END
+#define IMPL_SEQFOR_FAST52_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE52_END
+#define IMPL_SEQFOR_FAST52_B(m, s, f, d, ...) m(53, d, __VA_ARGS__) IMPL_SEQFOR_FAST52_A(m, s, f, s(53, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL52_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL52_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL52_A_ IMPL_SEQFOR_UNTIL52_B
+#define IMPL_SEQFOR_UNTIL52_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE52_END
+#define IMPL_SEQFOR_UNTIL52_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE52_END
+#define IMPL_SEQFOR_UNTIL52_B(m, s, f, d, ...) m(53, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL52_B_0(m, s, f, s(53, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL52_B_0(...) IMPL_SEQFOR_UNTIL52_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL52_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL52_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL52_B_1_0 IMPL_SEQFOR_UNTIL52_A
+#define IMPL_SEQFOR_UNTIL52_B_1_1 IMPL_SEQFOR_UNTIL52_STOP
+#define IMPL_SEQFOR_UNTIL52_STOP(m, s, f, d, e) f(53, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP52_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP52_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP52_A_ IMPL_SEQFOR_ZIP52_B
+#define IMPL_SEQFOR_ZIP52_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE52_END
+#define IMPL_SEQFOR_ZIP52_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE52_END
+#define IMPL_SEQFOR_ZIP52_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP52_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP52_B_0(...) IMPL_SEQFOR_ZIP52_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP52_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP52_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP52_B_1_0 IMPL_SEQFOR_ZIP52_C
+#define IMPL_SEQFOR_ZIP52_B_1_1(m, s, f, d, ...) f(53, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP52_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP52_C(m, s, f, d, r, ...) m(53, d, __VA_ARGS__) IMPL_SEQFOR_ZIP52_A(m, s, f, s(53, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE52_A(m, e) IMPL_SEQFOR_SIMPLE52_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE52_A_ IMPL_SEQFOR_SIMPLE52_B
+#define IMPL_SEQFOR_SIMPLE52_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE52_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE52_B(m, ...) m(53, __VA_ARGS__) IMPL_SEQFOR_SIMPLE52_A(m,
+#define IMPL_SEQFOR_MAP52_A(m, e) IMPL_SEQFOR_MAP52_A_##e(m,
+#define IMPL_SEQFOR_MAP52_A_ IMPL_SEQFOR_MAP52_B
+#define IMPL_SEQFOR_MAP52_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP52_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP52_B(m, ...) (m(53, __VA_ARGS__)) IMPL_SEQFOR_MAP52_A(m,
+#define IMPL_SEQFOR_FILTER52_A(p, e) IMPL_SEQFOR_FILTER52_A_##e(p,
+#define IMPL_SEQFOR_FILTER52_A_ IMPL_SEQFOR_FILTER52_B
+#define IMPL_SEQFOR_FILTER52_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER52_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER52_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(53, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER52_A(p,
+#define IMPL_SEQFOR_MAP_G52_A(m, e) IMPL_SEQFOR_MAP_G52_A_##e(m,
+#define IMPL_SEQFOR_MAP_G52_A_ IMPL_SEQFOR_MAP_G52_B
+#define IMPL_SEQFOR_MAP_G52_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G52_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G52_B(m, ...) )m(53, __VA_ARGS__)) IMPL_SEQFOR_MAP_G52_A(m,
+#define IMPL_SEQFOR_FILTER_G52_A(p, e) IMPL_SEQFOR_FILTER_G52_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G52_A_ IMPL_SEQFOR_FILTER_G52_B
+#define IMPL_SEQFOR_FILTER_G52_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G52_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G52_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(53, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G52_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL52(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE52_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP52(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL52(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE52_A_
+#undef IMPL_SEQFOR_FOR_GUIDE52_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE52_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST52_A_
+#undef IMPL_SEQFOR_FAST52_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST52_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL52_A_
+#undef IMPL_SEQFOR_UNTIL52_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL52_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL52_B_1_1
+#undef IMPL_SEQFOR_ZIP52_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP52_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP52_B_1_0
+#undef IMPL_SEQFOR_ZIP52_B_1_1
+#undef IMPL_SEQFOR_SIMPLE52_A_
+#undef IMPL_SEQFOR_SIMPLE52_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE52_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE52_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE52_B
+#define IMPL_SEQFOR_FOR_GUIDE52_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL52
+#define IMPL_SEQFOR_FOR_GUIDE52_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL52
+#define IMPL_SEQFOR_FAST52_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST52_B
+#define IMPL_SEQFOR_FAST52_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL52
+#define IMPL_SEQFOR_FAST52_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL52
+#define IMPL_SEQFOR_UNTIL52_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL52_B
+#define IMPL_SEQFOR_UNTIL52_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL52
+#define IMPL_SEQFOR_UNTIL52_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL52
+#define IMPL_SEQFOR_UNTIL52_B_1_1 IMPL_SEQFOR_TRACE_STOP52
+#define IMPL_SEQFOR_ZIP52_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL52
+#define IMPL_SEQFOR_ZIP52_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL52
+#define IMPL_SEQFOR_ZIP52_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP52_C
+#define IMPL_SEQFOR_ZIP52_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL52(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE52_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE52_B
+#define IMPL_SEQFOR_SIMPLE52_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE52_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
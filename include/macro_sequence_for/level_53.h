@@ -0,0 +1,113 @@
+// Nesting level 53 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH53(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH53, 54) IMPL_SEQFOR_IDENTITY53( IMPL_SEQFOR_FOR_GUIDE53_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE53(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE53, 54) IMPL_SEQFOR_IDENTITY53( IMPL_SEQFOR_SIMPLE53_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST53(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST53, 54) IMPL_SEQFOR_IDENTITY53( IMPL_SEQFOR_FAST53_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL53(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL53, 54) IMPL_SEQFOR_IDENTITY53( IMPL_SEQFOR_UNTIL53_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP53(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP53, 54) IMPL_SEQFOR_IDENTITY53( IMPL_SEQFOR_ZIP53_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS53(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS53, 54) IMPL_SEQFOR_IDENTITY53( IMPL_SEQFOR_FOR_GUIDE53_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP53(m, seq) IMPL_SEQFOR_IDENTITY53( IMPL_SEQFOR_MAP53_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER53(p, seq) IMPL_SEQFOR_IDENTITY53( IMPL_SEQFOR_FILTER53_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G53(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G53, 54) IMPL_SEQFOR_FOR_GUIDE53_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G53(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G53, 54) IMPL_SEQFOR_SIMPLE53_A(m, g) )
+#define SF_FOR_EACH_FAST_G53(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G53, 54) IMPL_SEQFOR_FAST53_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G53(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G53, 54) IMPL_SEQFOR_UNTIL53_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G53(m, g) IMPL_SEQFOR_MAP_G53_A(m, g) )
+#define SF_SEQ_FILTER_G53(p, g) IMPL_SEQFOR_FILTER_G53_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY53(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE53_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE53_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE53_A_ IMPL_SEQFOR_FOR_GUIDE53_B
+#define IMPL_SEQFOR_FOR_GUIDE53_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE53_END
+#define IMPL_SEQFOR_FOR_GUIDE53_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE53_END
+#define IMPL_SEQFOR_FOR_GUIDE53_END(m, s, f, d, ...) f(54, d)
+#define IMPL_SEQFOR_FOR_GUIDE53_B(m, s, f, d, ...) m(54, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE53_B_0(m, s, f, s(54, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE53_B_0(...) IMPL_SEQFOR_FOR_GUIDE53_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE53_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE53_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST53_A(m, s, f, d, e) IMPL_SEQFOR_FAST53_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST53_A_ IMPL_SEQFOR_FAST53_B
+#define IMPL_SEQFOR_FAST53_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE53_END
+#define IMPL_SEQFOR_FAST53_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE53_END
+#define IMPL_SEQFOR_FAST53_B(m, s, f, d, ...) m(54, d, __VA_ARGS__) IMPL_SEQFOR_FAST53_A(m, s, f, s(54, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL53_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL53_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL53_A_ IMPL_SEQFOR_UNTIL53_B
+#define IMPL_SEQFOR_UNTIL53_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE53_END
+#define IMPL_SEQFOR_UNTIL53_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE53_END
+#define IMPL_SEQFOR_UNTIL53_B(m, s, f, d, ...) m(54, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL53_B_0(m, s, f, s(54, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL53_B_0(...) IMPL_SEQFOR_UNTIL53_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL53_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL53_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL53_B_1_0 IMPL_SEQFOR_UNTIL53_A
+#define IMPL_SEQFOR_UNTIL53_B_1_1 IMPL_SEQFOR_UNTIL53_STOP
+#define IMPL_SEQFOR_UNTIL53_STOP(m, s, f, d, e) f(54, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP53_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP53_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP53_A_ IMPL_SEQFOR_ZIP53_B
+#define IMPL_SEQFOR_ZIP53_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE53_END
+#define IMPL_SEQFOR_ZIP53_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE53_END
+#define IMPL_SEQFOR_ZIP53_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP53_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP53_B_0(...) IMPL_SEQFOR_ZIP53_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP53_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP53_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP53_B_1_0 IMPL_SEQFOR_ZIP53_C
+#define IMPL_SEQFOR_ZIP53_B_1_1(m, s, f, d, ...) f(54, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP53_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP53_C(m, s, f, d, r, ...) m(54, d, __VA_ARGS__) IMPL_SEQFOR_ZIP53_A(m, s, f, s(54, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE53_A(m, e) IMPL_SEQFOR_SIMPLE53_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE53_A_ IMPL_SEQFOR_SIMPLE53_B
+#define IMPL_SEQFOR_SIMPLE53_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE53_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE53_B(m, ...) m(54, __VA_ARGS__) IMPL_SEQFOR_SIMPLE53_A(m,
+#define IMPL_SEQFOR_MAP53_A(m, e) IMPL_SEQFOR_MAP53_A_##e(m,
+#define IMPL_SEQFOR_MAP53_A_ IMPL_SEQFOR_MAP53_B
+#define IMPL_SEQFOR_MAP53_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP53_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP53_B(m, ...) (m(54, __VA_ARGS__)) IMPL_SEQFOR_MAP53_A(m,
+#define IMPL_SEQFOR_FILTER53_A(p, e) IMPL_SEQFOR_FILTER53_A_##e(p,
+#define IMPL_SEQFOR_FILTER53_A_ IMPL_SEQFOR_FILTER53_B
+#define IMPL_SEQFOR_FILTER53_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER53_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER53_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(54, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER53_A(p,
+#define IMPL_SEQFOR_MAP_G53_A(m, e) IMPL_SEQFOR_MAP_G53_A_##e(m,
+#define IMPL_SEQFOR_MAP_G53_A_ IMPL_SEQFOR_MAP_G53_B
+#define IMPL_SEQFOR_MAP_G53_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G53_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G53_B(m, ...) )m(54, __VA_ARGS__)) IMPL_SEQFOR_MAP_G53_A(m,
+#define IMPL_SEQFOR_FILTER_G53_A(p, e) IMPL_SEQFOR_FILTER_G53_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G53_A_ IMPL_SEQFOR_FILTER_G53_B
+#define IMPL_SEQFOR_FILTER_G53_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G53_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G53_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(54, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G53_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL53(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE53_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP53(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL53(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE53_A_
+#undef IMPL_SEQFOR_FOR_GUIDE53_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE53_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST53_A_
+#undef IMPL_SEQFOR_FAST53_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST53_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL53_A_
+#undef IMPL_SEQFOR_UNTIL53_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL53_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL53_B_1_1
+#undef IMPL_SEQFOR_ZIP53_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP53_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP53_B_1_0
+#undef IMPL_SEQFOR_ZIP53_B_1_1
+#undef IMPL_SEQFOR_SIMPLE53_A_
+#undef IMPL_SEQFOR_SIMPLE53_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE53_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE53_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE53_B
+#define IMPL_SEQFOR_FOR_GUIDE53_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL53
+#define IMPL_SEQFOR_FOR_GUIDE53_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL53
+#define IMPL_SEQFOR_FAST53_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST53_B
+#define IMPL_SEQFOR_FAST53_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL53
+#define IMPL_SEQFOR_FAST53_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL53
+#define IMPL_SEQFOR_UNTIL53_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL53_B
+#define IMPL_SEQFOR_UNTIL53_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL53
+#define IMPL_SEQFOR_UNTIL53_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL53
+#define IMPL_SEQFOR_UNTIL53_B_1_1 IMPL_SEQFOR_TRACE_STOP53
+#define IMPL_SEQFOR_ZIP53_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL53
+#define IMPL_SEQFOR_ZIP53_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL53
+#define IMPL_SEQFOR_ZIP53_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP53_C
+#define IMPL_SEQFOR_ZIP53_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL53(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE53_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE53_B
+#define IMPL_SEQFOR_SIMPLE53_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE53_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 54 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH54(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH54, 55) IMPL_SEQFOR_IDENTITY54( IMPL_SEQFOR_FOR_GUIDE54_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE54(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE54, 55) IMPL_SEQFOR_IDENTITY54( IMPL_SEQFOR_SIMPLE54_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST54(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST54, 55) IMPL_SEQFOR_IDENTITY54( IMPL_SEQFOR_FAST54_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL54(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL54, 55) IMPL_SEQFOR_IDENTITY54( IMPL_SEQFOR_UNTIL54_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP54(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP54, 55) IMPL_SEQFOR_IDENTITY54( IMPL_SEQFOR_ZIP54_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS54(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS54, 55) IMPL_SEQFOR_IDENTITY54( IMPL_SEQFOR_FOR_GUIDE54_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP54(m, seq) IMPL_SEQFOR_IDENTITY54( IMPL_SEQFOR_MAP54_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER54(p, seq) IMPL_SEQFOR_IDENTITY54( IMPL_SEQFOR_FILTER54_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G54(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G54, 55) IMPL_SEQFOR_FOR_GUIDE54_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G54(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G54, 55) IMPL_SEQFOR_SIMPLE54_A(m, g) )
+#define SF_FOR_EACH_FAST_G54(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G54, 55) IMPL_SEQFOR_FAST54_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G54(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G54, 55) IMPL_SEQFOR_UNTIL54_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G54(m, g) IMPL_SEQFOR_MAP_G54_A(m, g) )
+#define SF_SEQ_FILTER_G54(p, g) IMPL_SEQFOR_FILTER_G54_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY54(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE54_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE54_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE54_A_ IMPL_SEQFOR_FOR_GUIDE54_B
+#define IMPL_SEQFOR_FOR_GUIDE54_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE54_END
+#define IMPL_SEQFOR_FOR_GUIDE54_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE54_END
+#define IMPL_SEQFOR_FOR_GUIDE54_END(m, s, f, d, ...) f(55, d)
+#define IMPL_SEQFOR_FOR_GUIDE54_B(m, s, f, d, ...) m(55, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE54_B_0(m, s, f, s(55, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE54_B_0(...) IMPL_SEQFOR_FOR_GUIDE54_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE54_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE54_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST54_A(m, s, f, d, e) IMPL_SEQFOR_FAST54_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST54_A_ IMPL_SEQFOR_FAST54_B
+#define IMPL_SEQFOR_FAST54_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE54_END
+#define IMPL_SEQFOR_FAST54_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE54_END
+#define IMPL_SEQFOR_FAST54_B(m, s, f, d, ...) m(55, d, __VA_ARGS__) IMPL_SEQFOR_FAST54_A(m, s, f, s(55, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL54_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL54_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL54_A_ IMPL_SEQFOR_UNTIL54_B
+#define IMPL_SEQFOR_UNTIL54_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE54_END
+#define IMPL_SEQFOR_UNTIL54_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE54_END
+#define IMPL_SEQFOR_UNTIL54_B(m, s, f, d, ...) m(55, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL54_B_0(m, s, f, s(55, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL54_B_0(...) IMPL_SEQFOR_UNTIL54_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL54_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL54_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL54_B_1_0 IMPL_SEQFOR_UNTIL54_A
+#define IMPL_SEQFOR_UNTIL54_B_1_1 IMPL_SEQFOR_UNTIL54_STOP
+#define IMPL_SEQFOR_UNTIL54_STOP(m, s, f, d, e) f(55, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP54_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP54_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP54_A_ IMPL_SEQFOR_ZIP54_B
+#define IMPL_SEQFOR_ZIP54_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE54_END
+#define IMPL_SEQFOR_ZIP54_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE54_END
+#define IMPL_SEQFOR_ZIP54_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP54_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP54_B_0(...) IMPL_SEQFOR_ZIP54_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP54_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP54_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP54_B_1_0 IMPL_SEQFOR_ZIP54_C
+#define IMPL_SEQFOR_ZIP54_B_1_1(m, s, f, d, ...) f(55, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP54_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP54_C(m, s, f, d, r, ...) m(55, d, __VA_ARGS__) IMPL_SEQFOR_ZIP54_A(m, s, f, s(55, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE54_A(m, e) IMPL_SEQFOR_SIMPLE54_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE54_A_ IMPL_SEQFOR_SIMPLE54_B
+#define IMPL_SEQFOR_SIMPLE54_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE54_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE54_B(m, ...) m(55, __VA_ARGS__) IMPL_SEQFOR_SIMPLE54_A(m,
+#define IMPL_SEQFOR_MAP54_A(m, e) IMPL_SEQFOR_MAP54_A_##e(m,
+#define IMPL_SEQFOR_MAP54_A_ IMPL_SEQFOR_MAP54_B
+#define IMPL_SEQFOR_MAP54_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP54_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP54_B(m, ...) (m(55, __VA_ARGS__)) IMPL_SEQFOR_MAP54_A(m,
+#define IMPL_SEQFOR_FILTER54_A(p, e) IMPL_SEQFOR_FILTER54_A_##e(p,
+#define IMPL_SEQFOR_FILTER54_A_ IMPL_SEQFOR_FILTER54_B
+#define IMPL_SEQFOR_FILTER54_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER54_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER54_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(55, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER54_A(p,
+#define IMPL_SEQFOR_MAP_G54_A(m, e) IMPL_SEQFOR_MAP_G54_A_##e(m,
+#define IMPL_SEQFOR_MAP_G54_A_ IMPL_SEQFOR_MAP_G54_B
+#define IMPL_SEQFOR_MAP_G54_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G54_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G54_B(m, ...) )m(55, __VA_ARGS__)) IMPL_SEQFOR_MAP_G54_A(m,
+#define IMPL_SEQFOR_FILTER_G54_A(p, e) IMPL_SEQFOR_FILTER_G54_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G54_A_ IMPL_SEQFOR_FILTER_G54_B
+#define IMPL_SEQFOR_FILTER_G54_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G54_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G54_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(55, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G54_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL54(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE54_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP54(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL54(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE54_A_
+#undef IMPL_SEQFOR_FOR_GUIDE54_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE54_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST54_A_
+#undef IMPL_SEQFOR_FAST54_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST54_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL54_A_
+#undef IMPL_SEQFOR_UNTIL54_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL54_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL54_B_1_1
+#undef IMPL_SEQFOR_ZIP54_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP54_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP54_B_1_0
+#undef IMPL_SEQFOR_ZIP54_B_1_1
+#undef IMPL_SEQFOR_SIMPLE54_A_
+#undef IMPL_SEQFOR_SIMPLE54_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE54_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE54_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE54_B
+#define IMPL_SEQFOR_FOR_GUIDE54_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL54
+#define IMPL_SEQFOR_FOR_GUIDE54_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL54
+#define IMPL_SEQFOR_FAST54_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST54_B
+#define IMPL_SEQFOR_FAST54_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL54
+#define IMPL_SEQFOR_FAST54_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL54
+#define IMPL_SEQFOR_UNTIL54_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL54_B
+#define IMPL_SEQFOR_UNTIL54_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL54
+#define IMPL_SEQFOR_UNTIL54_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL54
+#define IMPL_SEQFOR_UNTIL54_B_1_1 IMPL_SEQFOR_TRACE_STOP54
+#define IMPL_SEQFOR_ZIP54_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL54
+#define IMPL_SEQFOR_ZIP54_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL54
+#define IMPL_SEQFOR_ZIP54_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP54_C
+#define IMPL_SEQFOR_ZIP54_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL54(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE54_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE54_B
+#define IMPL_SEQFOR_SIMPLE54_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE54_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 55 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH55(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH55, 56) IMPL_SEQFOR_IDENTITY55( IMPL_SEQFOR_FOR_GUIDE55_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE55(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE55, 56) IMPL_SEQFOR_IDENTITY55( IMPL_SEQFOR_SIMPLE55_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST55(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST55, 56) IMPL_SEQFOR_IDENTITY55( IMPL_SEQFOR_FAST55_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL55(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL55, 56) IMPL_SEQFOR_IDENTITY55( IMPL_SEQFOR_UNTIL55_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP55(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP55, 56) IMPL_SEQFOR_IDENTITY55( IMPL_SEQFOR_ZIP55_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS55(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS55, 56) IMPL_SEQFOR_IDENTITY55( IMPL_SEQFOR_FOR_GUIDE55_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP55(m, seq) IMPL_SEQFOR_IDENTITY55( IMPL_SEQFOR_MAP55_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER55(p, seq) IMPL_SEQFOR_IDENTITY55( IMPL_SEQFOR_FILTER55_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G55(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G55, 56) IMPL_SEQFOR_FOR_GUIDE55_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G55(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G55, 56) IMPL_SEQFOR_SIMPLE55_A(m, g) )
+#define SF_FOR_EACH_FAST_G55(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G55, 56) IMPL_SEQFOR_FAST55_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G55(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G55, 56) IMPL_SEQFOR_UNTIL55_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G55(m, g) IMPL_SEQFOR_MAP_G55_A(m, g) )
+#define SF_SEQ_FILTER_G55(p, g) IMPL_SEQFOR_FILTER_G55_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY55(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE55_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE55_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE55_A_ IMPL_SEQFOR_FOR_GUIDE55_B
+#define IMPL_SEQFOR_FOR_GUIDE55_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE55_END
+#define IMPL_SEQFOR_FOR_GUIDE55_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE55_END
+#define IMPL_SEQFOR_FOR_GUIDE55_END(m, s, f, d, ...) f(56, d)
+#define IMPL_SEQFOR_FOR_GUIDE55_B(m, s, f, d, ...) m(56, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE55_B_0(m, s, f, s(56, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE55_B_0(...) IMPL_SEQFOR_FOR_GUIDE55_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE55_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE55_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST55_A(m, s, f, d, e) IMPL_SEQFOR_FAST55_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST55_A_ IMPL_SEQFOR_FAST55_B
+#define IMPL_SEQFOR_FAST55_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE55_END
+#define IMPL_SEQFOR_FAST55_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE55_END
+#define IMPL_SEQFOR_FAST55_B(m, s, f, d, ...) m(56, d, __VA_ARGS__) IMPL_SEQFOR_FAST55_A(m, s, f, s(56, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL55_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL55_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL55_A_ IMPL_SEQFOR_UNTIL55_B
+#define IMPL_SEQFOR_UNTIL55_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE55_END
+#define IMPL_SEQFOR_UNTIL55_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE55_END
+#define IMPL_SEQFOR_UNTIL55_B(m, s, f, d, ...) m(56, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL55_B_0(m, s, f, s(56, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL55_B_0(...) IMPL_SEQFOR_UNTIL55_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL55_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL55_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL55_B_1_0 IMPL_SEQFOR_UNTIL55_A
+#define IMPL_SEQFOR_UNTIL55_B_1_1 IMPL_SEQFOR_UNTIL55_STOP
+#define IMPL_SEQFOR_UNTIL55_STOP(m, s, f, d, e) f(56, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP55_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP55_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP55_A_ IMPL_SEQFOR_ZIP55_B
+#define IMPL_SEQFOR_ZIP55_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE55_END
+#define IMPL_SEQFOR_ZIP55_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE55_END
+#define IMPL_SEQFOR_ZIP55_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP55_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP55_B_0(...) IMPL_SEQFOR_ZIP55_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP55_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP55_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP55_B_1_0 IMPL_SEQFOR_ZIP55_C
+#define IMPL_SEQFOR_ZIP55_B_1_1(m, s, f, d, ...) f(56, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP55_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP55_C(m, s, f, d, r, ...) m(56, d, __VA_ARGS__) IMPL_SEQFOR_ZIP55_A(m, s, f, s(56, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE55_A(m, e) IMPL_SEQFOR_SIMPLE55_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE55_A_ IMPL_SEQFOR_SIMPLE55_B
+#define IMPL_SEQFOR_SIMPLE55_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE55_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE55_B(m, ...) m(56, __VA_ARGS__) IMPL_SEQFOR_SIMPLE55_A(m,
+#define IMPL_SEQFOR_MAP55_A(m, e) IMPL_SEQFOR_MAP55_A_##e(m,
+#define IMPL_SEQFOR_MAP55_A_ IMPL_SEQFOR_MAP55_B
+#define IMPL_SEQFOR_MAP55_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP55_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP55_B(m, ...) (m(56, __VA_ARGS__)) IMPL_SEQFOR_MAP55_A(m,
+#define IMPL_SEQFOR_FILTER55_A(p, e) IMPL_SEQFOR_FILTER55_A_##e(p,
+#define IMPL_SEQFOR_FILTER55_A_ IMPL_SEQFOR_FILTER55_B
+#define IMPL_SEQFOR_FILTER55_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER55_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER55_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(56, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER55_A(p,
+#define IMPL_SEQFOR_MAP_G55_A(m, e) IMPL_SEQFOR_MAP_G55_A_##e(m,
+#define IMPL_SEQFOR_MAP_G55_A_ IMPL_SEQFOR_MAP_G55_B
+#define IMPL_SEQFOR_MAP_G55_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G55_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G55_B(m, ...) )m(56, __VA_ARGS__)) IMPL_SEQFOR_MAP_G55_A(m,
+#define IMPL_SEQFOR_FILTER_G55_A(p, e) IMPL_SEQFOR_FILTER_G55_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G55_A_ IMPL_SEQFOR_FILTER_G55_B
+#define IMPL_SEQFOR_FILTER_G55_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G55_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G55_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(56, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G55_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL55(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE55_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP55(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL55(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE55_A_
+#undef IMPL_SEQFOR_FOR_GUIDE55_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE55_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST55_A_
+#undef IMPL_SEQFOR_FAST55_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST55_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL55_A_
+#undef IMPL_SEQFOR_UNTIL55_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL55_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL55_B_1_1
+#undef IMPL_SEQFOR_ZIP55_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP55_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP55_B_1_0
+#undef IMPL_SEQFOR_ZIP55_B_1_1
+#undef IMPL_SEQFOR_SIMPLE55_A_
+#undef IMPL_SEQFOR_SIMPLE55_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE55_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE55_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE55_B
+#define IMPL_SEQFOR_FOR_GUIDE55_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL55
+#define IMPL_SEQFOR_FOR_GUIDE55_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL55
+#define IMPL_SEQFOR_FAST55_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST55_B
+#define IMPL_SEQFOR_FAST55_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL55
+#define IMPL_SEQFOR_FAST55_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL55
+#define IMPL_SEQFOR_UNTIL55_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL55_B
+#define IMPL_SEQFOR_UNTIL55_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL55
+#define IMPL_SEQFOR_UNTIL55_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL55
+#define IMPL_SEQFOR_UNTIL55_B_1_1 IMPL_SEQFOR_TRACE_STOP55
+#define IMPL_SEQFOR_ZIP55_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL55
+#define IMPL_SEQFOR_ZIP55_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL55
+#define IMPL_SEQFOR_ZIP55_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP55_C
+#define IMPL_SEQFOR_ZIP55_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL55(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE55_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE55_B
+#define IMPL_SEQFOR_SIMPLE55_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE55_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
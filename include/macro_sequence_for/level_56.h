@@ -0,0 +1,113 @@
+// Nesting level 56 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH56(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH56, 57) IMPL_SEQFOR_IDENTITY56( IMPL_SEQFOR_FOR_GUIDE56_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE56(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE56, 57) IMPL_SEQFOR_IDENTITY56( IMPL_SEQFOR_SIMPLE56_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST56(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST56, 57) IMPL_SEQFOR_IDENTITY56( IMPL_SEQFOR_FAST56_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL56(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL56, 57) IMPL_SEQFOR_IDENTITY56( IMPL_SEQFOR_UNTIL56_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP56(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP56, 57) IMPL_SEQFOR_IDENTITY56( IMPL_SEQFOR_ZIP56_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS56(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS56, 57) IMPL_SEQFOR_IDENTITY56( IMPL_SEQFOR_FOR_GUIDE56_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP56(m, seq) IMPL_SEQFOR_IDENTITY56( IMPL_SEQFOR_MAP56_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER56(p, seq) IMPL_SEQFOR_IDENTITY56( IMPL_SEQFOR_FILTER56_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G56(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G56, 57) IMPL_SEQFOR_FOR_GUIDE56_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G56(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G56, 57) IMPL_SEQFOR_SIMPLE56_A(m, g) )
+#define SF_FOR_EACH_FAST_G56(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G56, 57) IMPL_SEQFOR_FAST56_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G56(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G56, 57) IMPL_SEQFOR_UNTIL56_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G56(m, g) IMPL_SEQFOR_MAP_G56_A(m, g) )
+#define SF_SEQ_FILTER_G56(p, g) IMPL_SEQFOR_FILTER_G56_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY56(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE56_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE56_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE56_A_ IMPL_SEQFOR_FOR_GUIDE56_B
+#define IMPL_SEQFOR_FOR_GUIDE56_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE56_END
+#define IMPL_SEQFOR_FOR_GUIDE56_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE56_END
+#define IMPL_SEQFOR_FOR_GUIDE56_END(m, s, f, d, ...) f(57, d)
+#define IMPL_SEQFOR_FOR_GUIDE56_B(m, s, f, d, ...) m(57, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE56_B_0(m, s, f, s(57, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE56_B_0(...) IMPL_SEQFOR_FOR_GUIDE56_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE56_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE56_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST56_A(m, s, f, d, e) IMPL_SEQFOR_FAST56_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST56_A_ IMPL_SEQFOR_FAST56_B
+#define IMPL_SEQFOR_FAST56_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE56_END
+#define IMPL_SEQFOR_FAST56_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE56_END
+#define IMPL_SEQFOR_FAST56_B(m, s, f, d, ...) m(57, d, __VA_ARGS__) IMPL_SEQFOR_FAST56_A(m, s, f, s(57, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL56_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL56_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL56_A_ IMPL_SEQFOR_UNTIL56_B
+#define IMPL_SEQFOR_UNTIL56_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE56_END
+#define IMPL_SEQFOR_UNTIL56_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE56_END
+#define IMPL_SEQFOR_UNTIL56_B(m, s, f, d, ...) m(57, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL56_B_0(m, s, f, s(57, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL56_B_0(...) IMPL_SEQFOR_UNTIL56_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL56_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL56_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL56_B_1_0 IMPL_SEQFOR_UNTIL56_A
+#define IMPL_SEQFOR_UNTIL56_B_1_1 IMPL_SEQFOR_UNTIL56_STOP
+#define IMPL_SEQFOR_UNTIL56_STOP(m, s, f, d, e) f(57, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP56_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP56_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP56_A_ IMPL_SEQFOR_ZIP56_B
+#define IMPL_SEQFOR_ZIP56_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE56_END
+#define IMPL_SEQFOR_ZIP56_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE56_END
+#define IMPL_SEQFOR_ZIP56_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP56_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP56_B_0(...) IMPL_SEQFOR_ZIP56_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP56_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP56_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP56_B_1_0 IMPL_SEQFOR_ZIP56_C
+#define IMPL_SEQFOR_ZIP56_B_1_1(m, s, f, d, ...) f(57, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP56_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP56_C(m, s, f, d, r, ...) m(57, d, __VA_ARGS__) IMPL_SEQFOR_ZIP56_A(m, s, f, s(57, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE56_A(m, e) IMPL_SEQFOR_SIMPLE56_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE56_A_ IMPL_SEQFOR_SIMPLE56_B
+#define IMPL_SEQFOR_SIMPLE56_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE56_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE56_B(m, ...) m(57, __VA_ARGS__) IMPL_SEQFOR_SIMPLE56_A(m,
+#define IMPL_SEQFOR_MAP56_A(m, e) IMPL_SEQFOR_MAP56_A_##e(m,
+#define IMPL_SEQFOR_MAP56_A_ IMPL_SEQFOR_MAP56_B
+#define IMPL_SEQFOR_MAP56_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP56_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP56_B(m, ...) (m(57, __VA_ARGS__)) IMPL_SEQFOR_MAP56_A(m,
+#define IMPL_SEQFOR_FILTER56_A(p, e) IMPL_SEQFOR_FILTER56_A_##e(p,
+#define IMPL_SEQFOR_FILTER56_A_ IMPL_SEQFOR_FILTER56_B
+#define IMPL_SEQFOR_FILTER56_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER56_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER56_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(57, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER56_A(p,
+#define IMPL_SEQFOR_MAP_G56_A(m, e) IMPL_SEQFOR_MAP_G56_A_##e(m,
+#define IMPL_SEQFOR_MAP_G56_A_ IMPL_SEQFOR_MAP_G56_B
+#define IMPL_SEQFOR_MAP_G56_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G56_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G56_B(m, ...) )m(57, __VA_ARGS__)) IMPL_SEQFOR_MAP_G56_A(m,
+#define IMPL_SEQFOR_FILTER_G56_A(p, e) IMPL_SEQFOR_FILTER_G56_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G56_A_ IMPL_SEQFOR_FILTER_G56_B
+#define IMPL_SEQFOR_FILTER_G56_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G56_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G56_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(57, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G56_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL56(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE56_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP56(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL56(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE56_A_
+#undef IMPL_SEQFOR_FOR_GUIDE56_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE56_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST56_A_
+#undef IMPL_SEQFOR_FAST56_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST56_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL56_A_
+#undef IMPL_SEQFOR_UNTIL56_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL56_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL56_B_1_1
+#undef IMPL_SEQFOR_ZIP56_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP56_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP56_B_1_0
+#undef IMPL_SEQFOR_ZIP56_B_1_1
+#undef IMPL_SEQFOR_SIMPLE56_A_
+#undef IMPL_SEQFOR_SIMPLE56_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE56_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE56_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE56_B
+#define IMPL_SEQFOR_FOR_GUIDE56_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL56
+#define IMPL_SEQFOR_FOR_GUIDE56_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL56
+#define IMPL_SEQFOR_FAST56_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST56_B
+#define IMPL_SEQFOR_FAST56_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL56
+#define IMPL_SEQFOR_FAST56_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL56
+#define IMPL_SEQFOR_UNTIL56_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL56_B
+#define IMPL_SEQFOR_UNTIL56_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL56
+#define IMPL_SEQFOR_UNTIL56_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL56
+#define IMPL_SEQFOR_UNTIL56_B_1_1 IMPL_SEQFOR_TRACE_STOP56
+#define IMPL_SEQFOR_ZIP56_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL56
+#define IMPL_SEQFOR_ZIP56_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL56
+#define IMPL_SEQFOR_ZIP56_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP56_C
+#define IMPL_SEQFOR_ZIP56_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL56(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE56_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE56_B
+#define IMPL_SEQFOR_SIMPLE56_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE56_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
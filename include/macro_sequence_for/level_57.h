@@ -0,0 +1,113 @@
+// Nesting level 57 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH57(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH57, 58) IMPL_SEQFOR_IDENTITY57( IMPL_SEQFOR_FOR_GUIDE57_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE57(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE57, 58) IMPL_SEQFOR_IDENTITY57( IMPL_SEQFOR_SIMPLE57_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST57(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST57, 58) IMPL_SEQFOR_IDENTITY57( IMPL_SEQFOR_FAST57_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL57(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL57, 58) IMPL_SEQFOR_IDENTITY57( IMPL_SEQFOR_UNTIL57_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP57(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP57, 58) IMPL_SEQFOR_IDENTITY57( IMPL_SEQFOR_ZIP57_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS57(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS57, 58) IMPL_SEQFOR_IDENTITY57( IMPL_SEQFOR_FOR_GUIDE57_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP57(m, seq) IMPL_SEQFOR_IDENTITY57( IMPL_SEQFOR_MAP57_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER57(p, seq) IMPL_SEQFOR_IDENTITY57( IMPL_SEQFOR_FILTER57_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G57(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G57, 58) IMPL_SEQFOR_FOR_GUIDE57_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G57(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G57, 58) IMPL_SEQFOR_SIMPLE57_A(m, g) )
+#define SF_FOR_EACH_FAST_G57(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G57, 58) IMPL_SEQFOR_FAST57_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G57(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G57, 58) IMPL_SEQFOR_UNTIL57_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G57(m, g) IMPL_SEQFOR_MAP_G57_A(m, g) )
+#define SF_SEQ_FILTER_G57(p, g) IMPL_SEQFOR_FILTER_G57_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY57(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE57_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE57_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE57_A_ IMPL_SEQFOR_FOR_GUIDE57_B
+#define IMPL_SEQFOR_FOR_GUIDE57_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE57_END
+#define IMPL_SEQFOR_FOR_GUIDE57_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE57_END
+#define IMPL_SEQFOR_FOR_GUIDE57_END(m, s, f, d, ...) f(58, d)
+#define IMPL_SEQFOR_FOR_GUIDE57_B(m, s, f, d, ...) m(58, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE57_B_0(m, s, f, s(58, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE57_B_0(...) IMPL_SEQFOR_FOR_GUIDE57_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE57_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE57_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST57_A(m, s, f, d, e) IMPL_SEQFOR_FAST57_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST57_A_ IMPL_SEQFOR_FAST57_B
+#define IMPL_SEQFOR_FAST57_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE57_END
+#define IMPL_SEQFOR_FAST57_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE57_END
+#define IMPL_SEQFOR_FAST57_B(m, s, f, d, ...) m(58, d, __VA_ARGS__) IMPL_SEQFOR_FAST57_A(m, s, f, s(58, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL57_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL57_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL57_A_ IMPL_SEQFOR_UNTIL57_B
+#define IMPL_SEQFOR_UNTIL57_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE57_END
+#define IMPL_SEQFOR_UNTIL57_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE57_END
+#define IMPL_SEQFOR_UNTIL57_B(m, s, f, d, ...) m(58, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL57_B_0(m, s, f, s(58, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL57_B_0(...) IMPL_SEQFOR_UNTIL57_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL57_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL57_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL57_B_1_0 IMPL_SEQFOR_UNTIL57_A
+#define IMPL_SEQFOR_UNTIL57_B_1_1 IMPL_SEQFOR_UNTIL57_STOP
+#define IMPL_SEQFOR_UNTIL57_STOP(m, s, f, d, e) f(58, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP57_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP57_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP57_A_ IMPL_SEQFOR_ZIP57_B
+#define IMPL_SEQFOR_ZIP57_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE57_END
+#define IMPL_SEQFOR_ZIP57_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE57_END
+#define IMPL_SEQFOR_ZIP57_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP57_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP57_B_0(...) IMPL_SEQFOR_ZIP57_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP57_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP57_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP57_B_1_0 IMPL_SEQFOR_ZIP57_C
+#define IMPL_SEQFOR_ZIP57_B_1_1(m, s, f, d, ...) f(58, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP57_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP57_C(m, s, f, d, r, ...) m(58, d, __VA_ARGS__) IMPL_SEQFOR_ZIP57_A(m, s, f, s(58, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE57_A(m, e) IMPL_SEQFOR_SIMPLE57_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE57_A_ IMPL_SEQFOR_SIMPLE57_B
+#define IMPL_SEQFOR_SIMPLE57_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE57_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE57_B(m, ...) m(58, __VA_ARGS__) IMPL_SEQFOR_SIMPLE57_A(m,
+#define IMPL_SEQFOR_MAP57_A(m, e) IMPL_SEQFOR_MAP57_A_##e(m,
+#define IMPL_SEQFOR_MAP57_A_ IMPL_SEQFOR_MAP57_B
+#define IMPL_SEQFOR_MAP57_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP57_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP57_B(m, ...) (m(58, __VA_ARGS__)) IMPL_SEQFOR_MAP57_A(m,
+#define IMPL_SEQFOR_FILTER57_A(p, e) IMPL_SEQFOR_FILTER57_A_##e(p,
+#define IMPL_SEQFOR_FILTER57_A_ IMPL_SEQFOR_FILTER57_B
+#define IMPL_SEQFOR_FILTER57_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER57_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER57_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(58, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER57_A(p,
+#define IMPL_SEQFOR_MAP_G57_A(m, e) IMPL_SEQFOR_MAP_G57_A_##e(m,
+#define IMPL_SEQFOR_MAP_G57_A_ IMPL_SEQFOR_MAP_G57_B
+#define IMPL_SEQFOR_MAP_G57_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G57_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G57_B(m, ...) )m(58, __VA_ARGS__)) IMPL_SEQFOR_MAP_G57_A(m,
+#define IMPL_SEQFOR_FILTER_G57_A(p, e) IMPL_SEQFOR_FILTER_G57_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G57_A_ IMPL_SEQFOR_FILTER_G57_B
+#define IMPL_SEQFOR_FILTER_G57_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G57_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G57_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(58, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G57_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL57(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE57_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP57(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL57(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE57_A_
+#undef IMPL_SEQFOR_FOR_GUIDE57_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE57_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST57_A_
+#undef IMPL_SEQFOR_FAST57_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST57_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL57_A_
+#undef IMPL_SEQFOR_UNTIL57_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL57_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL57_B_1_1
+#undef IMPL_SEQFOR_ZIP57_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP57_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP57_B_1_0
+#undef IMPL_SEQFOR_ZIP57_B_1_1
+#undef IMPL_SEQFOR_SIMPLE57_A_
+#undef IMPL_SEQFOR_SIMPLE57_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE57_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE57_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE57_B
+#define IMPL_SEQFOR_FOR_GUIDE57_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL57
+#define IMPL_SEQFOR_FOR_GUIDE57_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL57
+#define IMPL_SEQFOR_FAST57_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST57_B
+#define IMPL_SEQFOR_FAST57_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL57
+#define IMPL_SEQFOR_FAST57_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL57
+#define IMPL_SEQFOR_UNTIL57_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL57_B
+#define IMPL_SEQFOR_UNTIL57_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL57
+#define IMPL_SEQFOR_UNTIL57_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL57
+#define IMPL_SEQFOR_UNTIL57_B_1_1 IMPL_SEQFOR_TRACE_STOP57
+#define IMPL_SEQFOR_ZIP57_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL57
+#define IMPL_SEQFOR_ZIP57_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL57
+#define IMPL_SEQFOR_ZIP57_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP57_C
+#define IMPL_SEQFOR_ZIP57_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL57(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE57_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE57_B
+#define IMPL_SEQFOR_SIMPLE57_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE57_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
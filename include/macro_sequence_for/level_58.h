@@ -0,0 +1,113 @@
+// Nesting level 58 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH58(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH58, 59) IMPL_SEQFOR_IDENTITY58( IMPL_SEQFOR_FOR_GUIDE58_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE58(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE58, 59) IMPL_SEQFOR_IDENTITY58( IMPL_SEQFOR_SIMPLE58_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST58(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST58, 59) IMPL_SEQFOR_IDENTITY58( IMPL_SEQFOR_FAST58_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL58(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL58, 59) IMPL_SEQFOR_IDENTITY58( IMPL_SEQFOR_UNTIL58_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP58(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP58, 59) IMPL_SEQFOR_IDENTITY58( IMPL_SEQFOR_ZIP58_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS58(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS58, 59) IMPL_SEQFOR_IDENTITY58( IMPL_SEQFOR_FOR_GUIDE58_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP58(m, seq) IMPL_SEQFOR_IDENTITY58( IMPL_SEQFOR_MAP58_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER58(p, seq) IMPL_SEQFOR_IDENTITY58( IMPL_SEQFOR_FILTER58_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G58(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G58, 59) IMPL_SEQFOR_FOR_GUIDE58_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G58(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G58, 59) IMPL_SEQFOR_SIMPLE58_A(m, g) )
+#define SF_FOR_EACH_FAST_G58(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G58, 59) IMPL_SEQFOR_FAST58_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G58(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G58, 59) IMPL_SEQFOR_UNTIL58_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G58(m, g) IMPL_SEQFOR_MAP_G58_A(m, g) )
+#define SF_SEQ_FILTER_G58(p, g) IMPL_SEQFOR_FILTER_G58_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY58(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE58_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE58_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE58_A_ IMPL_SEQFOR_FOR_GUIDE58_B
+#define IMPL_SEQFOR_FOR_GUIDE58_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE58_END
+#define IMPL_SEQFOR_FOR_GUIDE58_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE58_END
+#define IMPL_SEQFOR_FOR_GUIDE58_END(m, s, f, d, ...) f(59, d)
+#define IMPL_SEQFOR_FOR_GUIDE58_B(m, s, f, d, ...) m(59, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE58_B_0(m, s, f, s(59, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE58_B_0(...) IMPL_SEQFOR_FOR_GUIDE58_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE58_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE58_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST58_A(m, s, f, d, e) IMPL_SEQFOR_FAST58_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST58_A_ IMPL_SEQFOR_FAST58_B
+#define IMPL_SEQFOR_FAST58_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE58_END
+#define IMPL_SEQFOR_FAST58_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE58_END
+#define IMPL_SEQFOR_FAST58_B(m, s, f, d, ...) m(59, d, __VA_ARGS__) IMPL_SEQFOR_FAST58_A(m, s, f, s(59, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL58_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL58_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL58_A_ IMPL_SEQFOR_UNTIL58_B
+#define IMPL_SEQFOR_UNTIL58_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE58_END
+#define IMPL_SEQFOR_UNTIL58_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE58_END
+#define IMPL_SEQFOR_UNTIL58_B(m, s, f, d, ...) m(59, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL58_B_0(m, s, f, s(59, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL58_B_0(...) IMPL_SEQFOR_UNTIL58_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL58_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL58_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL58_B_1_0 IMPL_SEQFOR_UNTIL58_A
+#define IMPL_SEQFOR_UNTIL58_B_1_1 IMPL_SEQFOR_UNTIL58_STOP
+#define IMPL_SEQFOR_UNTIL58_STOP(m, s, f, d, e) f(59, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP58_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP58_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP58_A_ IMPL_SEQFOR_ZIP58_B
+#define IMPL_SEQFOR_ZIP58_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE58_END
+#define IMPL_SEQFOR_ZIP58_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE58_END
+#define IMPL_SEQFOR_ZIP58_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP58_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP58_B_0(...) IMPL_SEQFOR_ZIP58_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP58_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP58_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP58_B_1_0 IMPL_SEQFOR_ZIP58_C
+#define IMPL_SEQFOR_ZIP58_B_1_1(m, s, f, d, ...) f(59, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP58_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP58_C(m, s, f, d, r, ...) m(59, d, __VA_ARGS__) IMPL_SEQFOR_ZIP58_A(m, s, f, s(59, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE58_A(m, e) IMPL_SEQFOR_SIMPLE58_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE58_A_ IMPL_SEQFOR_SIMPLE58_B
+#define IMPL_SEQFOR_SIMPLE58_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE58_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE58_B(m, ...) m(59, __VA_ARGS__) IMPL_SEQFOR_SIMPLE58_A(m,
+#define IMPL_SEQFOR_MAP58_A(m, e) IMPL_SEQFOR_MAP58_A_##e(m,
+#define IMPL_SEQFOR_MAP58_A_ IMPL_SEQFOR_MAP58_B
+#define IMPL_SEQFOR_MAP58_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP58_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP58_B(m, ...) (m(59, __VA_ARGS__)) IMPL_SEQFOR_MAP58_A(m,
+#define IMPL_SEQFOR_FILTER58_A(p, e) IMPL_SEQFOR_FILTER58_A_##e(p,
+#define IMPL_SEQFOR_FILTER58_A_ IMPL_SEQFOR_FILTER58_B
+#define IMPL_SEQFOR_FILTER58_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER58_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER58_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(59, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER58_A(p,
+#define IMPL_SEQFOR_MAP_G58_A(m, e) IMPL_SEQFOR_MAP_G58_A_##e(m,
+#define IMPL_SEQFOR_MAP_G58_A_ IMPL_SEQFOR_MAP_G58_B
+#define IMPL_SEQFOR_MAP_G58_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G58_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G58_B(m, ...) )m(59, __VA_ARGS__)) IMPL_SEQFOR_MAP_G58_A(m,
+#define IMPL_SEQFOR_FILTER_G58_A(p, e) IMPL_SEQFOR_FILTER_G58_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G58_A_ IMPL_SEQFOR_FILTER_G58_B
+#define IMPL_SEQFOR_FILTER_G58_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G58_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G58_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(59, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G58_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL58(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE58_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP58(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL58(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE58_A_
+#undef IMPL_SEQFOR_FOR_GUIDE58_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE58_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST58_A_
+#undef IMPL_SEQFOR_FAST58_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST58_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL58_A_
+#undef IMPL_SEQFOR_UNTIL58_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL58_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL58_B_1_1
+#undef IMPL_SEQFOR_ZIP58_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP58_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP58_B_1_0
+#undef IMPL_SEQFOR_ZIP58_B_1_1
+#undef IMPL_SEQFOR_SIMPLE58_A_
+#undef IMPL_SEQFOR_SIMPLE58_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE58_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE58_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE58_B
+#define IMPL_SEQFOR_FOR_GUIDE58_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL58
+#define IMPL_SEQFOR_FOR_GUIDE58_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL58
+#define IMPL_SEQFOR_FAST58_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST58_B
+#define IMPL_SEQFOR_FAST58_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL58
+#define IMPL_SEQFOR_FAST58_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL58
+#define IMPL_SEQFOR_UNTIL58_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL58_B
+#define IMPL_SEQFOR_UNTIL58_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL58
+#define IMPL_SEQFOR_UNTIL58_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL58
+#define IMPL_SEQFOR_UNTIL58_B_1_1 IMPL_SEQFOR_TRACE_STOP58
+#define IMPL_SEQFOR_ZIP58_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL58
+#define IMPL_SEQFOR_ZIP58_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL58
+#define IMPL_SEQFOR_ZIP58_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP58_C
+#define IMPL_SEQFOR_ZIP58_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL58(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE58_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE58_B
+#define IMPL_SEQFOR_SIMPLE58_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE58_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
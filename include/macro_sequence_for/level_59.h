@@ -0,0 +1,113 @@
+// Nesting level 59 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH59(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH59, 60) IMPL_SEQFOR_IDENTITY59( IMPL_SEQFOR_FOR_GUIDE59_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE59(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE59, 60) IMPL_SEQFOR_IDENTITY59( IMPL_SEQFOR_SIMPLE59_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST59(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST59, 60) IMPL_SEQFOR_IDENTITY59( IMPL_SEQFOR_FAST59_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL59(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL59, 60) IMPL_SEQFOR_IDENTITY59( IMPL_SEQFOR_UNTIL59_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP59(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP59, 60) IMPL_SEQFOR_IDENTITY59( IMPL_SEQFOR_ZIP59_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS59(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS59, 60) IMPL_SEQFOR_IDENTITY59( IMPL_SEQFOR_FOR_GUIDE59_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP59(m, seq) IMPL_SEQFOR_IDENTITY59( IMPL_SEQFOR_MAP59_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER59(p, seq) IMPL_SEQFOR_IDENTITY59( IMPL_SEQFOR_FILTER59_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G59(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G59, 60) IMPL_SEQFOR_FOR_GUIDE59_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G59(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G59, 60) IMPL_SEQFOR_SIMPLE59_A(m, g) )
+#define SF_FOR_EACH_FAST_G59(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G59, 60) IMPL_SEQFOR_FAST59_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G59(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G59, 60) IMPL_SEQFOR_UNTIL59_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G59(m, g) IMPL_SEQFOR_MAP_G59_A(m, g) )
+#define SF_SEQ_FILTER_G59(p, g) IMPL_SEQFOR_FILTER_G59_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY59(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE59_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE59_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE59_A_ IMPL_SEQFOR_FOR_GUIDE59_B
+#define IMPL_SEQFOR_FOR_GUIDE59_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE59_END
+#define IMPL_SEQFOR_FOR_GUIDE59_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE59_END
+#define IMPL_SEQFOR_FOR_GUIDE59_END(m, s, f, d, ...) f(60, d)
+#define IMPL_SEQFOR_FOR_GUIDE59_B(m, s, f, d, ...) m(60, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE59_B_0(m, s, f, s(60, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE59_B_0(...) IMPL_SEQFOR_FOR_GUIDE59_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE59_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE59_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST59_A(m, s, f, d, e) IMPL_SEQFOR_FAST59_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST59_A_ IMPL_SEQFOR_FAST59_B
+#define IMPL_SEQFOR_FAST59_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE59_END
+#define IMPL_SEQFOR_FAST59_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE59_END
+#define IMPL_SEQFOR_FAST59_B(m, s, f, d, ...) m(60, d, __VA_ARGS__) IMPL_SEQFOR_FAST59_A(m, s, f, s(60, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL59_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL59_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL59_A_ IMPL_SEQFOR_UNTIL59_B
+#define IMPL_SEQFOR_UNTIL59_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE59_END
+#define IMPL_SEQFOR_UNTIL59_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE59_END
+#define IMPL_SEQFOR_UNTIL59_B(m, s, f, d, ...) m(60, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL59_B_0(m, s, f, s(60, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL59_B_0(...) IMPL_SEQFOR_UNTIL59_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL59_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL59_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL59_B_1_0 IMPL_SEQFOR_UNTIL59_A
+#define IMPL_SEQFOR_UNTIL59_B_1_1 IMPL_SEQFOR_UNTIL59_STOP
+#define IMPL_SEQFOR_UNTIL59_STOP(m, s, f, d, e) f(60, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP59_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP59_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP59_A_ IMPL_SEQFOR_ZIP59_B
+#define IMPL_SEQFOR_ZIP59_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE59_END
+#define IMPL_SEQFOR_ZIP59_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE59_END
+#define IMPL_SEQFOR_ZIP59_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP59_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP59_B_0(...) IMPL_SEQFOR_ZIP59_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP59_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP59_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP59_B_1_0 IMPL_SEQFOR_ZIP59_C
+#define IMPL_SEQFOR_ZIP59_B_1_1(m, s, f, d, ...) f(60, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP59_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP59_C(m, s, f, d, r, ...) m(60, d, __VA_ARGS__) IMPL_SEQFOR_ZIP59_A(m, s, f, s(60, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE59_A(m, e) IMPL_SEQFOR_SIMPLE59_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE59_A_ IMPL_SEQFOR_SIMPLE59_B
+#define IMPL_SEQFOR_SIMPLE59_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE59_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE59_B(m, ...) m(60, __VA_ARGS__) IMPL_SEQFOR_SIMPLE59_A(m,
+#define IMPL_SEQFOR_MAP59_A(m, e) IMPL_SEQFOR_MAP59_A_##e(m,
+#define IMPL_SEQFOR_MAP59_A_ IMPL_SEQFOR_MAP59_B
+#define IMPL_SEQFOR_MAP59_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP59_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP59_B(m, ...) (m(60, __VA_ARGS__)) IMPL_SEQFOR_MAP59_A(m,
+#define IMPL_SEQFOR_FILTER59_A(p, e) IMPL_SEQFOR_FILTER59_A_##e(p,
+#define IMPL_SEQFOR_FILTER59_A_ IMPL_SEQFOR_FILTER59_B
+#define IMPL_SEQFOR_FILTER59_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER59_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER59_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(60, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER59_A(p,
+#define IMPL_SEQFOR_MAP_G59_A(m, e) IMPL_SEQFOR_MAP_G59_A_##e(m,
+#define IMPL_SEQFOR_MAP_G59_A_ IMPL_SEQFOR_MAP_G59_B
+#define IMPL_SEQFOR_MAP_G59_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G59_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G59_B(m, ...) )m(60, __VA_ARGS__)) IMPL_SEQFOR_MAP_G59_A(m,
+#define IMPL_SEQFOR_FILTER_G59_A(p, e) IMPL_SEQFOR_FILTER_G59_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G59_A_ IMPL_SEQFOR_FILTER_G59_B
+#define IMPL_SEQFOR_FILTER_G59_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G59_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G59_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(60, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G59_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL59(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE59_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP59(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL59(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE59_A_
+#undef IMPL_SEQFOR_FOR_GUIDE59_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE59_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST59_A_
+#undef IMPL_SEQFOR_FAST59_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST59_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL59_A_
+#undef IMPL_SEQFOR_UNTIL59_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL59_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL59_B_1_1
+#undef IMPL_SEQFOR_ZIP59_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP59_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP59_B_1_0
+#undef IMPL_SEQFOR_ZIP59_B_1_1
+#undef IMPL_SEQFOR_SIMPLE59_A_
+#undef IMPL_SEQFOR_SIMPLE59_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE59_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE59_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE59_B
+#define IMPL_SEQFOR_FOR_GUIDE59_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL59
+#define IMPL_SEQFOR_FOR_GUIDE59_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL59
+#define IMPL_SEQFOR_FAST59_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST59_B
+#define IMPL_SEQFOR_FAST59_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL59
+#define IMPL_SEQFOR_FAST59_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL59
+#define IMPL_SEQFOR_UNTIL59_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL59_B
+#define IMPL_SEQFOR_UNTIL59_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL59
+#define IMPL_SEQFOR_UNTIL59_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL59
+#define IMPL_SEQFOR_UNTIL59_B_1_1 IMPL_SEQFOR_TRACE_STOP59
+#define IMPL_SEQFOR_ZIP59_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL59
+#define IMPL_SEQFOR_ZIP59_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL59
+#define IMPL_SEQFOR_ZIP59_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP59_C
+#define IMPL_SEQFOR_ZIP59_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL59(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE59_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE59_B
+#define IMPL_SEQFOR_SIMPLE59_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE59_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 6 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH6(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH6, 7) IMPL_SEQFOR_IDENTITY6( IMPL_SEQFOR_FOR_GUIDE6_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE6(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE6, 7) IMPL_SEQFOR_IDENTITY6( IMPL_SEQFOR_SIMPLE6_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST6(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST6, 7) IMPL_SEQFOR_IDENTITY6( IMPL_SEQFOR_FAST6_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL6(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL6, 7) IMPL_SEQFOR_IDENTITY6( IMPL_SEQFOR_UNTIL6_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP6(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP6, 7) IMPL_SEQFOR_IDENTITY6( IMPL_SEQFOR_ZIP6_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS6(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS6, 7) IMPL_SEQFOR_IDENTITY6( IMPL_SEQFOR_FOR_GUIDE6_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP6(m, seq) IMPL_SEQFOR_IDENTITY6( IMPL_SEQFOR_MAP6_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER6(p, seq) IMPL_SEQFOR_IDENTITY6( IMPL_SEQFOR_FILTER6_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G6(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G6, 7) IMPL_SEQFOR_FOR_GUIDE6_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G6(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G6, 7) IMPL_SEQFOR_SIMPLE6_A(m, g) )
+#define SF_FOR_EACH_FAST_G6(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G6, 7) IMPL_SEQFOR_FAST6_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G6(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G6, 7) IMPL_SEQFOR_UNTIL6_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G6(m, g) IMPL_SEQFOR_MAP_G6_A(m, g) )
+#define SF_SEQ_FILTER_G6(p, g) IMPL_SEQFOR_FILTER_G6_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY6(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE6_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE6_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE6_A_ IMPL_SEQFOR_FOR_GUIDE6_B
+#define IMPL_SEQFOR_FOR_GUIDE6_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE6_END
+#define IMPL_SEQFOR_FOR_GUIDE6_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE6_END
+#define IMPL_SEQFOR_FOR_GUIDE6_END(m, s, f, d, ...) f(7, d)
+#define IMPL_SEQFOR_FOR_GUIDE6_B(m, s, f, d, ...) m(7, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE6_B_0(m, s, f, s(7, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE6_B_0(...) IMPL_SEQFOR_FOR_GUIDE6_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE6_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE6_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST6_A(m, s, f, d, e) IMPL_SEQFOR_FAST6_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST6_A_ IMPL_SEQFOR_FAST6_B
+#define IMPL_SEQFOR_FAST6_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE6_END
+#define IMPL_SEQFOR_FAST6_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE6_END
+#define IMPL_SEQFOR_FAST6_B(m, s, f, d, ...) m(7, d, __VA_ARGS__) IMPL_SEQFOR_FAST6_A(m, s, f, s(7, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL6_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL6_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL6_A_ IMPL_SEQFOR_UNTIL6_B
+#define IMPL_SEQFOR_UNTIL6_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE6_END
+#define IMPL_SEQFOR_UNTIL6_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE6_END
+#define IMPL_SEQFOR_UNTIL6_B(m, s, f, d, ...) m(7, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL6_B_0(m, s, f, s(7, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL6_B_0(...) IMPL_SEQFOR_UNTIL6_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL6_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL6_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL6_B_1_0 IMPL_SEQFOR_UNTIL6_A
+#define IMPL_SEQFOR_UNTIL6_B_1_1 IMPL_SEQFOR_UNTIL6_STOP
+#define IMPL_SEQFOR_UNTIL6_STOP(m, s, f, d, e) f(7, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP6_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP6_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP6_A_ IMPL_SEQFOR_ZIP6_B
+#define IMPL_SEQFOR_ZIP6_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE6_END
+#define IMPL_SEQFOR_ZIP6_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE6_END
+#define IMPL_SEQFOR_ZIP6_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP6_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP6_B_0(...) IMPL_SEQFOR_ZIP6_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP6_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP6_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP6_B_1_0 IMPL_SEQFOR_ZIP6_C
+#define IMPL_SEQFOR_ZIP6_B_1_1(m, s, f, d, ...) f(7, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP6_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP6_C(m, s, f, d, r, ...) m(7, d, __VA_ARGS__) IMPL_SEQFOR_ZIP6_A(m, s, f, s(7, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE6_A(m, e) IMPL_SEQFOR_SIMPLE6_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE6_A_ IMPL_SEQFOR_SIMPLE6_B
+#define IMPL_SEQFOR_SIMPLE6_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE6_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE6_B(m, ...) m(7, __VA_ARGS__) IMPL_SEQFOR_SIMPLE6_A(m,
+#define IMPL_SEQFOR_MAP6_A(m, e) IMPL_SEQFOR_MAP6_A_##e(m,
+#define IMPL_SEQFOR_MAP6_A_ IMPL_SEQFOR_MAP6_B
+#define IMPL_SEQFOR_MAP6_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP6_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP6_B(m, ...) (m(7, __VA_ARGS__)) IMPL_SEQFOR_MAP6_A(m,
+#define IMPL_SEQFOR_FILTER6_A(p, e) IMPL_SEQFOR_FILTER6_A_##e(p,
+#define IMPL_SEQFOR_FILTER6_A_ IMPL_SEQFOR_FILTER6_B
+#define IMPL_SEQFOR_FILTER6_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER6_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER6_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(7, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER6_A(p,
+#define IMPL_SEQFOR_MAP_G6_A(m, e) IMPL_SEQFOR_MAP_G6_A_##e(m,
+#define IMPL_SEQFOR_MAP_G6_A_ IMPL_SEQFOR_MAP_G6_B
+#define IMPL_SEQFOR_MAP_G6_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G6_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G6_B(m, ...) )m(7, __VA_ARGS__)) IMPL_SEQFOR_MAP_G6_A(m,
+#define IMPL_SEQFOR_FILTER_G6_A(p, e) IMPL_SEQFOR_FILTER_G6_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G6_A_ IMPL_SEQFOR_FILTER_G6_B
+#define IMPL_SEQFOR_FILTER_G6_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G6_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G6_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(7, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G6_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL6(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE6_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP6(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL6(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE6_A_
+#undef IMPL_SEQFOR_FOR_GUIDE6_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE6_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST6_A_
+#undef IMPL_SEQFOR_FAST6_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST6_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL6_A_
+#undef IMPL_SEQFOR_UNTIL6_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL6_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL6_B_1_1
+#undef IMPL_SEQFOR_ZIP6_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP6_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP6_B_1_0
+#undef IMPL_SEQFOR_ZIP6_B_1_1
+#undef IMPL_SEQFOR_SIMPLE6_A_
+#undef IMPL_SEQFOR_SIMPLE6_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE6_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE6_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE6_B
+#define IMPL_SEQFOR_FOR_GUIDE6_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL6
+#define IMPL_SEQFOR_FOR_GUIDE6_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL6
+#define IMPL_SEQFOR_FAST6_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST6_B
+#define IMPL_SEQFOR_FAST6_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL6
+#define IMPL_SEQFOR_FAST6_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL6
+#define IMPL_SEQFOR_UNTIL6_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL6_B
+#define IMPL_SEQFOR_UNTIL6_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL6
+#define IMPL_SEQFOR_UNTIL6_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL6
+#define IMPL_SEQFOR_UNTIL6_B_1_1 IMPL_SEQFOR_TRACE_STOP6
+#define IMPL_SEQFOR_ZIP6_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL6
+#define IMPL_SEQFOR_ZIP6_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL6
+#define IMPL_SEQFOR_ZIP6_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP6_C
+#define IMPL_SEQFOR_ZIP6_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL6(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE6_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE6_B
+#define IMPL_SEQFOR_SIMPLE6_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE6_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
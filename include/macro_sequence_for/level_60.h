@@ -0,0 +1,113 @@
+// Nesting level 60 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH60(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH60, 61) IMPL_SEQFOR_IDENTITY60( IMPL_SEQFOR_FOR_GUIDE60_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE60(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE60, 61) IMPL_SEQFOR_IDENTITY60( IMPL_SEQFOR_SIMPLE60_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST60(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST60, 61) IMPL_SEQFOR_IDENTITY60( IMPL_SEQFOR_FAST60_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL60(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL60, 61) IMPL_SEQFOR_IDENTITY60( IMPL_SEQFOR_UNTIL60_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP60(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP60, 61) IMPL_SEQFOR_IDENTITY60( IMPL_SEQFOR_ZIP60_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS60(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS60, 61) IMPL_SEQFOR_IDENTITY60( IMPL_SEQFOR_FOR_GUIDE60_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP60(m, seq) IMPL_SEQFOR_IDENTITY60( IMPL_SEQFOR_MAP60_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER60(p, seq) IMPL_SEQFOR_IDENTITY60( IMPL_SEQFOR_FILTER60_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G60(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G60, 61) IMPL_SEQFOR_FOR_GUIDE60_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G60(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G60, 61) IMPL_SEQFOR_SIMPLE60_A(m, g) )
+#define SF_FOR_EACH_FAST_G60(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G60, 61) IMPL_SEQFOR_FAST60_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G60(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G60, 61) IMPL_SEQFOR_UNTIL60_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G60(m, g) IMPL_SEQFOR_MAP_G60_A(m, g) )
+#define SF_SEQ_FILTER_G60(p, g) IMPL_SEQFOR_FILTER_G60_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY60(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE60_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE60_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE60_A_ IMPL_SEQFOR_FOR_GUIDE60_B
+#define IMPL_SEQFOR_FOR_GUIDE60_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE60_END
+#define IMPL_SEQFOR_FOR_GUIDE60_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE60_END
+#define IMPL_SEQFOR_FOR_GUIDE60_END(m, s, f, d, ...) f(61, d)
+#define IMPL_SEQFOR_FOR_GUIDE60_B(m, s, f, d, ...) m(61, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE60_B_0(m, s, f, s(61, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE60_B_0(...) IMPL_SEQFOR_FOR_GUIDE60_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE60_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE60_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST60_A(m, s, f, d, e) IMPL_SEQFOR_FAST60_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST60_A_ IMPL_SEQFOR_FAST60_B
+#define IMPL_SEQFOR_FAST60_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE60_END
+#define IMPL_SEQFOR_FAST60_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE60_END
+#define IMPL_SEQFOR_FAST60_B(m, s, f, d, ...) m(61, d, __VA_ARGS__) IMPL_SEQFOR_FAST60_A(m, s, f, s(61, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL60_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL60_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL60_A_ IMPL_SEQFOR_UNTIL60_B
+#define IMPL_SEQFOR_UNTIL60_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE60_END
+#define IMPL_SEQFOR_UNTIL60_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE60_END
+#define IMPL_SEQFOR_UNTIL60_B(m, s, f, d, ...) m(61, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL60_B_0(m, s, f, s(61, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL60_B_0(...) IMPL_SEQFOR_UNTIL60_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL60_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL60_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL60_B_1_0 IMPL_SEQFOR_UNTIL60_A
+#define IMPL_SEQFOR_UNTIL60_B_1_1 IMPL_SEQFOR_UNTIL60_STOP
+#define IMPL_SEQFOR_UNTIL60_STOP(m, s, f, d, e) f(61, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP60_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP60_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP60_A_ IMPL_SEQFOR_ZIP60_B
+#define IMPL_SEQFOR_ZIP60_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE60_END
+#define IMPL_SEQFOR_ZIP60_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE60_END
+#define IMPL_SEQFOR_ZIP60_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP60_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP60_B_0(...) IMPL_SEQFOR_ZIP60_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP60_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP60_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP60_B_1_0 IMPL_SEQFOR_ZIP60_C
+#define IMPL_SEQFOR_ZIP60_B_1_1(m, s, f, d, ...) f(61, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP60_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP60_C(m, s, f, d, r, ...) m(61, d, __VA_ARGS__) IMPL_SEQFOR_ZIP60_A(m, s, f, s(61, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE60_A(m, e) IMPL_SEQFOR_SIMPLE60_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE60_A_ IMPL_SEQFOR_SIMPLE60_B
+#define IMPL_SEQFOR_SIMPLE60_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE60_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE60_B(m, ...) m(61, __VA_ARGS__) IMPL_SEQFOR_SIMPLE60_A(m,
+#define IMPL_SEQFOR_MAP60_A(m, e) IMPL_SEQFOR_MAP60_A_##e(m,
+#define IMPL_SEQFOR_MAP60_A_ IMPL_SEQFOR_MAP60_B
+#define IMPL_SEQFOR_MAP60_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP60_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP60_B(m, ...) (m(61, __VA_ARGS__)) IMPL_SEQFOR_MAP60_A(m,
+#define IMPL_SEQFOR_FILTER60_A(p, e) IMPL_SEQFOR_FILTER60_A_##e(p,
+#define IMPL_SEQFOR_FILTER60_A_ IMPL_SEQFOR_FILTER60_B
+#define IMPL_SEQFOR_FILTER60_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER60_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER60_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(61, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER60_A(p,
+#define IMPL_SEQFOR_MAP_G60_A(m, e) IMPL_SEQFOR_MAP_G60_A_##e(m,
+#define IMPL_SEQFOR_MAP_G60_A_ IMPL_SEQFOR_MAP_G60_B
+#define IMPL_SEQFOR_MAP_G60_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G60_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G60_B(m, ...) )m(61, __VA_ARGS__)) IMPL_SEQFOR_MAP_G60_A(m,
+#define IMPL_SEQFOR_FILTER_G60_A(p, e) IMPL_SEQFOR_FILTER_G60_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G60_A_ IMPL_SEQFOR_FILTER_G60_B
+#define IMPL_SEQFOR_FILTER_G60_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G60_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G60_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(61, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G60_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL60(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE60_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP60(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL60(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE60_A_
+#undef IMPL_SEQFOR_FOR_GUIDE60_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE60_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST60_A_
+#undef IMPL_SEQFOR_FAST60_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST60_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL60_A_
+#undef IMPL_SEQFOR_UNTIL60_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL60_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL60_B_1_1
+#undef IMPL_SEQFOR_ZIP60_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP60_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP60_B_1_0
+#undef IMPL_SEQFOR_ZIP60_B_1_1
+#undef IMPL_SEQFOR_SIMPLE60_A_
+#undef IMPL_SEQFOR_SIMPLE60_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE60_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE60_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE60_B
+#define IMPL_SEQFOR_FOR_GUIDE60_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL60
+#define IMPL_SEQFOR_FOR_GUIDE60_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL60
+#define IMPL_SEQFOR_FAST60_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST60_B
+#define IMPL_SEQFOR_FAST60_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL60
+#define IMPL_SEQFOR_FAST60_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL60
+#define IMPL_SEQFOR_UNTIL60_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL60_B
+#define IMPL_SEQFOR_UNTIL60_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL60
+#define IMPL_SEQFOR_UNTIL60_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL60
+#define IMPL_SEQFOR_UNTIL60_B_1_1 IMPL_SEQFOR_TRACE_STOP60
+#define IMPL_SEQFOR_ZIP60_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL60
+#define IMPL_SEQFOR_ZIP60_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL60
+#define IMPL_SEQFOR_ZIP60_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP60_C
+#define IMPL_SEQFOR_ZIP60_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL60(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE60_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE60_B
+#define IMPL_SEQFOR_SIMPLE60_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE60_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
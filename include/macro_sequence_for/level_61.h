@@ -0,0 +1,113 @@
+// Nesting level 61 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH61(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH61, 62) IMPL_SEQFOR_IDENTITY61( IMPL_SEQFOR_FOR_GUIDE61_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE61(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE61, 62) IMPL_SEQFOR_IDENTITY61( IMPL_SEQFOR_SIMPLE61_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST61(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST61, 62) IMPL_SEQFOR_IDENTITY61( IMPL_SEQFOR_FAST61_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL61(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL61, 62) IMPL_SEQFOR_IDENTITY61( IMPL_SEQFOR_UNTIL61_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP61(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP61, 62) IMPL_SEQFOR_IDENTITY61( IMPL_SEQFOR_ZIP61_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS61(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS61, 62) IMPL_SEQFOR_IDENTITY61( IMPL_SEQFOR_FOR_GUIDE61_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP61(m, seq) IMPL_SEQFOR_IDENTITY61( IMPL_SEQFOR_MAP61_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER61(p, seq) IMPL_SEQFOR_IDENTITY61( IMPL_SEQFOR_FILTER61_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G61(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G61, 62) IMPL_SEQFOR_FOR_GUIDE61_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G61(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G61, 62) IMPL_SEQFOR_SIMPLE61_A(m, g) )
+#define SF_FOR_EACH_FAST_G61(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G61, 62) IMPL_SEQFOR_FAST61_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G61(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G61, 62) IMPL_SEQFOR_UNTIL61_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G61(m, g) IMPL_SEQFOR_MAP_G61_A(m, g) )
+#define SF_SEQ_FILTER_G61(p, g) IMPL_SEQFOR_FILTER_G61_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY61(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE61_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE61_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE61_A_ IMPL_SEQFOR_FOR_GUIDE61_B
+#define IMPL_SEQFOR_FOR_GUIDE61_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE61_END
+#define IMPL_SEQFOR_FOR_GUIDE61_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE61_END
+#define IMPL_SEQFOR_FOR_GUIDE61_END(m, s, f, d, ...) f(62, d)
+#define IMPL_SEQFOR_FOR_GUIDE61_B(m, s, f, d, ...) m(62, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE61_B_0(m, s, f, s(62, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE61_B_0(...) IMPL_SEQFOR_FOR_GUIDE61_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE61_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE61_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST61_A(m, s, f, d, e) IMPL_SEQFOR_FAST61_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST61_A_ IMPL_SEQFOR_FAST61_B
+#define IMPL_SEQFOR_FAST61_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE61_END
+#define IMPL_SEQFOR_FAST61_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE61_END
+#define IMPL_SEQFOR_FAST61_B(m, s, f, d, ...) m(62, d, __VA_ARGS__) IMPL_SEQFOR_FAST61_A(m, s, f, s(62, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL61_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL61_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL61_A_ IMPL_SEQFOR_UNTIL61_B
+#define IMPL_SEQFOR_UNTIL61_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE61_END
+#define IMPL_SEQFOR_UNTIL61_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE61_END
+#define IMPL_SEQFOR_UNTIL61_B(m, s, f, d, ...) m(62, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL61_B_0(m, s, f, s(62, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL61_B_0(...) IMPL_SEQFOR_UNTIL61_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL61_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL61_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL61_B_1_0 IMPL_SEQFOR_UNTIL61_A
+#define IMPL_SEQFOR_UNTIL61_B_1_1 IMPL_SEQFOR_UNTIL61_STOP
+#define IMPL_SEQFOR_UNTIL61_STOP(m, s, f, d, e) f(62, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP61_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP61_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP61_A_ IMPL_SEQFOR_ZIP61_B
+#define IMPL_SEQFOR_ZIP61_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE61_END
+#define IMPL_SEQFOR_ZIP61_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE61_END
+#define IMPL_SEQFOR_ZIP61_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP61_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP61_B_0(...) IMPL_SEQFOR_ZIP61_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP61_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP61_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP61_B_1_0 IMPL_SEQFOR_ZIP61_C
+#define IMPL_SEQFOR_ZIP61_B_1_1(m, s, f, d, ...) f(62, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP61_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP61_C(m, s, f, d, r, ...) m(62, d, __VA_ARGS__) IMPL_SEQFOR_ZIP61_A(m, s, f, s(62, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE61_A(m, e) IMPL_SEQFOR_SIMPLE61_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE61_A_ IMPL_SEQFOR_SIMPLE61_B
+#define IMPL_SEQFOR_SIMPLE61_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE61_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE61_B(m, ...) m(62, __VA_ARGS__) IMPL_SEQFOR_SIMPLE61_A(m,
+#define IMPL_SEQFOR_MAP61_A(m, e) IMPL_SEQFOR_MAP61_A_##e(m,
+#define IMPL_SEQFOR_MAP61_A_ IMPL_SEQFOR_MAP61_B
+#define IMPL_SEQFOR_MAP61_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP61_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP61_B(m, ...) (m(62, __VA_ARGS__)) IMPL_SEQFOR_MAP61_A(m,
+#define IMPL_SEQFOR_FILTER61_A(p, e) IMPL_SEQFOR_FILTER61_A_##e(p,
+#define IMPL_SEQFOR_FILTER61_A_ IMPL_SEQFOR_FILTER61_B
+#define IMPL_SEQFOR_FILTER61_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER61_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER61_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(62, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER61_A(p,
+#define IMPL_SEQFOR_MAP_G61_A(m, e) IMPL_SEQFOR_MAP_G61_A_##e(m,
+#define IMPL_SEQFOR_MAP_G61_A_ IMPL_SEQFOR_MAP_G61_B
+#define IMPL_SEQFOR_MAP_G61_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G61_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G61_B(m, ...) )m(62, __VA_ARGS__)) IMPL_SEQFOR_MAP_G61_A(m,
+#define IMPL_SEQFOR_FILTER_G61_A(p, e) IMPL_SEQFOR_FILTER_G61_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G61_A_ IMPL_SEQFOR_FILTER_G61_B
+#define IMPL_SEQFOR_FILTER_G61_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G61_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G61_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(62, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G61_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL61(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE61_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP61(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL61(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE61_A_
+#undef IMPL_SEQFOR_FOR_GUIDE61_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE61_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST61_A_
+#undef IMPL_SEQFOR_FAST61_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST61_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL61_A_
+#undef IMPL_SEQFOR_UNTIL61_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL61_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL61_B_1_1
+#undef IMPL_SEQFOR_ZIP61_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP61_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP61_B_1_0
+#undef IMPL_SEQFOR_ZIP61_B_1_1
+#undef IMPL_SEQFOR_SIMPLE61_A_
+#undef IMPL_SEQFOR_SIMPLE61_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE61_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE61_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE61_B
+#define IMPL_SEQFOR_FOR_GUIDE61_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL61
+#define IMPL_SEQFOR_FOR_GUIDE61_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL61
+#define IMPL_SEQFOR_FAST61_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST61_B
+#define IMPL_SEQFOR_FAST61_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL61
+#define IMPL_SEQFOR_FAST61_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL61
+#define IMPL_SEQFOR_UNTIL61_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL61_B
+#define IMPL_SEQFOR_UNTIL61_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL61
+#define IMPL_SEQFOR_UNTIL61_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL61
+#define IMPL_SEQFOR_UNTIL61_B_1_1 IMPL_SEQFOR_TRACE_STOP61
+#define IMPL_SEQFOR_ZIP61_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL61
+#define IMPL_SEQFOR_ZIP61_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL61
+#define IMPL_SEQFOR_ZIP61_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP61_C
+#define IMPL_SEQFOR_ZIP61_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL61(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE61_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE61_B
+#define IMPL_SEQFOR_SIMPLE61_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE61_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
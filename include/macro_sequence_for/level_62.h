@@ -0,0 +1,113 @@
+// Nesting level 62 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH62(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH62, 63) IMPL_SEQFOR_IDENTITY62( IMPL_SEQFOR_FOR_GUIDE62_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE62(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE62, 63) IMPL_SEQFOR_IDENTITY62( IMPL_SEQFOR_SIMPLE62_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST62(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST62, 63) IMPL_SEQFOR_IDENTITY62( IMPL_SEQFOR_FAST62_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL62(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL62, 63) IMPL_SEQFOR_IDENTITY62( IMPL_SEQFOR_UNTIL62_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP62(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP62, 63) IMPL_SEQFOR_IDENTITY62( IMPL_SEQFOR_ZIP62_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS62(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS62, 63) IMPL_SEQFOR_IDENTITY62( IMPL_SEQFOR_FOR_GUIDE62_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP62(m, seq) IMPL_SEQFOR_IDENTITY62( IMPL_SEQFOR_MAP62_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER62(p, seq) IMPL_SEQFOR_IDENTITY62( IMPL_SEQFOR_FILTER62_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G62(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G62, 63) IMPL_SEQFOR_FOR_GUIDE62_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G62(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G62, 63) IMPL_SEQFOR_SIMPLE62_A(m, g) )
+#define SF_FOR_EACH_FAST_G62(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G62, 63) IMPL_SEQFOR_FAST62_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G62(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G62, 63) IMPL_SEQFOR_UNTIL62_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G62(m, g) IMPL_SEQFOR_MAP_G62_A(m, g) )
+#define SF_SEQ_FILTER_G62(p, g) IMPL_SEQFOR_FILTER_G62_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY62(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE62_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE62_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE62_A_ IMPL_SEQFOR_FOR_GUIDE62_B
+#define IMPL_SEQFOR_FOR_GUIDE62_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE62_END
+#define IMPL_SEQFOR_FOR_GUIDE62_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE62_END
+#define IMPL_SEQFOR_FOR_GUIDE62_END(m, s, f, d, ...) f(63, d)
+#define IMPL_SEQFOR_FOR_GUIDE62_B(m, s, f, d, ...) m(63, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE62_B_0(m, s, f, s(63, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE62_B_0(...) IMPL_SEQFOR_FOR_GUIDE62_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE62_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE62_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST62_A(m, s, f, d, e) IMPL_SEQFOR_FAST62_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST62_A_ IMPL_SEQFOR_FAST62_B
+#define IMPL_SEQFOR_FAST62_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE62_END
+#define IMPL_SEQFOR_FAST62_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE62_END
+#define IMPL_SEQFOR_FAST62_B(m, s, f, d, ...) m(63, d, __VA_ARGS__) IMPL_SEQFOR_FAST62_A(m, s, f, s(63, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL62_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL62_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL62_A_ IMPL_SEQFOR_UNTIL62_B
+#define IMPL_SEQFOR_UNTIL62_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE62_END
+#define IMPL_SEQFOR_UNTIL62_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE62_END
+#define IMPL_SEQFOR_UNTIL62_B(m, s, f, d, ...) m(63, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL62_B_0(m, s, f, s(63, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL62_B_0(...) IMPL_SEQFOR_UNTIL62_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL62_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL62_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL62_B_1_0 IMPL_SEQFOR_UNTIL62_A
+#define IMPL_SEQFOR_UNTIL62_B_1_1 IMPL_SEQFOR_UNTIL62_STOP
+#define IMPL_SEQFOR_UNTIL62_STOP(m, s, f, d, e) f(63, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP62_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP62_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP62_A_ IMPL_SEQFOR_ZIP62_B
+#define IMPL_SEQFOR_ZIP62_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE62_END
+#define IMPL_SEQFOR_ZIP62_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE62_END
+#define IMPL_SEQFOR_ZIP62_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP62_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP62_B_0(...) IMPL_SEQFOR_ZIP62_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP62_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP62_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP62_B_1_0 IMPL_SEQFOR_ZIP62_C
+#define IMPL_SEQFOR_ZIP62_B_1_1(m, s, f, d, ...) f(63, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP62_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP62_C(m, s, f, d, r, ...) m(63, d, __VA_ARGS__) IMPL_SEQFOR_ZIP62_A(m, s, f, s(63, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE62_A(m, e) IMPL_SEQFOR_SIMPLE62_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE62_A_ IMPL_SEQFOR_SIMPLE62_B
+#define IMPL_SEQFOR_SIMPLE62_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE62_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE62_B(m, ...) m(63, __VA_ARGS__) IMPL_SEQFOR_SIMPLE62_A(m,
+#define IMPL_SEQFOR_MAP62_A(m, e) IMPL_SEQFOR_MAP62_A_##e(m,
+#define IMPL_SEQFOR_MAP62_A_ IMPL_SEQFOR_MAP62_B
+#define IMPL_SEQFOR_MAP62_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP62_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP62_B(m, ...) (m(63, __VA_ARGS__)) IMPL_SEQFOR_MAP62_A(m,
+#define IMPL_SEQFOR_FILTER62_A(p, e) IMPL_SEQFOR_FILTER62_A_##e(p,
+#define IMPL_SEQFOR_FILTER62_A_ IMPL_SEQFOR_FILTER62_B
+#define IMPL_SEQFOR_FILTER62_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER62_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER62_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(63, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER62_A(p,
+#define IMPL_SEQFOR_MAP_G62_A(m, e) IMPL_SEQFOR_MAP_G62_A_##e(m,
+#define IMPL_SEQFOR_MAP_G62_A_ IMPL_SEQFOR_MAP_G62_B
+#define IMPL_SEQFOR_MAP_G62_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G62_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G62_B(m, ...) )m(63, __VA_ARGS__)) IMPL_SEQFOR_MAP_G62_A(m,
+#define IMPL_SEQFOR_FILTER_G62_A(p, e) IMPL_SEQFOR_FILTER_G62_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G62_A_ IMPL_SEQFOR_FILTER_G62_B
+#define IMPL_SEQFOR_FILTER_G62_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G62_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G62_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(63, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G62_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL62(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE62_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP62(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL62(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE62_A_
+#undef IMPL_SEQFOR_FOR_GUIDE62_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE62_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST62_A_
+#undef IMPL_SEQFOR_FAST62_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST62_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL62_A_
+#undef IMPL_SEQFOR_UNTIL62_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL62_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL62_B_1_1
+#undef IMPL_SEQFOR_ZIP62_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP62_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP62_B_1_0
+#undef IMPL_SEQFOR_ZIP62_B_1_1
+#undef IMPL_SEQFOR_SIMPLE62_A_
+#undef IMPL_SEQFOR_SIMPLE62_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE62_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE62_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE62_B
+#define IMPL_SEQFOR_FOR_GUIDE62_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL62
+#define IMPL_SEQFOR_FOR_GUIDE62_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL62
+#define IMPL_SEQFOR_FAST62_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST62_B
+#define IMPL_SEQFOR_FAST62_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL62
+#define IMPL_SEQFOR_FAST62_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL62
+#define IMPL_SEQFOR_UNTIL62_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL62_B
+#define IMPL_SEQFOR_UNTIL62_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL62
+#define IMPL_SEQFOR_UNTIL62_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL62
+#define IMPL_SEQFOR_UNTIL62_B_1_1 IMPL_SEQFOR_TRACE_STOP62
+#define IMPL_SEQFOR_ZIP62_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL62
+#define IMPL_SEQFOR_ZIP62_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL62
+#define IMPL_SEQFOR_ZIP62_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP62_C
+#define IMPL_SEQFOR_ZIP62_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL62(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE62_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE62_B
+#define IMPL_SEQFOR_SIMPLE62_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE62_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
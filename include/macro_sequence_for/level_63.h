@@ -0,0 +1,113 @@
+// Nesting level 63 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH63(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH63, 64) IMPL_SEQFOR_IDENTITY63( IMPL_SEQFOR_FOR_GUIDE63_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE63(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE63, 64) IMPL_SEQFOR_IDENTITY63( IMPL_SEQFOR_SIMPLE63_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST63(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST63, 64) IMPL_SEQFOR_IDENTITY63( IMPL_SEQFOR_FAST63_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL63(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL63, 64) IMPL_SEQFOR_IDENTITY63( IMPL_SEQFOR_UNTIL63_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP63(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP63, 64) IMPL_SEQFOR_IDENTITY63( IMPL_SEQFOR_ZIP63_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS63(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS63, 64) IMPL_SEQFOR_IDENTITY63( IMPL_SEQFOR_FOR_GUIDE63_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP63(m, seq) IMPL_SEQFOR_IDENTITY63( IMPL_SEQFOR_MAP63_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER63(p, seq) IMPL_SEQFOR_IDENTITY63( IMPL_SEQFOR_FILTER63_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G63(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G63, 64) IMPL_SEQFOR_FOR_GUIDE63_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G63(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G63, 64) IMPL_SEQFOR_SIMPLE63_A(m, g) )
+#define SF_FOR_EACH_FAST_G63(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G63, 64) IMPL_SEQFOR_FAST63_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G63(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G63, 64) IMPL_SEQFOR_UNTIL63_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G63(m, g) IMPL_SEQFOR_MAP_G63_A(m, g) )
+#define SF_SEQ_FILTER_G63(p, g) IMPL_SEQFOR_FILTER_G63_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY63(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE63_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE63_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE63_A_ IMPL_SEQFOR_FOR_GUIDE63_B
+#define IMPL_SEQFOR_FOR_GUIDE63_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE63_END
+#define IMPL_SEQFOR_FOR_GUIDE63_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE63_END
+#define IMPL_SEQFOR_FOR_GUIDE63_END(m, s, f, d, ...) f(64, d)
+#define IMPL_SEQFOR_FOR_GUIDE63_B(m, s, f, d, ...) m(64, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE63_B_0(m, s, f, s(64, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE63_B_0(...) IMPL_SEQFOR_FOR_GUIDE63_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE63_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE63_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST63_A(m, s, f, d, e) IMPL_SEQFOR_FAST63_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST63_A_ IMPL_SEQFOR_FAST63_B
+#define IMPL_SEQFOR_FAST63_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE63_END
+#define IMPL_SEQFOR_FAST63_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE63_END
+#define IMPL_SEQFOR_FAST63_B(m, s, f, d, ...) m(64, d, __VA_ARGS__) IMPL_SEQFOR_FAST63_A(m, s, f, s(64, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL63_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL63_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL63_A_ IMPL_SEQFOR_UNTIL63_B
+#define IMPL_SEQFOR_UNTIL63_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE63_END
+#define IMPL_SEQFOR_UNTIL63_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE63_END
+#define IMPL_SEQFOR_UNTIL63_B(m, s, f, d, ...) m(64, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL63_B_0(m, s, f, s(64, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL63_B_0(...) IMPL_SEQFOR_UNTIL63_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL63_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL63_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL63_B_1_0 IMPL_SEQFOR_UNTIL63_A
+#define IMPL_SEQFOR_UNTIL63_B_1_1 IMPL_SEQFOR_UNTIL63_STOP
+#define IMPL_SEQFOR_UNTIL63_STOP(m, s, f, d, e) f(64, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP63_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP63_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP63_A_ IMPL_SEQFOR_ZIP63_B
+#define IMPL_SEQFOR_ZIP63_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE63_END
+#define IMPL_SEQFOR_ZIP63_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE63_END
+#define IMPL_SEQFOR_ZIP63_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP63_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP63_B_0(...) IMPL_SEQFOR_ZIP63_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP63_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP63_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP63_B_1_0 IMPL_SEQFOR_ZIP63_C
+#define IMPL_SEQFOR_ZIP63_B_1_1(m, s, f, d, ...) f(64, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP63_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP63_C(m, s, f, d, r, ...) m(64, d, __VA_ARGS__) IMPL_SEQFOR_ZIP63_A(m, s, f, s(64, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE63_A(m, e) IMPL_SEQFOR_SIMPLE63_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE63_A_ IMPL_SEQFOR_SIMPLE63_B
+#define IMPL_SEQFOR_SIMPLE63_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE63_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE63_B(m, ...) m(64, __VA_ARGS__) IMPL_SEQFOR_SIMPLE63_A(m,
+#define IMPL_SEQFOR_MAP63_A(m, e) IMPL_SEQFOR_MAP63_A_##e(m,
+#define IMPL_SEQFOR_MAP63_A_ IMPL_SEQFOR_MAP63_B
+#define IMPL_SEQFOR_MAP63_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP63_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP63_B(m, ...) (m(64, __VA_ARGS__)) IMPL_SEQFOR_MAP63_A(m,
+#define IMPL_SEQFOR_FILTER63_A(p, e) IMPL_SEQFOR_FILTER63_A_##e(p,
+#define IMPL_SEQFOR_FILTER63_A_ IMPL_SEQFOR_FILTER63_B
+#define IMPL_SEQFOR_FILTER63_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER63_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER63_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(64, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER63_A(p,
+#define IMPL_SEQFOR_MAP_G63_A(m, e) IMPL_SEQFOR_MAP_G63_A_##e(m,
+#define IMPL_SEQFOR_MAP_G63_A_ IMPL_SEQFOR_MAP_G63_B
+#define IMPL_SEQFOR_MAP_G63_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G63_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G63_B(m, ...) )m(64, __VA_ARGS__)) IMPL_SEQFOR_MAP_G63_A(m,
+#define IMPL_SEQFOR_FILTER_G63_A(p, e) IMPL_SEQFOR_FILTER_G63_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G63_A_ IMPL_SEQFOR_FILTER_G63_B
+#define IMPL_SEQFOR_FILTER_G63_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G63_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G63_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(64, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G63_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL63(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE63_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP63(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL63(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE63_A_
+#undef IMPL_SEQFOR_FOR_GUIDE63_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE63_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST63_A_
+#undef IMPL_SEQFOR_FAST63_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST63_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL63_A_
+#undef IMPL_SEQFOR_UNTIL63_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL63_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL63_B_1_1
+#undef IMPL_SEQFOR_ZIP63_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP63_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP63_B_1_0
+#undef IMPL_SEQFOR_ZIP63_B_1_1
+#undef IMPL_SEQFOR_SIMPLE63_A_
+#undef IMPL_SEQFOR_SIMPLE63_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE63_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE63_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE63_B
+#define IMPL_SEQFOR_FOR_GUIDE63_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL63
+#define IMPL_SEQFOR_FOR_GUIDE63_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL63
+#define IMPL_SEQFOR_FAST63_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST63_B
+#define IMPL_SEQFOR_FAST63_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL63
+#define IMPL_SEQFOR_FAST63_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL63
+#define IMPL_SEQFOR_UNTIL63_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL63_B
+#define IMPL_SEQFOR_UNTIL63_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL63
+#define IMPL_SEQFOR_UNTIL63_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL63
+#define IMPL_SEQFOR_UNTIL63_B_1_1 IMPL_SEQFOR_TRACE_STOP63
+#define IMPL_SEQFOR_ZIP63_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL63
+#define IMPL_SEQFOR_ZIP63_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL63
+#define IMPL_SEQFOR_ZIP63_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP63_C
+#define IMPL_SEQFOR_ZIP63_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL63(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE63_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE63_B
+#define IMPL_SEQFOR_SIMPLE63_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE63_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 7 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH7(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH7, 8) IMPL_SEQFOR_IDENTITY7( IMPL_SEQFOR_FOR_GUIDE7_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE7(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE7, 8) IMPL_SEQFOR_IDENTITY7( IMPL_SEQFOR_SIMPLE7_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST7(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST7, 8) IMPL_SEQFOR_IDENTITY7( IMPL_SEQFOR_FAST7_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL7(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL7, 8) IMPL_SEQFOR_IDENTITY7( IMPL_SEQFOR_UNTIL7_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP7(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP7, 8) IMPL_SEQFOR_IDENTITY7( IMPL_SEQFOR_ZIP7_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS7(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS7, 8) IMPL_SEQFOR_IDENTITY7( IMPL_SEQFOR_FOR_GUIDE7_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP7(m, seq) IMPL_SEQFOR_IDENTITY7( IMPL_SEQFOR_MAP7_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER7(p, seq) IMPL_SEQFOR_IDENTITY7( IMPL_SEQFOR_FILTER7_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G7(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G7, 8) IMPL_SEQFOR_FOR_GUIDE7_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G7(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G7, 8) IMPL_SEQFOR_SIMPLE7_A(m, g) )
+#define SF_FOR_EACH_FAST_G7(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G7, 8) IMPL_SEQFOR_FAST7_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G7(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G7, 8) IMPL_SEQFOR_UNTIL7_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G7(m, g) IMPL_SEQFOR_MAP_G7_A(m, g) )
+#define SF_SEQ_FILTER_G7(p, g) IMPL_SEQFOR_FILTER_G7_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY7(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE7_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE7_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE7_A_ IMPL_SEQFOR_FOR_GUIDE7_B
+#define IMPL_SEQFOR_FOR_GUIDE7_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE7_END
+#define IMPL_SEQFOR_FOR_GUIDE7_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE7_END
+#define IMPL_SEQFOR_FOR_GUIDE7_END(m, s, f, d, ...) f(8, d)
+#define IMPL_SEQFOR_FOR_GUIDE7_B(m, s, f, d, ...) m(8, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE7_B_0(m, s, f, s(8, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE7_B_0(...) IMPL_SEQFOR_FOR_GUIDE7_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE7_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE7_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST7_A(m, s, f, d, e) IMPL_SEQFOR_FAST7_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST7_A_ IMPL_SEQFOR_FAST7_B
+#define IMPL_SEQFOR_FAST7_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE7_END
+#define IMPL_SEQFOR_FAST7_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE7_END
+#define IMPL_SEQFOR_FAST7_B(m, s, f, d, ...) m(8, d, __VA_ARGS__) IMPL_SEQFOR_FAST7_A(m, s, f, s(8, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL7_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL7_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL7_A_ IMPL_SEQFOR_UNTIL7_B
+#define IMPL_SEQFOR_UNTIL7_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE7_END
+#define IMPL_SEQFOR_UNTIL7_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE7_END
+#define IMPL_SEQFOR_UNTIL7_B(m, s, f, d, ...) m(8, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL7_B_0(m, s, f, s(8, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL7_B_0(...) IMPL_SEQFOR_UNTIL7_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL7_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL7_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL7_B_1_0 IMPL_SEQFOR_UNTIL7_A
+#define IMPL_SEQFOR_UNTIL7_B_1_1 IMPL_SEQFOR_UNTIL7_STOP
+#define IMPL_SEQFOR_UNTIL7_STOP(m, s, f, d, e) f(8, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP7_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP7_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP7_A_ IMPL_SEQFOR_ZIP7_B
+#define IMPL_SEQFOR_ZIP7_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE7_END
+#define IMPL_SEQFOR_ZIP7_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE7_END
+#define IMPL_SEQFOR_ZIP7_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP7_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP7_B_0(...) IMPL_SEQFOR_ZIP7_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP7_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP7_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP7_B_1_0 IMPL_SEQFOR_ZIP7_C
+#define IMPL_SEQFOR_ZIP7_B_1_1(m, s, f, d, ...) f(8, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP7_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP7_C(m, s, f, d, r, ...) m(8, d, __VA_ARGS__) IMPL_SEQFOR_ZIP7_A(m, s, f, s(8, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE7_A(m, e) IMPL_SEQFOR_SIMPLE7_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE7_A_ IMPL_SEQFOR_SIMPLE7_B
+#define IMPL_SEQFOR_SIMPLE7_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE7_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE7_B(m, ...) m(8, __VA_ARGS__) IMPL_SEQFOR_SIMPLE7_A(m,
+#define IMPL_SEQFOR_MAP7_A(m, e) IMPL_SEQFOR_MAP7_A_##e(m,
+#define IMPL_SEQFOR_MAP7_A_ IMPL_SEQFOR_MAP7_B
+#define IMPL_SEQFOR_MAP7_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP7_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP7_B(m, ...) (m(8, __VA_ARGS__)) IMPL_SEQFOR_MAP7_A(m,
+#define IMPL_SEQFOR_FILTER7_A(p, e) IMPL_SEQFOR_FILTER7_A_##e(p,
+#define IMPL_SEQFOR_FILTER7_A_ IMPL_SEQFOR_FILTER7_B
+#define IMPL_SEQFOR_FILTER7_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER7_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER7_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(8, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER7_A(p,
+#define IMPL_SEQFOR_MAP_G7_A(m, e) IMPL_SEQFOR_MAP_G7_A_##e(m,
+#define IMPL_SEQFOR_MAP_G7_A_ IMPL_SEQFOR_MAP_G7_B
+#define IMPL_SEQFOR_MAP_G7_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G7_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G7_B(m, ...) )m(8, __VA_ARGS__)) IMPL_SEQFOR_MAP_G7_A(m,
+#define IMPL_SEQFOR_FILTER_G7_A(p, e) IMPL_SEQFOR_FILTER_G7_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G7_A_ IMPL_SEQFOR_FILTER_G7_B
+#define IMPL_SEQFOR_FILTER_G7_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G7_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G7_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(8, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G7_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL7(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE7_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP7(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL7(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE7_A_
+#undef IMPL_SEQFOR_FOR_GUIDE7_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE7_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST7_A_
+#undef IMPL_SEQFOR_FAST7_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST7_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL7_A_
+#undef IMPL_SEQFOR_UNTIL7_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL7_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL7_B_1_1
+#undef IMPL_SEQFOR_ZIP7_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP7_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP7_B_1_0
+#undef IMPL_SEQFOR_ZIP7_B_1_1
+#undef IMPL_SEQFOR_SIMPLE7_A_
+#undef IMPL_SEQFOR_SIMPLE7_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE7_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE7_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE7_B
+#define IMPL_SEQFOR_FOR_GUIDE7_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL7
+#define IMPL_SEQFOR_FOR_GUIDE7_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL7
+#define IMPL_SEQFOR_FAST7_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST7_B
+#define IMPL_SEQFOR_FAST7_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL7
+#define IMPL_SEQFOR_FAST7_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL7
+#define IMPL_SEQFOR_UNTIL7_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL7_B
+#define IMPL_SEQFOR_UNTIL7_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL7
+#define IMPL_SEQFOR_UNTIL7_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL7
+#define IMPL_SEQFOR_UNTIL7_B_1_1 IMPL_SEQFOR_TRACE_STOP7
+#define IMPL_SEQFOR_ZIP7_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL7
+#define IMPL_SEQFOR_ZIP7_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL7
+#define IMPL_SEQFOR_ZIP7_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP7_C
+#define IMPL_SEQFOR_ZIP7_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL7(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE7_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE7_B
+#define IMPL_SEQFOR_SIMPLE7_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE7_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
@@ -0,0 +1,113 @@
+// Nesting level 8 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH8(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH8, 9) IMPL_SEQFOR_IDENTITY8( IMPL_SEQFOR_FOR_GUIDE8_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE8(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE8, 9) IMPL_SEQFOR_IDENTITY8( IMPL_SEQFOR_SIMPLE8_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST8(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST8, 9) IMPL_SEQFOR_IDENTITY8( IMPL_SEQFOR_FAST8_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL8(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL8, 9) IMPL_SEQFOR_IDENTITY8( IMPL_SEQFOR_UNTIL8_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP8(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP8, 9) IMPL_SEQFOR_IDENTITY8( IMPL_SEQFOR_ZIP8_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS8(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS8, 9) IMPL_SEQFOR_IDENTITY8( IMPL_SEQFOR_FOR_GUIDE8_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP8(m, seq) IMPL_SEQFOR_IDENTITY8( IMPL_SEQFOR_MAP8_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER8(p, seq) IMPL_SEQFOR_IDENTITY8( IMPL_SEQFOR_FILTER8_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G8(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G8, 9) IMPL_SEQFOR_FOR_GUIDE8_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G8(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G8, 9) IMPL_SEQFOR_SIMPLE8_A(m, g) )
+#define SF_FOR_EACH_FAST_G8(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G8, 9) IMPL_SEQFOR_FAST8_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G8(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G8, 9) IMPL_SEQFOR_UNTIL8_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G8(m, g) IMPL_SEQFOR_MAP_G8_A(m, g) )
+#define SF_SEQ_FILTER_G8(p, g) IMPL_SEQFOR_FILTER_G8_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY8(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE8_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE8_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE8_A_ IMPL_SEQFOR_FOR_GUIDE8_B
+#define IMPL_SEQFOR_FOR_GUIDE8_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE8_END
+#define IMPL_SEQFOR_FOR_GUIDE8_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE8_END
+#define IMPL_SEQFOR_FOR_GUIDE8_END(m, s, f, d, ...) f(9, d)
+#define IMPL_SEQFOR_FOR_GUIDE8_B(m, s, f, d, ...) m(9, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE8_B_0(m, s, f, s(9, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE8_B_0(...) IMPL_SEQFOR_FOR_GUIDE8_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE8_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE8_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST8_A(m, s, f, d, e) IMPL_SEQFOR_FAST8_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST8_A_ IMPL_SEQFOR_FAST8_B
+#define IMPL_SEQFOR_FAST8_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE8_END
+#define IMPL_SEQFOR_FAST8_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE8_END
+#define IMPL_SEQFOR_FAST8_B(m, s, f, d, ...) m(9, d, __VA_ARGS__) IMPL_SEQFOR_FAST8_A(m, s, f, s(9, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL8_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL8_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL8_A_ IMPL_SEQFOR_UNTIL8_B
+#define IMPL_SEQFOR_UNTIL8_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE8_END
+#define IMPL_SEQFOR_UNTIL8_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE8_END
+#define IMPL_SEQFOR_UNTIL8_B(m, s, f, d, ...) m(9, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL8_B_0(m, s, f, s(9, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL8_B_0(...) IMPL_SEQFOR_UNTIL8_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL8_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL8_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL8_B_1_0 IMPL_SEQFOR_UNTIL8_A
+#define IMPL_SEQFOR_UNTIL8_B_1_1 IMPL_SEQFOR_UNTIL8_STOP
+#define IMPL_SEQFOR_UNTIL8_STOP(m, s, f, d, e) f(9, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP8_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP8_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP8_A_ IMPL_SEQFOR_ZIP8_B
+#define IMPL_SEQFOR_ZIP8_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE8_END
+#define IMPL_SEQFOR_ZIP8_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE8_END
+#define IMPL_SEQFOR_ZIP8_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP8_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP8_B_0(...) IMPL_SEQFOR_ZIP8_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP8_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP8_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP8_B_1_0 IMPL_SEQFOR_ZIP8_C
+#define IMPL_SEQFOR_ZIP8_B_1_1(m, s, f, d, ...) f(9, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP8_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP8_C(m, s, f, d, r, ...) m(9, d, __VA_ARGS__) IMPL_SEQFOR_ZIP8_A(m, s, f, s(9, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE8_A(m, e) IMPL_SEQFOR_SIMPLE8_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE8_A_ IMPL_SEQFOR_SIMPLE8_B
+#define IMPL_SEQFOR_SIMPLE8_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE8_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE8_B(m, ...) m(9, __VA_ARGS__) IMPL_SEQFOR_SIMPLE8_A(m,
+#define IMPL_SEQFOR_MAP8_A(m, e) IMPL_SEQFOR_MAP8_A_##e(m,
+#define IMPL_SEQFOR_MAP8_A_ IMPL_SEQFOR_MAP8_B
+#define IMPL_SEQFOR_MAP8_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP8_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP8_B(m, ...) (m(9, __VA_ARGS__)) IMPL_SEQFOR_MAP8_A(m,
+#define IMPL_SEQFOR_FILTER8_A(p, e) IMPL_SEQFOR_FILTER8_A_##e(p,
+#define IMPL_SEQFOR_FILTER8_A_ IMPL_SEQFOR_FILTER8_B
+#define IMPL_SEQFOR_FILTER8_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER8_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER8_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(9, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER8_A(p,
+#define IMPL_SEQFOR_MAP_G8_A(m, e) IMPL_SEQFOR_MAP_G8_A_##e(m,
+#define IMPL_SEQFOR_MAP_G8_A_ IMPL_SEQFOR_MAP_G8_B
+#define IMPL_SEQFOR_MAP_G8_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G8_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G8_B(m, ...) )m(9, __VA_ARGS__)) IMPL_SEQFOR_MAP_G8_A(m,
+#define IMPL_SEQFOR_FILTER_G8_A(p, e) IMPL_SEQFOR_FILTER_G8_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G8_A_ IMPL_SEQFOR_FILTER_G8_B
+#define IMPL_SEQFOR_FILTER_G8_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G8_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G8_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(9, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G8_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL8(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE8_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP8(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL8(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE8_A_
+#undef IMPL_SEQFOR_FOR_GUIDE8_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE8_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST8_A_
+#undef IMPL_SEQFOR_FAST8_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST8_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL8_A_
+#undef IMPL_SEQFOR_UNTIL8_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL8_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL8_B_1_1
+#undef IMPL_SEQFOR_ZIP8_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP8_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP8_B_1_0
+#undef IMPL_SEQFOR_ZIP8_B_1_1
+#undef IMPL_SEQFOR_SIMPLE8_A_
+#undef IMPL_SEQFOR_SIMPLE8_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE8_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE8_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE8_B
+#define IMPL_SEQFOR_FOR_GUIDE8_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL8
+#define IMPL_SEQFOR_FOR_GUIDE8_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL8
+#define IMPL_SEQFOR_FAST8_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST8_B
+#define IMPL_SEQFOR_FAST8_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL8
+#define IMPL_SEQFOR_FAST8_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL8
+#define IMPL_SEQFOR_UNTIL8_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL8_B
+#define IMPL_SEQFOR_UNTIL8_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL8
+#define IMPL_SEQFOR_UNTIL8_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL8
+#define IMPL_SEQFOR_UNTIL8_B_1_1 IMPL_SEQFOR_TRACE_STOP8
+#define IMPL_SEQFOR_ZIP8_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL8
+#define IMPL_SEQFOR_ZIP8_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL8
+#define IMPL_SEQFOR_ZIP8_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP8_C
+#define IMPL_SEQFOR_ZIP8_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL8(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE8_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE8_B
+#define IMPL_SEQFOR_SIMPLE8_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE8_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
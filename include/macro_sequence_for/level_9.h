@@ -0,0 +1,113 @@
+// Nesting level 9 for "macro_sequence_for.h", generated by `generate.sh`. Don't include directly.
+#define SF_FOR_EACH9(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH9, 10) IMPL_SEQFOR_IDENTITY9( IMPL_SEQFOR_FOR_GUIDE9_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_SIMPLE9(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE9, 10) IMPL_SEQFOR_IDENTITY9( IMPL_SEQFOR_SIMPLE9_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_FAST9(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST9, 10) IMPL_SEQFOR_IDENTITY9( IMPL_SEQFOR_FAST9_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_UNTIL9(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL9, 10) IMPL_SEQFOR_IDENTITY9( IMPL_SEQFOR_UNTIL9_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ZIP9(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIP9, 10) IMPL_SEQFOR_IDENTITY9( IMPL_SEQFOR_ZIP9_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_ARGS9(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGS9, 10) IMPL_SEQFOR_IDENTITY9( IMPL_SEQFOR_FOR_GUIDE9_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
+#define SF_SEQ_MAP9(m, seq) IMPL_SEQFOR_IDENTITY9( IMPL_SEQFOR_MAP9_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTER9(p, seq) IMPL_SEQFOR_IDENTITY9( IMPL_SEQFOR_FILTER9_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_FOR_EACH_G9(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_G9, 10) IMPL_SEQFOR_FOR_GUIDE9_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_G9(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_G9, 10) IMPL_SEQFOR_SIMPLE9_A(m, g) )
+#define SF_FOR_EACH_FAST_G9(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_G9, 10) IMPL_SEQFOR_FAST9_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_G9(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_G9, 10) IMPL_SEQFOR_UNTIL9_A(m, s, f, d, g) )
+#define SF_SEQ_MAP_G9(m, g) IMPL_SEQFOR_MAP_G9_A(m, g) )
+#define SF_SEQ_FILTER_G9(p, g) IMPL_SEQFOR_FILTER_G9_A(p, g) )
+#define IMPL_SEQFOR_IDENTITY9(...) __VA_ARGS__
+#define IMPL_SEQFOR_FOR_GUIDE9_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDE9_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDE9_A_ IMPL_SEQFOR_FOR_GUIDE9_B
+#define IMPL_SEQFOR_FOR_GUIDE9_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE9_END
+#define IMPL_SEQFOR_FOR_GUIDE9_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE9_END
+#define IMPL_SEQFOR_FOR_GUIDE9_END(m, s, f, d, ...) f(10, d)
+#define IMPL_SEQFOR_FOR_GUIDE9_B(m, s, f, d, ...) m(10, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDE9_B_0(m, s, f, s(10, d, __VA_ARGS__))
+#define IMPL_SEQFOR_FOR_GUIDE9_B_0(...) IMPL_SEQFOR_FOR_GUIDE9_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_FOR_GUIDE9_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDE9_A(m, s, f, d,
+#define IMPL_SEQFOR_FAST9_A(m, s, f, d, e) IMPL_SEQFOR_FAST9_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FAST9_A_ IMPL_SEQFOR_FAST9_B
+#define IMPL_SEQFOR_FAST9_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE9_END
+#define IMPL_SEQFOR_FAST9_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE9_END
+#define IMPL_SEQFOR_FAST9_B(m, s, f, d, ...) m(10, d, __VA_ARGS__) IMPL_SEQFOR_FAST9_A(m, s, f, s(10, d, __VA_ARGS__),
+#define IMPL_SEQFOR_UNTIL9_A(m, s, f, d, e) IMPL_SEQFOR_UNTIL9_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL9_A_ IMPL_SEQFOR_UNTIL9_B
+#define IMPL_SEQFOR_UNTIL9_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE9_END
+#define IMPL_SEQFOR_UNTIL9_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE9_END
+#define IMPL_SEQFOR_UNTIL9_B(m, s, f, d, ...) m(10, d, __VA_ARGS__) IMPL_SEQFOR_UNTIL9_B_0(m, s, f, s(10, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTIL9_B_0(...) IMPL_SEQFOR_UNTIL9_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTIL9_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTIL9_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTIL9_B_1_0 IMPL_SEQFOR_UNTIL9_A
+#define IMPL_SEQFOR_UNTIL9_B_1_1 IMPL_SEQFOR_UNTIL9_STOP
+#define IMPL_SEQFOR_UNTIL9_STOP(m, s, f, d, e) f(10, d) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_ZIP9_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIP9_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIP9_A_ IMPL_SEQFOR_ZIP9_B
+#define IMPL_SEQFOR_ZIP9_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDE9_END
+#define IMPL_SEQFOR_ZIP9_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDE9_END
+#define IMPL_SEQFOR_ZIP9_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIP9_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIP9_B_0(...) IMPL_SEQFOR_ZIP9_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP9_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP9_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP9_B_1_0 IMPL_SEQFOR_ZIP9_C
+#define IMPL_SEQFOR_ZIP9_B_1_1(m, s, f, d, ...) f(10, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP9_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIP9_C(m, s, f, d, r, ...) m(10, d, __VA_ARGS__) IMPL_SEQFOR_ZIP9_A(m, s, f, s(10, d, __VA_ARGS__), r,
+#define IMPL_SEQFOR_SIMPLE9_A(m, e) IMPL_SEQFOR_SIMPLE9_A_##e(m,
+#define IMPL_SEQFOR_SIMPLE9_A_ IMPL_SEQFOR_SIMPLE9_B
+#define IMPL_SEQFOR_SIMPLE9_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE9_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLE9_B(m, ...) m(10, __VA_ARGS__) IMPL_SEQFOR_SIMPLE9_A(m,
+#define IMPL_SEQFOR_MAP9_A(m, e) IMPL_SEQFOR_MAP9_A_##e(m,
+#define IMPL_SEQFOR_MAP9_A_ IMPL_SEQFOR_MAP9_B
+#define IMPL_SEQFOR_MAP9_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP9_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAP9_B(m, ...) (m(10, __VA_ARGS__)) IMPL_SEQFOR_MAP9_A(m,
+#define IMPL_SEQFOR_FILTER9_A(p, e) IMPL_SEQFOR_FILTER9_A_##e(p,
+#define IMPL_SEQFOR_FILTER9_A_ IMPL_SEQFOR_FILTER9_B
+#define IMPL_SEQFOR_FILTER9_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER9_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTER9_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(10, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER9_A(p,
+#define IMPL_SEQFOR_MAP_G9_A(m, e) IMPL_SEQFOR_MAP_G9_A_##e(m,
+#define IMPL_SEQFOR_MAP_G9_A_ IMPL_SEQFOR_MAP_G9_B
+#define IMPL_SEQFOR_MAP_G9_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G9_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_G9_B(m, ...) )m(10, __VA_ARGS__)) IMPL_SEQFOR_MAP_G9_A(m,
+#define IMPL_SEQFOR_FILTER_G9_A(p, e) IMPL_SEQFOR_FILTER_G9_A_##e(p,
+#define IMPL_SEQFOR_FILTER_G9_A_ IMPL_SEQFOR_FILTER_G9_B
+#define IMPL_SEQFOR_FILTER_G9_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G9_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_G9_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(10, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_G9_A(p,
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_FINAL9(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDE9_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOP9(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINAL9(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDE9_A_
+#undef IMPL_SEQFOR_FOR_GUIDE9_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDE9_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FAST9_A_
+#undef IMPL_SEQFOR_FAST9_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FAST9_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL9_A_
+#undef IMPL_SEQFOR_UNTIL9_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTIL9_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTIL9_B_1_1
+#undef IMPL_SEQFOR_ZIP9_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIP9_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIP9_B_1_0
+#undef IMPL_SEQFOR_ZIP9_B_1_1
+#undef IMPL_SEQFOR_SIMPLE9_A_
+#undef IMPL_SEQFOR_SIMPLE9_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLE9_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDE9_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDE9_B
+#define IMPL_SEQFOR_FOR_GUIDE9_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL9
+#define IMPL_SEQFOR_FOR_GUIDE9_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL9
+#define IMPL_SEQFOR_FAST9_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FAST9_B
+#define IMPL_SEQFOR_FAST9_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL9
+#define IMPL_SEQFOR_FAST9_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL9
+#define IMPL_SEQFOR_UNTIL9_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTIL9_B
+#define IMPL_SEQFOR_UNTIL9_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL9
+#define IMPL_SEQFOR_UNTIL9_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL9
+#define IMPL_SEQFOR_UNTIL9_B_1_1 IMPL_SEQFOR_TRACE_STOP9
+#define IMPL_SEQFOR_ZIP9_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINAL9
+#define IMPL_SEQFOR_ZIP9_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINAL9
+#define IMPL_SEQFOR_ZIP9_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIP9_C
+#define IMPL_SEQFOR_ZIP9_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINAL9(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLE9_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLE9_B
+#define IMPL_SEQFOR_SIMPLE9_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLE9_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#endif // SF_TRACE
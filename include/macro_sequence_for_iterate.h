@@ -0,0 +1,237 @@
+// File iteration for "macro_sequence_for.h", see `SF_ITERATE` there for the usage. Don't include directly, use `#include SF_ITERATE`.
+// This file includes itself recursively: once per digit position of the chunk index (from the most significant one), then once per chunk.
+// The digits are `IMPL_SEQFOR_ITER_C{0..3}`, and `IMPL_SEQFOR_ITER_AT{0..3}` are defined while we're iterating over a position.
+// A recursion depth proportional to the number of chunks would hit the include depth limits of the compilers, hence the digits.
+// Only the chunks check that they are in range, since that walks the sequence. The first one that isn't sets `IMPL_SEQFOR_ITER_DONE`,
+//   which makes every following inclusion a no-op.
+
+#ifndef IMPL_SEQFOR_ITER_ACTIVE
+// The entry point, included by the user.
+
+#ifndef MACRO_SEQUENCE_FOR_H_
+#error Include "macro_sequence_for.h" before using `SF_ITERATE`.
+#endif
+#if !defined(SF_ITERATE_SEQ) || !defined(SF_ITERATE_M)
+#error `SF_ITERATE_SEQ` and `SF_ITERATE_M` must be defined before including `SF_ITERATE`.
+#endif
+
+#ifndef SF_ITERATE_S
+#define SF_ITERATE_S SF_STATE
+#endif
+#ifndef SF_ITERATE_F
+#define SF_ITERATE_F SF_NULL
+#endif
+#ifndef SF_ITERATE_D
+#define SF_ITERATE_D
+#endif
+#ifndef SF_ITERATE_CHUNK
+#define SF_ITERATE_CHUNK 1000
+#endif
+
+// The index of the first element of the chunk (`_FIRST`) and the chunk size (`_COUNT`), as `c, u` meaning `c*10+u`, see `IMPL_SEQFOR_ITER_LOOP`.
+#if SF_ITERATE_CHUNK == 1
+#define IMPL_SEQFOR_ITER_FIRST (IMPL_SEQFOR_ITER_C1, IMPL_SEQFOR_ITER_C2, IMPL_SEQFOR_ITER_C3), IMPL_SEQFOR_ITER_C0
+#define IMPL_SEQFOR_ITER_COUNT (0), 1
+#elif SF_ITERATE_CHUNK == 10
+#define IMPL_SEQFOR_ITER_FIRST (IMPL_SEQFOR_ITER_C0, IMPL_SEQFOR_ITER_C1, IMPL_SEQFOR_ITER_C2, IMPL_SEQFOR_ITER_C3), 0
+#define IMPL_SEQFOR_ITER_COUNT (1), 0
+#elif SF_ITERATE_CHUNK == 100
+#define IMPL_SEQFOR_ITER_FIRST (0, IMPL_SEQFOR_ITER_C0, IMPL_SEQFOR_ITER_C1, IMPL_SEQFOR_ITER_C2, IMPL_SEQFOR_ITER_C3), 0
+#define IMPL_SEQFOR_ITER_COUNT (0, 1), 0
+#elif SF_ITERATE_CHUNK == 1000
+#define IMPL_SEQFOR_ITER_FIRST (0, 0, IMPL_SEQFOR_ITER_C0, IMPL_SEQFOR_ITER_C1, IMPL_SEQFOR_ITER_C2, IMPL_SEQFOR_ITER_C3), 0
+#define IMPL_SEQFOR_ITER_COUNT (0, 0, 1), 0
+#elif SF_ITERATE_CHUNK == 10000
+#define IMPL_SEQFOR_ITER_FIRST (0, 0, 0, IMPL_SEQFOR_ITER_C0, IMPL_SEQFOR_ITER_C1, IMPL_SEQFOR_ITER_C2, IMPL_SEQFOR_ITER_C3), 0
+#define IMPL_SEQFOR_ITER_COUNT (0, 0, 0, 1), 0
+#else
+#error `SF_ITERATE_CHUNK` must be one of: 1, 10, 100, 1000, 10000.
+#endif
+
+#define IMPL_SEQFOR_ITER_ACTIVE
+#define IMPL_SEQFOR_ITER_C0 0
+#define IMPL_SEQFOR_ITER_C1 0
+#define IMPL_SEQFOR_ITER_C2 0
+#define IMPL_SEQFOR_ITER_C3 0
+#include SF_ITERATE
+
+// If all chunks were used, make sure there are no elements left. Otherwise they would be silently dropped, along with the call of `f`.
+// A separate `#if`, since the whole condition is expanded even if `&&` short-circuits, and we only want to walk the sequence when needed.
+#ifndef IMPL_SEQFOR_ITER_DONE
+#if SF_SEQ_SIZE(SF_ITERATE_SEQ) > 10000 * (SF_ITERATE_CHUNK)
+#error The sequence is too long for `SF_ITERATE`, it can have at most 10000 chunks. Increase `SF_ITERATE_CHUNK`.
+#endif
+#endif
+
+#undef IMPL_SEQFOR_ITER_ACTIVE
+#undef IMPL_SEQFOR_ITER_DONE
+#undef IMPL_SEQFOR_ITER_FIRST
+#undef IMPL_SEQFOR_ITER_COUNT
+#undef IMPL_SEQFOR_ITER_C0
+#undef IMPL_SEQFOR_ITER_C1
+#undef IMPL_SEQFOR_ITER_C2
+#undef IMPL_SEQFOR_ITER_C3
+#undef SF_ITERATE_SEQ
+#undef SF_ITERATE_M
+#undef SF_ITERATE_S
+#undef SF_ITERATE_F
+#undef SF_ITERATE_D
+#undef SF_ITERATE_CHUNK
+
+#elif defined(IMPL_SEQFOR_ITER_DONE)
+// Past the end of the sequence, nothing to do.
+
+
+#elif !defined(IMPL_SEQFOR_ITER_AT3)
+// Iterate over the digit 3.
+#define IMPL_SEQFOR_ITER_AT3
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C3
+#define IMPL_SEQFOR_ITER_C3 1
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C3
+#define IMPL_SEQFOR_ITER_C3 2
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C3
+#define IMPL_SEQFOR_ITER_C3 3
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C3
+#define IMPL_SEQFOR_ITER_C3 4
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C3
+#define IMPL_SEQFOR_ITER_C3 5
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C3
+#define IMPL_SEQFOR_ITER_C3 6
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C3
+#define IMPL_SEQFOR_ITER_C3 7
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C3
+#define IMPL_SEQFOR_ITER_C3 8
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C3
+#define IMPL_SEQFOR_ITER_C3 9
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C3
+#define IMPL_SEQFOR_ITER_C3 0
+#undef IMPL_SEQFOR_ITER_AT3
+
+#elif !defined(IMPL_SEQFOR_ITER_AT2)
+// Iterate over the digit 2.
+#define IMPL_SEQFOR_ITER_AT2
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C2
+#define IMPL_SEQFOR_ITER_C2 1
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C2
+#define IMPL_SEQFOR_ITER_C2 2
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C2
+#define IMPL_SEQFOR_ITER_C2 3
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C2
+#define IMPL_SEQFOR_ITER_C2 4
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C2
+#define IMPL_SEQFOR_ITER_C2 5
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C2
+#define IMPL_SEQFOR_ITER_C2 6
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C2
+#define IMPL_SEQFOR_ITER_C2 7
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C2
+#define IMPL_SEQFOR_ITER_C2 8
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C2
+#define IMPL_SEQFOR_ITER_C2 9
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C2
+#define IMPL_SEQFOR_ITER_C2 0
+#undef IMPL_SEQFOR_ITER_AT2
+
+#elif !defined(IMPL_SEQFOR_ITER_AT1)
+// Iterate over the digit 1.
+#define IMPL_SEQFOR_ITER_AT1
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C1
+#define IMPL_SEQFOR_ITER_C1 1
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C1
+#define IMPL_SEQFOR_ITER_C1 2
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C1
+#define IMPL_SEQFOR_ITER_C1 3
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C1
+#define IMPL_SEQFOR_ITER_C1 4
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C1
+#define IMPL_SEQFOR_ITER_C1 5
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C1
+#define IMPL_SEQFOR_ITER_C1 6
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C1
+#define IMPL_SEQFOR_ITER_C1 7
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C1
+#define IMPL_SEQFOR_ITER_C1 8
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C1
+#define IMPL_SEQFOR_ITER_C1 9
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C1
+#define IMPL_SEQFOR_ITER_C1 0
+#undef IMPL_SEQFOR_ITER_AT1
+
+#elif !defined(IMPL_SEQFOR_ITER_AT0)
+// Iterate over the digit 0, running the chunks.
+#define IMPL_SEQFOR_ITER_AT0
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C0
+#define IMPL_SEQFOR_ITER_C0 1
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C0
+#define IMPL_SEQFOR_ITER_C0 2
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C0
+#define IMPL_SEQFOR_ITER_C0 3
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C0
+#define IMPL_SEQFOR_ITER_C0 4
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C0
+#define IMPL_SEQFOR_ITER_C0 5
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C0
+#define IMPL_SEQFOR_ITER_C0 6
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C0
+#define IMPL_SEQFOR_ITER_C0 7
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C0
+#define IMPL_SEQFOR_ITER_C0 8
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C0
+#define IMPL_SEQFOR_ITER_C0 9
+#include SF_ITERATE
+#undef IMPL_SEQFOR_ITER_C0
+#define IMPL_SEQFOR_ITER_C0 0
+#undef IMPL_SEQFOR_ITER_AT0
+
+#elif IMPL_SEQFOR_ITER_START == 0
+// The first chunk always runs, to call `f` for empty sequences. This also saves us from computing the size for it.
+IMPL_SEQFOR_ITER_LOOP
+
+#elif IMPL_SEQFOR_ITER_IN_RANGE
+// A chunk in range. The check stops at the chunk start, rather than computing the full size.
+IMPL_SEQFOR_ITER_LOOP
+
+#else
+// Just went past the end.
+#define IMPL_SEQFOR_ITER_DONE
+
+#endif
@@ -2,7 +2,13 @@
 //?? This file is used as a source for generating the final header.
 //?? While this file is self-sufficient, it doesn't have any boilerplate macros, preventing you from being able to nest loops.
 //?? Any macros having `xx` in their names are duplicated for each nesting level, with `xx` being replaced with ``,`0`,`1`, etc.
+//?? The levels other than `` are written to separate files, which the header includes depending on `SF_MAX_DEPTH`.
 //?? `yy` is replaced with the next nesting level.
+//?? Similarly, macros having `zz` in their names are duplicated for each digit position of the counters (see `SF_STATE_INC`),
+//??   with `zz` being replaced with ``,`0`,`1`, etc, and `ww` being replaced with the next position.
+//?? Likewise, macros having `qq` in their names are duplicated for each extra sequence in `SF_FOR_EACH_ZIP`, with `vv` being the next one,
+//??   and macros having `kk` in their names are duplicated for each step of `SF_FOR_EACH_ARGS`, with `jj` being the next step.
+//?? The per-level copies also include `#undef`s of `xx` macros, and the `#ifdef SF_TRACE`/`#endif // SF_TRACE` lines around them.
 //?? Lastly, any lines beginning with `//??` are removed.
 //?? ----
 #ifndef MACRO_SEQUENCE_FOR_H_ // Intentionally not a `#pragma once`, to be able to tolerate multiple copies of the file.
@@ -45,21 +51,136 @@
 // Use `SF_FOR_EACHi(...)` for nested loops, where `i` can either be hardcoded,
 //   or come from the `n` argument of the outer loop, in which case you
 //   can use `SF_CAT(SF_FOR_EACH, n)(...)`.
-#define SF_FOR_EACHxx(m, s, f, d, seq) IMPL_SEQFOR_FORxx(m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_ANNOTATE_SEQ_END(IMPL_SEQFOR_ANNOTATE_SEQ_A seq)) )
+#define SF_FOR_EACHxx(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACHxx, yy) IMPL_SEQFOR_IDENTITYxx( IMPL_SEQFOR_FOR_GUIDExx_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+
+// A stateless loop over a sequence of the form `(a)(b)(c)`. The elements can contain commas.
+// `m` is the loop body, invoked as `m(n, ...)`, where `...` is one of the elements, and `n` is the same as in `SF_FOR_EACH`.
+// Same as `SF_FOR_EACH(m', SF_NULL, SF_NULL,, seq)` (where `m'` ignores the state), but faster, since there's no state to carry around.
+// Use `SF_FOR_EACH_SIMPLEi(...)` for nested loops, same as with `SF_FOR_EACHi`.
+#define SF_FOR_EACH_SIMPLExx(m, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLExx, yy) IMPL_SEQFOR_IDENTITYxx( IMPL_SEQFOR_SIMPLExx_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+
+// Same as `SF_FOR_EACH`, but `s` can't emit text (it must return only the new state, with no commas at the top level).
+// This lets the loop skip re-splitting the result of `s`, which saves two macro expansions per iteration, each receiving the whole state.
+#define SF_FOR_EACH_FASTxx(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FASTxx, yy) IMPL_SEQFOR_IDENTITYxx( IMPL_SEQFOR_FASTxx_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+
+// A loop that can stop early. Same as `SF_FOR_EACH`, except that `s` must return `b, d` (optionally followed by `, ...` to emit text, as usual),
+//   where `b` is `0` to continue the loop, or `1` to stop it. When stopped, `f(n, d)` is called as usual,
+//   and the remaining elements are skipped without calling `m` and `s` on them.
+#define SF_FOR_EACH_UNTILxx(m, s, f, d, seq) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTILxx, yy) IMPL_SEQFOR_IDENTITYxx( IMPL_SEQFOR_UNTILxx_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+
+// A loop over two or more sequences in lockstep. Same as `SF_FOR_EACH_FAST` (`s` can't emit text), except that `m` and `s` receive one element from each sequence,
+//   e.g. `m(n, d, a, x)` for `seq = (a)(b)` and `seq2 = (x)(y)`. Elements with commas are passed as is, so they look like several elements.
+// If the lengths differ, the loop stops at the end of the shortest sequence, and `f(n, d)` is called as usual.
+// Only `seq` is consumed as a guide. The other sequences are carried as a part of the loop state, which makes it `O(n^2)`
+//   in the total length of those, but still linear in the number of macro expansions. In practice, it's slow past a thousand elements.
+// The max number of sequences is `SF_MAX_ZIP`. More sequences make the loop expand to an undeclared name.
+#define SF_FOR_EACH_ZIPxx(m, s, f, d, seq, seq2, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ZIPxx, yy) IMPL_SEQFOR_IDENTITYxx( IMPL_SEQFOR_ZIPxx_A IMPL_SEQFOR_LPAREN m, s, f, d, (seq2 __VA_OPT__(,) __VA_ARGS__), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+
+// A loop over a comma-separated list, e.g. `__VA_ARGS__`. Same as `SF_FOR_EACH`, except that the elements are `...` rather than a sequence.
+// Every argument is an element (including the empty ones), except that an empty list has no elements.
+// The list is converted to a guide (see the pipelines below) 16 elements at a time, and every such step passes the rest of the list
+//   through a few macros, so the conversion costs `O(n)` tokens per element on top of the loop itself, with a small constant factor.
+// The max number of elements is `SF_MAX_ARGS`, unlike the loops over sequences.
+#define SF_FOR_EACH_ARGSxx(m, s, f, d, ...) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_ARGSxx, yy) IMPL_SEQFOR_IDENTITYxx( IMPL_SEQFOR_FOR_GUIDExx_A IMPL_SEQFOR_LPAREN m, s, f, d, IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)) ) )
 
 // Various useful macros, to be passed as arguments to `SF_FOR_EACH`.
 #define SF_NULL(...) // A no-op.
 #define SF_STATE(...) IMPL_SEQFOR_STATE(__VA_ARGS__,) // Returns the second argument. As the step and/or final function, returns the state unchanged.
 #define SF_STATE_EXPAND(...) IMPL_SEQFOR_STATE_EXPAND(__VA_ARGS__,) // Same as `SF_STATE()`, but additionally expands the parentheses, as they are so common in the state.
+#define SF_STATE_INC(...) IMPL_SEQFOR_STATE_INC(__VA_ARGS__,) // Increments the state, which must be a counter (see below). Use it as the step function.
+
+// Counters, for use as the loop state.
+// A counter is a parenthesized list of decimal digits, least significant first. E.g. `(0)` is zero, and `(2,1)` is twelve.
+// Unlike `d+1`, incrementing it doesn't make it longer (except for the new digits), so it's cheap to carry through a long loop.
+// `SF_COUNTER(d)` converts a counter to a single decimal literal, e.g. `(2,1)` -> `12`.
+// The max number of digits is `SF_MAX_COUNTER_DIGITS`.
+#define SF_COUNTER(c) IMPL_SEQFOR_COUNTER(IMPL_SEQFOR_COUNTER_EXPAND c)
+
+// Sequence algorithms. Same as the loops, they accept sequences of any length, and the elements can contain commas.
+// `SF_SEQ_SIZE(seq)` returns the number of elements, as a decimal literal.
+// `SF_SEQ_ELEM(i, seq)` returns the element at index `i`, or nothing if it's out of range. `i` is a counter, e.g. `(0)` or `(2,1)`.
+// `SF_SEQ_TO_ARGS(seq)` converts `(a)(b)(c)` to `a, b, c`.
+// `SF_SEQ_REVERSE(seq)` reverses the sequence. Unlike the rest, it's quadratic, since it has to carry the reversed part as the loop state.
+// `SF_SEQ_MAP(m, seq)` returns `(m(n, a))(m(n, b))...`, where `n` is the same as in `SF_FOR_EACH`.
+// `SF_SEQ_FILTER(p, seq)` returns only the elements for which `p(n, x)` returns `1` (as opposed to `0`).
+// Use `SF_SEQ_MAPi(...)` and `SF_SEQ_FILTERi(...)` in nested loops, same as with `SF_FOR_EACHi`.
+// The other ones don't call any user macros, and work at any nesting level as is.
+#define SF_SEQ_SIZE(seq) IMPL_SEQFOR_SEQ_IDENTITY( IMPL_SEQFOR_SIZE_A IMPL_SEQFOR_LPAREN (0), IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_ELEM(i, seq) IMPL_SEQFOR_SEQ_IDENTITY( IMPL_SEQFOR_ELEM_A IMPL_SEQFOR_LPAREN i, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_TO_ARGS(seq) IMPL_SEQFOR_TO_ARGS_END(IMPL_SEQFOR_TO_ARGS_A seq)
+#define SF_SEQ_REVERSE(seq) IMPL_SEQFOR_SEQ_IDENTITY( IMPL_SEQFOR_REVERSE_A IMPL_SEQFOR_LPAREN , IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_MAPxx(m, seq) IMPL_SEQFOR_IDENTITYxx( IMPL_SEQFOR_MAPxx_A IMPL_SEQFOR_LPAREN m, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define SF_SEQ_FILTERxx(p, seq) IMPL_SEQFOR_IDENTITYxx( IMPL_SEQFOR_FILTERxx_A IMPL_SEQFOR_LPAREN p, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+
+// Pipelines. Every loop first converts the sequence to the internal "guide" form, which costs one macro expansion per element.
+// When one stage feeds another, you can skip this conversion by passing the guide around instead of the sequence.
+// `SF_GUIDE(seq)` converts a sequence to a guide, and `SF_GUIDE_ARGS(...)` converts a comma-separated list (same as in `SF_FOR_EACH_ARGS`). `SF_SEQ_MAP_G(m, g)` and `SF_SEQ_FILTER_G(p, g)` accept a guide and return a guide.
+// Every other loop and algorithm has a `_G` variation accepting a guide instead of a sequence, e.g. `SF_FOR_EACH_G(m, s, f, d, g)`.
+// A guide has unbalanced parentheses, so it must be written directly as the argument of a `_G` macro,
+//   and can't go through the parameters of your own macros. E.g. `SF_SEQ_SIZE_G(SF_SEQ_FILTER_G(p, SF_GUIDE(seq)))`.
+// To emit a guide from your own loop, emit `SF_GUIDE_ELEM(x)` for every element, and then `SF_GUIDE_END`.
+#define SF_GUIDE(seq) IMPL_SEQFOR_TO_GUIDE_A seq
+#define SF_GUIDE_ARGS(...) IMPL_SEQFOR_ARGS_TO_GUIDE(__VA_ARGS__)
+#define SF_GUIDE_ELEM(...) IMPL_SEQFOR_RPAREN __VA_ARGS__ IMPL_SEQFOR_RPAREN
+#define SF_GUIDE_END IMPL_SEQFOR_TO_GUIDE_A
+#define SF_FOR_EACH_Gxx(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_Gxx, yy) IMPL_SEQFOR_FOR_GUIDExx_A(m, s, f, d, g) )
+#define SF_FOR_EACH_SIMPLE_Gxx(m, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_SIMPLE_Gxx, yy) IMPL_SEQFOR_SIMPLExx_A(m, g) )
+#define SF_FOR_EACH_FAST_Gxx(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_FAST_Gxx, yy) IMPL_SEQFOR_FASTxx_A(m, s, f, d, g) )
+#define SF_FOR_EACH_UNTIL_Gxx(m, s, f, d, g) IMPL_SEQFOR_TRACE_BEGIN(SF_FOR_EACH_UNTIL_Gxx, yy) IMPL_SEQFOR_UNTILxx_A(m, s, f, d, g) )
+#define SF_SEQ_SIZE_G(g) IMPL_SEQFOR_SIZE_A((0), g) )
+#define SF_SEQ_ELEM_G(i, g) IMPL_SEQFOR_ELEM_A(i, g) )
+#define SF_SEQ_TO_ARGS_G(g) IMPL_SEQFOR_TO_ARGS_G_A(g) )
+#define SF_SEQ_REVERSE_G(g) IMPL_SEQFOR_REVERSE_A(, g) )
+#define SF_SEQ_MAP_Gxx(m, g) IMPL_SEQFOR_MAP_Gxx_A(m, g) )
+#define SF_SEQ_FILTER_Gxx(p, g) IMPL_SEQFOR_FILTER_Gxx_A(p, g) )
+
+// Tracing. Define `SF_TRACE` before including this header to find out which loops are expensive to preprocess.
+// In this mode, every `SF_FOR_EACH...` loop (including the `_G` ones, but not the sequence algorithms) emits `_Pragma("sf_trace ...")` markers,
+//   which show up as `#pragma sf_trace ...` lines in the `-E` output: `begin <macro> <n> <file> <line>` before the loop,
+//   `iter` before every call of `m`, and `end <d>` after the call of `f` (with `d` being the final state, empty for `SF_FOR_EACH_SIMPLE`).
+// Pipe the `-E` output to `trace_report.py` to get a per-call-site report.
+// The markers become a part of the loop output, so in this mode you can't pass that output to other macros (e.g. as a sequence or a guide),
+//   or stringize it. Without `SF_TRACE`, the loops are unaffected, except for an empty macro call at the start of each loop.
+
+// File iteration. Same as `SF_FOR_EACH(m, s, f, d, seq)`, but the output is produced a chunk of elements at a time,
+//   by re-including a header for every chunk, so the preprocessor doesn't hold the output of the whole loop in memory at once. Usage:
+//     #define SF_ITERATE_SEQ (a)(b)(c)
+//     #define SF_ITERATE_M(n, d, x) ...
+//     #include SF_ITERATE
+// `SF_ITERATE_S(n, d, x)`, `SF_ITERATE_F(n, d)` and `SF_ITERATE_D` are optional, and default to `SF_STATE`, `SF_NULL` and nothing respectively.
+// Same as in `SF_FOR_EACH_FAST`, `s` can't emit text. `n` is `0`, same as in `SF_FOR_EACH`.
+// `SF_ITERATE_CHUNK` is the number of elements per chunk, one of `1`, `10`, `100`, `1000` (the default), `10000`. The max number of chunks is 10000, a longer sequence is an error.
+// All those macros are undefined at the end, so you can define them again for the next loop.
+// Macros can't store the state between the inclusions, so every chunk walks the whole sequence, calling only `s` for the preceding elements.
+//   This makes it `O(n^2 / chunk)` in time, and the memory is still proportional to `n` (with a smaller factor, since `m` is called
+//   only for one chunk). So this only pays off for huge sequences where `m` emits a lot, and the chunk should be as large as you can afford.
+// With GCC, this needs `-ftrack-macro-expansion=0`, otherwise it remembers every expansion until the end of the TU, which makes the memory usage worse, not better.
+#define SF_ITERATE "macro_sequence_for_iterate.h"
 
 // Concatenate two identifiers.
 #define SF_CAT(x, y) SF_CAT_(x, y)
 #define SF_CAT_(x, y) x##y
 
-// The max loop nesting level. This is baked in at the code generation time, adjust it in `generate.sh`.
-// The actual number of supporting nesting levels is `N+1`, with name suffixes ``, `0`, `1`, ..., `N-1`.
-// The most nested loop will report `N` as the next available level.
+// The max loop nesting level. You can define it before including this header, up to `SF_MAX_DEPTH_LIMIT`, otherwise it defaults to 8.
+// The actual number of supporting nesting levels is `SF_MAX_DEPTH+1`, with name suffixes ``, `0`, `1`, ..., `SF_MAX_DEPTH-1`.
+// The most nested loop will report `SF_MAX_DEPTH` as the next available level.
+// Every level costs some time to parse, so only the requested ones are loaded, from `macro_sequence_for/level_<i>.h` next to this header.
+// Only the first inclusion of this header in a TU determines the depth.
+#ifndef SF_MAX_DEPTH
 #define SF_MAX_DEPTH 0
+#endif
+
+// The max value of `SF_MAX_DEPTH`. This is baked in at the code generation time, adjust it in `generate.sh`.
+#define SF_MAX_DEPTH_LIMIT 0
+
+// The max number of digits in a counter (see `SF_STATE_INC`). This is baked in at the code generation time, adjust it in `generate.sh`.
+#define SF_MAX_COUNTER_DIGITS 1
+
+// The max number of sequences in `SF_FOR_EACH_ZIP`. This is baked in at the code generation time, adjust it in `generate.sh`.
+#define SF_MAX_ZIP 2
+
+// The max number of elements in `SF_FOR_EACH_ARGS` and `SF_GUIDE_ARGS`. This is baked in at the code generation time, adjust it in `generate.sh`.
+#define SF_MAX_ARGS 16
 
 
 // Implementation:
@@ -68,42 +189,418 @@
 #error The standard-conformant MSVC preprocessor is required, enable it with `/Zc:preprocessor`.
 #endif
 
-// Same as `SF_FOR_EACH`, but the list is spelled differently, as described in `IMPL_SEQFOR_FOR_GUIDExx_A`.
-#define IMPL_SEQFOR_FORxx(m, s, f, d, guide) IMPL_SEQFOR_IDENTITYxx( IMPL_SEQFOR_FOR_GUIDExx_A IMPL_SEQFOR_LPAREN m, s, f, d, guide )
+#if SF_MAX_DEPTH < 0 || SF_MAX_DEPTH > SF_MAX_DEPTH_LIMIT
+#error `SF_MAX_DEPTH` is out of range, adjust `SF_MAX_DEPTH_LIMIT` in `generate.sh` if you need more levels.
+#endif
 
 // Various helpers.
 #define IMPL_SEQFOR_NULL(...)
 #define IMPL_SEQFOR_IDENTITYxx(...) __VA_ARGS__
 #define IMPL_SEQFOR_LPAREN (
+#define IMPL_SEQFOR_RPAREN )
 #define IMPL_SEQFOR_CAT(x, y) IMPL_SEQFOR_CAT_(x,y)
 #define IMPL_SEQFOR_CAT_(x, y) x##y
+#define IMPL_SEQFOR_NONEMPTY(...) __VA_OPT__(1)
 // Implementation of `SF_STATE`.
 #define IMPL_SEQFOR_STATE(n, d, ...) d
 #define IMPL_SEQFOR_STATE_EXPAND(n, d, ...) IMPL_SEQFOR_STATE_EXPAND_IDENTITY d
 #define IMPL_SEQFOR_STATE_EXPAND_IDENTITY(...) __VA_ARGS__ // I believe this one doesn't need to be unique per recursion depth.
+// Implementation of `SF_STATE_INC`.
+#define IMPL_SEQFOR_STATE_INC(n, d, ...) (IMPL_SEQFOR_INC d)
+
+// Implementation of counters.
+// `IMPL_SEQFOR_INCzz(x, ...)` increments the counter digits `x, ...`, where `x` is the digit at position `zz`.
+// `IMPL_SEQFOR_INC_DIGIT_x` expands to the next digit, and to `1` after it if there's a carry. An empty `x` is a new digit.
+// The next position is invoked by `IMPL_SEQFOR_INCzz__` itself, rather than by `IMPL_SEQFOR_INC_CARRY_1`, to avoid recursion.
+#define IMPL_SEQFOR_INCzz(x, ...) IMPL_SEQFOR_INCzz_(IMPL_SEQFOR_INC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_INCzz_(...) IMPL_SEQFOR_INCzz__(__VA_ARGS__)
+#define IMPL_SEQFOR_INCzz__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_INCww)(__VA_ARGS__)
+#define IMPL_SEQFOR_INC_CARRY_(next) IMPL_SEQFOR_INC_REST
+#define IMPL_SEQFOR_INC_CARRY_1(next) , next
+#define IMPL_SEQFOR_INC_REST(...) __VA_OPT__(,) __VA_ARGS__
+#define IMPL_SEQFOR_INC_DIGIT_ 1,
+#define IMPL_SEQFOR_INC_DIGIT_0 1,
+#define IMPL_SEQFOR_INC_DIGIT_1 2,
+#define IMPL_SEQFOR_INC_DIGIT_2 3,
+#define IMPL_SEQFOR_INC_DIGIT_3 4,
+#define IMPL_SEQFOR_INC_DIGIT_4 5,
+#define IMPL_SEQFOR_INC_DIGIT_5 6,
+#define IMPL_SEQFOR_INC_DIGIT_6 7,
+#define IMPL_SEQFOR_INC_DIGIT_7 8,
+#define IMPL_SEQFOR_INC_DIGIT_8 9,
+#define IMPL_SEQFOR_INC_DIGIT_9 0, 1
+// `IMPL_SEQFOR_LITzz(acc, x, ...)` pastes the digits `x, ...` in the reverse order, then appends `acc`.
+#define IMPL_SEQFOR_COUNTER(...) IMPL_SEQFOR_LIT(, __VA_ARGS__)
+#define IMPL_SEQFOR_COUNTER_EXPAND(...) __VA_ARGS__
+#define IMPL_SEQFOR_LITzz(acc, x, ...) IMPL_SEQFOR_LIT_FIRST(__VA_OPT__(IMPL_SEQFOR_LITww(x##acc, __VA_ARGS__),) x##acc)
+#define IMPL_SEQFOR_LIT_FIRST(x, ...) x
+// `IMPL_SEQFOR_DECzz(x, ...)` decrements a nonzero counter, same as `IMPL_SEQFOR_INCzz`. The length stays the same, so it can end up with leading zeros.
+#define IMPL_SEQFOR_DECzz(x, ...) IMPL_SEQFOR_DECzz_(IMPL_SEQFOR_DEC_DIGIT_##x, __VA_ARGS__)
+#define IMPL_SEQFOR_DECzz_(...) IMPL_SEQFOR_DECzz__(__VA_ARGS__)
+#define IMPL_SEQFOR_DECzz__(y, c, ...) y IMPL_SEQFOR_CAT_(IMPL_SEQFOR_INC_CARRY_, c)(IMPL_SEQFOR_DECww)(__VA_ARGS__)
+#define IMPL_SEQFOR_DEC_DIGIT_0 9, 1
+#define IMPL_SEQFOR_DEC_DIGIT_1 0,
+#define IMPL_SEQFOR_DEC_DIGIT_2 1,
+#define IMPL_SEQFOR_DEC_DIGIT_3 2,
+#define IMPL_SEQFOR_DEC_DIGIT_4 3,
+#define IMPL_SEQFOR_DEC_DIGIT_5 4,
+#define IMPL_SEQFOR_DEC_DIGIT_6 5,
+#define IMPL_SEQFOR_DEC_DIGIT_7 6,
+#define IMPL_SEQFOR_DEC_DIGIT_8 7,
+#define IMPL_SEQFOR_DEC_DIGIT_9 8,
+// `IMPL_SEQFOR_IS_ZEROzz(x, ...)` returns `1` if all the digits are zero (leading zeros are allowed), or `0` otherwise.
+// Same as above, `IMPL_SEQFOR_IS_ZERO_x` returns the next position to check, and an empty `x` means we ran out of digits.
+#define IMPL_SEQFOR_IS_ZEROzz(x, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_IS_ZERO_, x)(IMPL_SEQFOR_IS_ZEROww)(__VA_ARGS__)
+#define IMPL_SEQFOR_IS_ZERO_(next) 1 IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_IS_ZERO_0(next) next
+#define IMPL_SEQFOR_IS_ZERO_1(next) 0 IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_IS_ZERO_2(next) 0 IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_IS_ZERO_3(next) 0 IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_IS_ZERO_4(next) 0 IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_IS_ZERO_5(next) 0 IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_IS_ZERO_6(next) 0 IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_IS_ZERO_7(next) 0 IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_IS_ZERO_8(next) 0 IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_IS_ZERO_9(next) 0 IMPL_SEQFOR_NULL
+
+// Implementation of `SF_FOR_EACH_ZIP`.
+// `IMPL_SEQFOR_ZIP_SPLIT(c...)` splits the sequences `c...` into `0, (tails...), heads...`, or returns `1, ()` if any of them is empty, or `2, ()` if there are too many of them.
+// `IMPL_SEQFOR_ZIP_COLqq(t, h, c, ...)` handles the sequence `c` at position `qq`, where `t` and `h` are the tails and heads
+//   collected so far, each starting with an extra comma. Same as `IMPL_SEQFOR_INCzz`, the next position is returned rather than called.
+#define IMPL_SEQFOR_ZIP_SPLIT(...) IMPL_SEQFOR_ZIP_COL((), (), __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COLqq(t, h, c, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ZIP_HAS_, IMPL_SEQFOR_NONEMPTY(c))(IMPL_SEQFOR_ZIP_COLqq_)(t, h, IMPL_SEQFOR_ZIP_POP c, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COLqq_(...) IMPL_SEQFOR_ZIP_COLqq__(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_COLqq__(t, h, x, c, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIP_NEXT_, __VA_OPT__(1))(IMPL_SEQFOR_ZIP_COLvv)((IMPL_SEQFOR_ZIP_EXPAND t, c), (IMPL_SEQFOR_ZIP_EXPAND h, IMPL_SEQFOR_ZIP_EXPAND x) __VA_OPT__(,) __VA_ARGS__)
+#define IMPL_SEQFOR_ZIP_HAS_(next) IMPL_SEQFOR_ZIP_STOP
+#define IMPL_SEQFOR_ZIP_HAS_1(next) next
+#define IMPL_SEQFOR_ZIP_NEXT_(next) IMPL_SEQFOR_ZIP_DONE
+#define IMPL_SEQFOR_ZIP_NEXT_1(next) next
+#define IMPL_SEQFOR_ZIP_STOP(...) 1, ()
+// The position after the last one. `generate.sh` renumbers it to match `SF_MAX_ZIP`.
+#define IMPL_SEQFOR_ZIP_COL0(...) 2, ()
+#define IMPL_SEQFOR_ZIP_DONE(t, h) 0, (IMPL_SEQFOR_ZIP_DROP_FIRST t) IMPL_SEQFOR_ZIP_EXPAND h
+#define IMPL_SEQFOR_ZIP_POP(...) (__VA_ARGS__),
+#define IMPL_SEQFOR_ZIP_EXPAND(...) __VA_ARGS__
+#define IMPL_SEQFOR_ZIP_DROP_FIRST(x, ...) __VA_ARGS__
 
-// `IMPL_SEQFOR_ANNOTATE_SEQ_END(IMPL_SEQFOR_ANNOTATE_SEQ_A seq)` converts `seq` from e.g. `(a)(b)(c)` to `()(a)()(b)()(c)(0)`.
-#define IMPL_SEQFOR_ANNOTATE_SEQ_A(...) ()(__VA_ARGS__)IMPL_SEQFOR_ANNOTATE_SEQ_B
-#define IMPL_SEQFOR_ANNOTATE_SEQ_B(...) ()(__VA_ARGS__)IMPL_SEQFOR_ANNOTATE_SEQ_A
-#define IMPL_SEQFOR_ANNOTATE_SEQ_A_END
-#define IMPL_SEQFOR_ANNOTATE_SEQ_B_END
-#define IMPL_SEQFOR_ANNOTATE_SEQ_END(x) IMPL_SEQFOR_ANNOTATE_SEQ_END_(x)(0)
-#define IMPL_SEQFOR_ANNOTATE_SEQ_END_(x) x##_END
+// Implementation of `SF_FOR_EACH_ARGS`, converting `a, b, c` to a guide, `)a))b))c)IMPL_SEQFOR_TO_GUIDE_A`.
+// A comma-separated list can't be consumed one element at a time like a sequence, since the rest of the list is always an argument
+//   of the same macro call. So `IMPL_SEQFOR_ARGS_STEPkk(...)` converts the first 16 elements at once, and passes the rest to the next step,
+//   which is a different macro to avoid recursion. Hence the limit on the number of elements.
+// The next step is called by `IMPL_SEQFOR_ARGS_STEPkk` itself (as the name returned by `_NEXT_1`), to avoid nesting it in the shared macros.
+#define IMPL_SEQFOR_ARGS_TO_GUIDE(...) __VA_OPT__(IMPL_SEQFOR_ARGS_STEP(__VA_ARGS__)) IMPL_SEQFOR_TO_GUIDE_A
+#define IMPL_SEQFOR_ARGS_STEPkk(...) IMPL_SEQFOR_ARGS_CHUNK(__VA_ARGS__)(IMPL_SEQFOR_ARGS_STEPjj)(IMPL_SEQFOR_ARGS_DROP(__VA_ARGS__))
+#define IMPL_SEQFOR_ARGS_CHUNK(...) IMPL_SEQFOR_ARGS_CHUNK_(IMPL_SEQFOR_ARGS_MORE(__VA_ARGS__), __VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_CHUNK_(c, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ARGS_HEAD_, c)(__VA_ARGS__) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ARGS_NEXT_, c)
+#define IMPL_SEQFOR_ARGS_NEXT_0(next) IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_ARGS_NEXT_1(next) next
+// `_HEAD_1` converts the first 16 elements of a longer list. `_HEAD_0` converts a list of 16 elements or less, using `_ELEMi` for the last `i+1` elements.
+#define IMPL_SEQFOR_ARGS_HEAD_1(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, ...) )a))b))c))d))e))f))g))h))i))j))k))l))m))n))o))p)
+#define IMPL_SEQFOR_ARGS_HEAD_0(...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ARGS_ELEM, IMPL_SEQFOR_ARGS_PICK(__VA_ARGS__, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0))(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_DROP(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, ...) __VA_ARGS__
+#define IMPL_SEQFOR_ARGS_PICK(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, x, ...) x
+// `IMPL_SEQFOR_ARGS_MORE(...)` returns `1` if there are more than 16 elements, or `0` otherwise.
+// We can't look at the 17th element directly, since it can be anything. So we pick it twice, padding the list with empty elements
+//   and with `1`s respectively, and check if the results are empty. They only differ if the element is missing.
+#define IMPL_SEQFOR_ARGS_MORE(...) IMPL_SEQFOR_ARGS_MORE_(IMPL_SEQFOR_ARGS_PICK(__VA_ARGS__,,,,,,,,,,,,,,,,,), IMPL_SEQFOR_ARGS_PICK(__VA_ARGS__, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1))
+#define IMPL_SEQFOR_ARGS_MORE_(x, y) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ARGS_MORE_X_, IMPL_SEQFOR_NONEMPTY(x))(y)
+#define IMPL_SEQFOR_ARGS_MORE_X_1(y) 1
+#define IMPL_SEQFOR_ARGS_MORE_X_(y) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ARGS_MORE_Y_, IMPL_SEQFOR_NONEMPTY(y))()
+#define IMPL_SEQFOR_ARGS_MORE_Y_1() 0
+#define IMPL_SEQFOR_ARGS_MORE_Y_() 1
+#define IMPL_SEQFOR_ARGS_ELEM15(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM14(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM14(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM13(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM13(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM12(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM12(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM11(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM11(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM10(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM10(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM9(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM9(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM8(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM8(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM7(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM7(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM6(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM6(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM5(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM5(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM4(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM4(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM3(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM3(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM2(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM2(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM1(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM1(x, ...) )x) IMPL_SEQFOR_ARGS_ELEM0(__VA_ARGS__)
+#define IMPL_SEQFOR_ARGS_ELEM0(x) )x)
 
-// `IMPL_SEQFOR_TO_GUIDE_A seq` converts `seq` from e.g. `(a)(b)(c)` to `a)b)c)IMPL_SEQFOR_TO_GUIDE_A` (or ...`_B`).
-// We call the resulting sequence `a)b)c)` a "guide".
-#define IMPL_SEQFOR_TO_GUIDE_A(...) __VA_ARGS__)IMPL_SEQFOR_TO_GUIDE_B
-#define IMPL_SEQFOR_TO_GUIDE_B(...) __VA_ARGS__)IMPL_SEQFOR_TO_GUIDE_A
+// `IMPL_SEQFOR_TO_GUIDE_A seq` converts `seq` from e.g. `(a)(b)(c)` to `)a))b))c)IMPL_SEQFOR_TO_GUIDE_A` (or ...`_B`), in a single pass.
+// We call the resulting sequence a "guide". The trailing `IMPL_SEQFOR_TO_GUIDE_{A,B}` acts as the terminator,
+//   see `IMPL_SEQFOR_FOR_GUIDExx_A` below.
+// This used to be done in two passes, `(a)(b)` -> `()(a)()(b)(0)` -> `)a))b)0)`, which rescanned every element twice.
+#define IMPL_SEQFOR_TO_GUIDE_A(...) )__VA_ARGS__)IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_TO_GUIDE_B(...) )__VA_ARGS__)IMPL_SEQFOR_TO_GUIDE_A
 
-// Usage: `IMPL_SEQFOR_FOR_GUIDExx_A(m,s,d,`, followed by a sequence of 0+ blocks of the form `)x)`, followed by `0)`, finally followed by arbitrary junk.
+// `IMPL_SEQFOR_SKIP_A(` followed by the rest of a guide discards it, along with the extra `)` after it. Used to stop loops early.
+// This needs two small macros per remaining element, and doesn't carry the loop state.
+#define IMPL_SEQFOR_SKIP_A(e) IMPL_SEQFOR_SKIP_A_##e(
+#define IMPL_SEQFOR_SKIP_A_ IMPL_SEQFOR_SKIP_B
+#define IMPL_SEQFOR_SKIP_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SKIP_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SKIP_B(...) IMPL_SEQFOR_SKIP_A(
+
+// Usage: `IMPL_SEQFOR_FOR_GUIDExx_A(m,s,f,d,`, followed by a sequence of 0+ blocks of the form `)x)`,
+//   followed by `IMPL_SEQFOR_TO_GUIDE_{A,B}) )` (as produced by `IMPL_SEQFOR_TO_GUIDE_A`, plus one extra `)`).
 // For each `)x)` in the sequence, expands to `m(r,d,x)`, then modifies `d` to contain `s(r,d,x)`, where `r` is the next available loop nesting level.
-#define IMPL_SEQFOR_FOR_GUIDExx_A(m, s, f, d, e) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FOR_GUIDExx_A_, e)(m, s, f, d)
-#define IMPL_SEQFOR_FOR_GUIDExx_A_(m, s, f, d) IMPL_SEQFOR_FOR_GUIDExx_B(m, s, f, d,
-#define IMPL_SEQFOR_FOR_GUIDExx_A_0(m, s, f, d) f(yy, d) IMPL_SEQFOR_NULL(
+// Every macro here receives the whole state, so every one of them costs `O(|d|)` per iteration. Hence we try to keep their number low:
+//   `_A` pastes the guide element `e` directly with `##` (rather than through `IMPL_SEQFOR_CAT_`, which would be one more call per iteration),
+//   and the result is an object-like macro naming the next step, which then picks up the `(m, s, f, d,` left by `_A`.
+//   The other loops below do the same.
+#define IMPL_SEQFOR_FOR_GUIDExx_A(m, s, f, d, e) IMPL_SEQFOR_FOR_GUIDExx_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FOR_GUIDExx_A_ IMPL_SEQFOR_FOR_GUIDExx_B
+#define IMPL_SEQFOR_FOR_GUIDExx_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDExx_END
+#define IMPL_SEQFOR_FOR_GUIDExx_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDExx_END
+#define IMPL_SEQFOR_FOR_GUIDExx_END(m, s, f, d, ...) f(yy, d)
 #define IMPL_SEQFOR_FOR_GUIDExx_B(m, s, f, d, ...) m(yy, d, __VA_ARGS__) IMPL_SEQFOR_FOR_GUIDExx_B_0(m, s, f, s(yy, d, __VA_ARGS__))
 #define IMPL_SEQFOR_FOR_GUIDExx_B_0(...) IMPL_SEQFOR_FOR_GUIDExx_B_1(__VA_ARGS__)
 #define IMPL_SEQFOR_FOR_GUIDExx_B_1(m, s, f, d, ...) __VA_ARGS__ IMPL_SEQFOR_FOR_GUIDExx_A(m, s, f, d,
 
+// Same as `IMPL_SEQFOR_FOR_GUIDExx_A`, but for `SF_FOR_EACH_FAST`. `_B` passes `s(...)` unexpanded as the new state,
+//   and it gets expanded as an argument of `_A`.
+#define IMPL_SEQFOR_FASTxx_A(m, s, f, d, e) IMPL_SEQFOR_FASTxx_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_FASTxx_A_ IMPL_SEQFOR_FASTxx_B
+#define IMPL_SEQFOR_FASTxx_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDExx_END
+#define IMPL_SEQFOR_FASTxx_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDExx_END
+#define IMPL_SEQFOR_FASTxx_B(m, s, f, d, ...) m(yy, d, __VA_ARGS__) IMPL_SEQFOR_FASTxx_A(m, s, f, s(yy, d, __VA_ARGS__),
+
+// Same as `IMPL_SEQFOR_FOR_GUIDExx_A`, but for `SF_FOR_EACH_UNTIL`. `_B_1` receives the stop flag from `s` and either continues or stops.
+#define IMPL_SEQFOR_UNTILxx_A(m, s, f, d, e) IMPL_SEQFOR_UNTILxx_A_##e(m, s, f, d,
+#define IMPL_SEQFOR_UNTILxx_A_ IMPL_SEQFOR_UNTILxx_B
+#define IMPL_SEQFOR_UNTILxx_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDExx_END
+#define IMPL_SEQFOR_UNTILxx_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDExx_END
+#define IMPL_SEQFOR_UNTILxx_B(m, s, f, d, ...) m(yy, d, __VA_ARGS__) IMPL_SEQFOR_UNTILxx_B_0(m, s, f, s(yy, d, __VA_ARGS__))
+#define IMPL_SEQFOR_UNTILxx_B_0(...) IMPL_SEQFOR_UNTILxx_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_UNTILxx_B_1(m, s, f, b, d, ...) __VA_ARGS__ IMPL_SEQFOR_CAT_(IMPL_SEQFOR_UNTILxx_B_1_, b)(m, s, f, d,
+#define IMPL_SEQFOR_UNTILxx_B_1_0 IMPL_SEQFOR_UNTILxx_A
+#define IMPL_SEQFOR_UNTILxx_B_1_1 IMPL_SEQFOR_UNTILxx_STOP
+#define IMPL_SEQFOR_UNTILxx_STOP(m, s, f, d, e) f(yy, d) IMPL_SEQFOR_SKIP_A_##e(
+
+// Same as `IMPL_SEQFOR_FASTxx_A`, but for `SF_FOR_EACH_ZIP`. `r` is the list of the remaining sequences other than the first one.
+// `_B` splits them into heads and tails, `_B_1` stops the loop if any of them ran out, then `_C` spreads the heads into the arguments of `m`.
+#define IMPL_SEQFOR_ZIPxx_A(m, s, f, d, r, e) IMPL_SEQFOR_ZIPxx_A_##e(m, s, f, d, r,
+#define IMPL_SEQFOR_ZIPxx_A_ IMPL_SEQFOR_ZIPxx_B
+#define IMPL_SEQFOR_ZIPxx_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_FOR_GUIDExx_END
+#define IMPL_SEQFOR_ZIPxx_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_FOR_GUIDExx_END
+#define IMPL_SEQFOR_ZIPxx_B(m, s, f, d, r, ...) IMPL_SEQFOR_ZIPxx_B_0(m, s, f, d, (__VA_ARGS__), IMPL_SEQFOR_ZIP_SPLIT r)
+#define IMPL_SEQFOR_ZIPxx_B_0(...) IMPL_SEQFOR_ZIPxx_B_1(__VA_ARGS__)
+#define IMPL_SEQFOR_ZIPxx_B_1(m, s, f, d, x, z, r, ...) IMPL_SEQFOR_CAT_(IMPL_SEQFOR_ZIPxx_B_1_, z)(m, s, f, d, r, IMPL_SEQFOR_ZIP_EXPAND x, __VA_ARGS__)
+#define IMPL_SEQFOR_ZIPxx_B_1_0 IMPL_SEQFOR_ZIPxx_C
+#define IMPL_SEQFOR_ZIPxx_B_1_1(m, s, f, d, ...) f(yy, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIPxx_B_1_2(m, s, f, d, ...) SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ZIPxx_C(m, s, f, d, r, ...) m(yy, d, __VA_ARGS__) IMPL_SEQFOR_ZIPxx_A(m, s, f, s(yy, d, __VA_ARGS__), r,
+
+// Same as `IMPL_SEQFOR_FOR_GUIDExx_A`, but for `SF_FOR_EACH_SIMPLE`. Only `m` is passed around.
+#define IMPL_SEQFOR_SIMPLExx_A(m, e) IMPL_SEQFOR_SIMPLExx_A_##e(m,
+#define IMPL_SEQFOR_SIMPLExx_A_ IMPL_SEQFOR_SIMPLExx_B
+#define IMPL_SEQFOR_SIMPLExx_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLExx_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_SIMPLExx_B(m, ...) m(yy, __VA_ARGS__) IMPL_SEQFOR_SIMPLExx_A(m,
+
+// Implementation of the sequence algorithms. They are the same as `IMPL_SEQFOR_SIMPLExx_A`, except for what they pass around and emit.
+// Those not calling user macros don't need per-level copies, but they need their own `IMPL_SEQFOR_SEQ_IDENTITY`,
+//   to be usable in loop bodies, which expand inside of `IMPL_SEQFOR_IDENTITYxx`.
+#define IMPL_SEQFOR_SEQ_IDENTITY(...) __VA_ARGS__
+// `SF_SEQ_SIZE` carries a counter, which is cheap to increment.
+#define IMPL_SEQFOR_SIZE_A(c, e) IMPL_SEQFOR_SIZE_A_##e(c,
+#define IMPL_SEQFOR_SIZE_A_ IMPL_SEQFOR_SIZE_B
+#define IMPL_SEQFOR_SIZE_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_SIZE_END
+#define IMPL_SEQFOR_SIZE_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_SIZE_END
+#define IMPL_SEQFOR_SIZE_END(c, ...) SF_COUNTER(c)
+#define IMPL_SEQFOR_SIZE_B(c, ...) IMPL_SEQFOR_SIZE_A((IMPL_SEQFOR_INC c),
+// `SF_SEQ_ELEM` counts the index down to zero, then emits the element and skips the rest.
+#define IMPL_SEQFOR_ELEM_A(i, e) IMPL_SEQFOR_ELEM_A_##e(i,
+#define IMPL_SEQFOR_ELEM_A_ IMPL_SEQFOR_ELEM_B
+#define IMPL_SEQFOR_ELEM_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_ELEM_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_ELEM_B(i, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ELEM_B_, IMPL_SEQFOR_IS_ZERO i)(i, __VA_ARGS__)
+#define IMPL_SEQFOR_ELEM_B_0(i, ...) IMPL_SEQFOR_ELEM_A((IMPL_SEQFOR_DEC i),
+#define IMPL_SEQFOR_ELEM_B_1(i, ...) __VA_ARGS__ IMPL_SEQFOR_SKIP_A(
+// `SF_SEQ_TO_ARGS` doesn't need a guide, since it doesn't need to stop. It uses the old trick of pasting `_END` to the leftover macro name.
+#define IMPL_SEQFOR_TO_ARGS_A(...) __VA_ARGS__ IMPL_SEQFOR_TO_ARGS_B
+#define IMPL_SEQFOR_TO_ARGS_B(...) , __VA_ARGS__ IMPL_SEQFOR_TO_ARGS_C
+#define IMPL_SEQFOR_TO_ARGS_C(...) , __VA_ARGS__ IMPL_SEQFOR_TO_ARGS_B
+#define IMPL_SEQFOR_TO_ARGS_END(...) IMPL_SEQFOR_TO_ARGS_END_(__VA_ARGS__)
+#define IMPL_SEQFOR_TO_ARGS_END_(...) __VA_ARGS__##_END
+#define IMPL_SEQFOR_TO_ARGS_A_END
+#define IMPL_SEQFOR_TO_ARGS_B_END
+#define IMPL_SEQFOR_TO_ARGS_C_END
+// `SF_SEQ_REVERSE` prepends every element to the state.
+#define IMPL_SEQFOR_REVERSE_A(d, e) IMPL_SEQFOR_REVERSE_A_##e(d,
+#define IMPL_SEQFOR_REVERSE_A_ IMPL_SEQFOR_REVERSE_B
+#define IMPL_SEQFOR_REVERSE_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_REVERSE_END
+#define IMPL_SEQFOR_REVERSE_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_REVERSE_END
+#define IMPL_SEQFOR_REVERSE_END(d, ...) d
+#define IMPL_SEQFOR_REVERSE_B(d, ...) IMPL_SEQFOR_REVERSE_A((__VA_ARGS__)d,
+// `SF_SEQ_MAP` and `SF_SEQ_FILTER` call user macros, so they need per-level copies, same as the loops.
+#define IMPL_SEQFOR_MAPxx_A(m, e) IMPL_SEQFOR_MAPxx_A_##e(m,
+#define IMPL_SEQFOR_MAPxx_A_ IMPL_SEQFOR_MAPxx_B
+#define IMPL_SEQFOR_MAPxx_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAPxx_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_MAPxx_B(m, ...) (m(yy, __VA_ARGS__)) IMPL_SEQFOR_MAPxx_A(m,
+#define IMPL_SEQFOR_FILTERxx_A(p, e) IMPL_SEQFOR_FILTERxx_A_##e(p,
+#define IMPL_SEQFOR_FILTERxx_A_ IMPL_SEQFOR_FILTERxx_B
+#define IMPL_SEQFOR_FILTERxx_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTERxx_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_FILTERxx_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_, p(yy, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTERxx_A(p,
+#define IMPL_SEQFOR_FILTER_0(...)
+#define IMPL_SEQFOR_FILTER_1(...) (__VA_ARGS__)
+
+// Implementation of the pipelines. Same as above, but they emit guide elements instead of sequence elements, and the terminator at the end.
+// The `_G` macros above can pass the guide directly to `_A`, since it's already expanded as their argument. This replaces `IMPL_SEQFOR_IDENTITYxx`,
+//   which only exists to expand `IMPL_SEQFOR_TO_GUIDE_A seq` before `_A` is called.
+#define IMPL_SEQFOR_TO_ARGS_G_A(e) IMPL_SEQFOR_TO_ARGS_G_A_##e(
+#define IMPL_SEQFOR_TO_ARGS_G_A_ IMPL_SEQFOR_TO_ARGS_G_B
+#define IMPL_SEQFOR_TO_ARGS_G_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_TO_ARGS_G_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_TO_ARGS_G_B(...) __VA_ARGS__ IMPL_SEQFOR_TO_ARGS_G_C(
+#define IMPL_SEQFOR_TO_ARGS_G_C(e) IMPL_SEQFOR_TO_ARGS_G_C_##e(
+#define IMPL_SEQFOR_TO_ARGS_G_C_ IMPL_SEQFOR_TO_ARGS_G_D
+#define IMPL_SEQFOR_TO_ARGS_G_C_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_TO_ARGS_G_C_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_NULL
+#define IMPL_SEQFOR_TO_ARGS_G_D(...) , __VA_ARGS__ IMPL_SEQFOR_TO_ARGS_G_C(
+#define IMPL_SEQFOR_GUIDE_END(...) IMPL_SEQFOR_TO_GUIDE_A
+#define IMPL_SEQFOR_MAP_Gxx_A(m, e) IMPL_SEQFOR_MAP_Gxx_A_##e(m,
+#define IMPL_SEQFOR_MAP_Gxx_A_ IMPL_SEQFOR_MAP_Gxx_B
+#define IMPL_SEQFOR_MAP_Gxx_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_Gxx_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_MAP_Gxx_B(m, ...) )m(yy, __VA_ARGS__)) IMPL_SEQFOR_MAP_Gxx_A(m,
+#define IMPL_SEQFOR_FILTER_Gxx_A(p, e) IMPL_SEQFOR_FILTER_Gxx_A_##e(p,
+#define IMPL_SEQFOR_FILTER_Gxx_A_ IMPL_SEQFOR_FILTER_Gxx_B
+#define IMPL_SEQFOR_FILTER_Gxx_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_Gxx_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_GUIDE_END
+#define IMPL_SEQFOR_FILTER_Gxx_B(p, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_FILTER_G_, p(yy, __VA_ARGS__))(__VA_ARGS__) IMPL_SEQFOR_FILTER_Gxx_A(p,
+#define IMPL_SEQFOR_FILTER_G_0(...)
+#define IMPL_SEQFOR_FILTER_G_1(...) )__VA_ARGS__)
+
+// Implementation of `SF_ITERATE`, see "macro_sequence_for_iterate.h" for the inclusion logic.
+// Every chunk walks the whole sequence: `_SKIP_A` only calls `s` on the elements before the chunk, `_TAKE_A` calls `m` and `s` on the chunk,
+//   then the rest is discarded with `IMPL_SEQFOR_SKIP_A`. `f` is called only if the end of the sequence is reached while in the chunk.
+// Both count the remaining elements as `c, u`, meaning `c*10+u`, where `c` is a counter and `u` is a digit. `u` is pasted into the name
+//   of the next step, so only every 10th element has to touch the counter. Since the chunk size is a power of ten,
+//   the chunk digits `IMPL_SEQFOR_ITER_C{0..3}` give us those numbers without any arithmetic, see `IMPL_SEQFOR_ITER_{FIRST,COUNT}`.
+// This is cheaper than `SF_FOR_EACH` with a counter in the state, both in time and in memory, which matters since it runs on every chunk.
+#define IMPL_SEQFOR_ITER_LOOP IMPL_SEQFOR_ITER_LOOP_(SF_ITERATE_SEQ)
+#define IMPL_SEQFOR_ITER_LOOP_(seq) IMPL_SEQFOR_ITER_IDENTITY( IMPL_SEQFOR_ITER_SKIP_A IMPL_SEQFOR_LPAREN IMPL_SEQFOR_ITER_FIRST, SF_ITERATE_D, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define IMPL_SEQFOR_ITER_IDENTITY(...) __VA_ARGS__
+// The index of the first element of the current chunk, for `#if`.
+#define IMPL_SEQFOR_ITER_START ((((IMPL_SEQFOR_ITER_C3 * 10 + IMPL_SEQFOR_ITER_C2) * 10 + IMPL_SEQFOR_ITER_C1) * 10 + IMPL_SEQFOR_ITER_C0) * (SF_ITERATE_CHUNK))
+#define IMPL_SEQFOR_ITER_SKIP_A(c, u, d, e) IMPL_SEQFOR_ITER_SKIP_A_##e(c, u, d,
+#define IMPL_SEQFOR_ITER_SKIP_A_ IMPL_SEQFOR_ITER_SKIP_B
+#define IMPL_SEQFOR_ITER_SKIP_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_ITER_END
+#define IMPL_SEQFOR_ITER_SKIP_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_ITER_END
+#define IMPL_SEQFOR_ITER_SKIP_B(c, u, d, ...) IMPL_SEQFOR_ITER_SKIP_B_##u(c, d, __VA_ARGS__)
+#define IMPL_SEQFOR_ITER_SKIP_B_0(c, d, ...) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ITER_SKIP_C_, IMPL_SEQFOR_IS_ZERO c)(c, d, __VA_ARGS__)
+#define IMPL_SEQFOR_ITER_SKIP_B_1(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A(c, 0, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_B_2(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A(c, 1, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_B_3(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A(c, 2, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_B_4(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A(c, 3, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_B_5(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A(c, 4, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_B_6(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A(c, 5, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_B_7(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A(c, 6, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_B_8(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A(c, 7, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_B_9(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A(c, 8, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_C_0(c, d, ...) IMPL_SEQFOR_ITER_SKIP_A((IMPL_SEQFOR_DEC c), 9, SF_ITERATE_S(0, d, __VA_ARGS__),
+#define IMPL_SEQFOR_ITER_SKIP_C_1(c, d, ...) IMPL_SEQFOR_ITER_TAKE_FIRST(IMPL_SEQFOR_ITER_COUNT, d, __VA_ARGS__)
+#define IMPL_SEQFOR_ITER_TAKE_FIRST(...) IMPL_SEQFOR_ITER_TAKE_B(__VA_ARGS__)
+#define IMPL_SEQFOR_ITER_TAKE_A(c, u, d, e) IMPL_SEQFOR_ITER_TAKE_A_##e(c, u, d,
+#define IMPL_SEQFOR_ITER_TAKE_A_ IMPL_SEQFOR_ITER_TAKE_B
+#define IMPL_SEQFOR_ITER_TAKE_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_ITER_END
+#define IMPL_SEQFOR_ITER_TAKE_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_ITER_END
+#define IMPL_SEQFOR_ITER_TAKE_B(c, u, d, ...) SF_ITERATE_M(0, d, __VA_ARGS__) IMPL_SEQFOR_ITER_TAKE_C_##u(c, SF_ITERATE_S(0, d, __VA_ARGS__))
+#define IMPL_SEQFOR_ITER_TAKE_C_0(c, d) IMPL_SEQFOR_ITER_TAKE_A((IMPL_SEQFOR_DEC c), 9, d,
+#define IMPL_SEQFOR_ITER_TAKE_C_1(c, d) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ITER_TAKE_D_, IMPL_SEQFOR_IS_ZERO c)(c, d)
+#define IMPL_SEQFOR_ITER_TAKE_C_2(c, d) IMPL_SEQFOR_ITER_TAKE_A(c, 1, d,
+#define IMPL_SEQFOR_ITER_TAKE_C_3(c, d) IMPL_SEQFOR_ITER_TAKE_A(c, 2, d,
+#define IMPL_SEQFOR_ITER_TAKE_C_4(c, d) IMPL_SEQFOR_ITER_TAKE_A(c, 3, d,
+#define IMPL_SEQFOR_ITER_TAKE_C_5(c, d) IMPL_SEQFOR_ITER_TAKE_A(c, 4, d,
+#define IMPL_SEQFOR_ITER_TAKE_C_6(c, d) IMPL_SEQFOR_ITER_TAKE_A(c, 5, d,
+#define IMPL_SEQFOR_ITER_TAKE_C_7(c, d) IMPL_SEQFOR_ITER_TAKE_A(c, 6, d,
+#define IMPL_SEQFOR_ITER_TAKE_C_8(c, d) IMPL_SEQFOR_ITER_TAKE_A(c, 7, d,
+#define IMPL_SEQFOR_ITER_TAKE_C_9(c, d) IMPL_SEQFOR_ITER_TAKE_A(c, 8, d,
+#define IMPL_SEQFOR_ITER_TAKE_D_0(c, d) IMPL_SEQFOR_ITER_TAKE_A(c, 0, d,
+#define IMPL_SEQFOR_ITER_TAKE_D_1(c, d) IMPL_SEQFOR_ITER_STOP(d,
+// The chunk is done. If this was the last element, call `f` anyway, otherwise skip the rest.
+#define IMPL_SEQFOR_ITER_STOP(d, e) IMPL_SEQFOR_ITER_STOP_##e(, , d,
+#define IMPL_SEQFOR_ITER_STOP_(...) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ITER_STOP_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_ITER_END
+#define IMPL_SEQFOR_ITER_STOP_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_ITER_END
+#define IMPL_SEQFOR_ITER_END(c, u, d, ...) SF_ITERATE_F(0, d)
+// `IMPL_SEQFOR_ITER_IN_RANGE` is `1` if the sequence has an element at `IMPL_SEQFOR_ITER_START`, or `0` otherwise, for `#if`.
+// Counts down from `IMPL_SEQFOR_ITER_FIRST` like `_SKIP_A` (but without the state), and discards the rest of the sequence
+//   as soon as the element is found. Unlike `SF_SEQ_SIZE`, this doesn't touch the counter past the chunk start.
+#define IMPL_SEQFOR_ITER_IN_RANGE IMPL_SEQFOR_ITER_IN_RANGE_(SF_ITERATE_SEQ)
+#define IMPL_SEQFOR_ITER_IN_RANGE_(seq) IMPL_SEQFOR_ITER_IDENTITY( IMPL_SEQFOR_ITER_HAS_A IMPL_SEQFOR_LPAREN IMPL_SEQFOR_ITER_FIRST, IMPL_SEQFOR_TO_GUIDE_A seq) ) )
+#define IMPL_SEQFOR_ITER_HAS_A(c, u, e) IMPL_SEQFOR_ITER_HAS_A_##e(c, u,
+#define IMPL_SEQFOR_ITER_HAS_A_ IMPL_SEQFOR_ITER_HAS_B
+#define IMPL_SEQFOR_ITER_HAS_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_ITER_HAS_END
+#define IMPL_SEQFOR_ITER_HAS_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_ITER_HAS_END
+#define IMPL_SEQFOR_ITER_HAS_B(c, u, ...) IMPL_SEQFOR_ITER_HAS_B_##u(c)
+#define IMPL_SEQFOR_ITER_HAS_B_0(c) IMPL_SEQFOR_CAT(IMPL_SEQFOR_ITER_HAS_C_, IMPL_SEQFOR_IS_ZERO c)(c)
+#define IMPL_SEQFOR_ITER_HAS_B_1(c) IMPL_SEQFOR_ITER_HAS_A(c, 0,
+#define IMPL_SEQFOR_ITER_HAS_B_2(c) IMPL_SEQFOR_ITER_HAS_A(c, 1,
+#define IMPL_SEQFOR_ITER_HAS_B_3(c) IMPL_SEQFOR_ITER_HAS_A(c, 2,
+#define IMPL_SEQFOR_ITER_HAS_B_4(c) IMPL_SEQFOR_ITER_HAS_A(c, 3,
+#define IMPL_SEQFOR_ITER_HAS_B_5(c) IMPL_SEQFOR_ITER_HAS_A(c, 4,
+#define IMPL_SEQFOR_ITER_HAS_B_6(c) IMPL_SEQFOR_ITER_HAS_A(c, 5,
+#define IMPL_SEQFOR_ITER_HAS_B_7(c) IMPL_SEQFOR_ITER_HAS_A(c, 6,
+#define IMPL_SEQFOR_ITER_HAS_B_8(c) IMPL_SEQFOR_ITER_HAS_A(c, 7,
+#define IMPL_SEQFOR_ITER_HAS_B_9(c) IMPL_SEQFOR_ITER_HAS_A(c, 8,
+#define IMPL_SEQFOR_ITER_HAS_C_0(c) IMPL_SEQFOR_ITER_HAS_A((IMPL_SEQFOR_DEC c), 9,
+#define IMPL_SEQFOR_ITER_HAS_C_1(c) 1 IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_ITER_HAS_END(...) 0
+
+// Implementation of `SF_TRACE`. The loops only call `IMPL_SEQFOR_TRACE_BEGIN`, once per loop, and it's empty unless tracing is enabled.
+// The other markers are added by redefining the object-like macros that name the next step, so without `SF_TRACE` the iterations are unaffected.
+// `generate.sh` repeats this `#ifdef` for every nesting level.
+#ifdef SF_TRACE
+#define IMPL_SEQFOR_TRACE_BEGIN(name, n) IMPL_SEQFOR_TRACE_PRAGMA(begin name n __FILE__ __LINE__)
+#define IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_TRACE_PRAGMA(iter)
+#define IMPL_SEQFOR_TRACE_END(...) IMPL_SEQFOR_TRACE_PRAGMA(end __VA_ARGS__)
+#define IMPL_SEQFOR_TRACE_PRAGMA(...) _Pragma(IMPL_SEQFOR_TRACE_STR(sf_trace __VA_ARGS__))
+#define IMPL_SEQFOR_TRACE_STR(...) #__VA_ARGS__
+#define IMPL_SEQFOR_TRACE_SIMPLE_END(...) IMPL_SEQFOR_TRACE_END()
+// `_FINALxx` replaces `IMPL_SEQFOR_FOR_GUIDExx_END`, `_STOPxx` replaces `IMPL_SEQFOR_UNTILxx_STOP`.
+#define IMPL_SEQFOR_TRACE_FINALxx(m, s, f, d, ...) IMPL_SEQFOR_FOR_GUIDExx_END(m, s, f, d) IMPL_SEQFOR_TRACE_END(d)
+#define IMPL_SEQFOR_TRACE_STOPxx(m, s, f, d, e) IMPL_SEQFOR_TRACE_FINALxx(m, s, f, d) IMPL_SEQFOR_SKIP_A(e)
+#undef IMPL_SEQFOR_FOR_GUIDExx_A_
+#undef IMPL_SEQFOR_FOR_GUIDExx_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FOR_GUIDExx_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_FASTxx_A_
+#undef IMPL_SEQFOR_FASTxx_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_FASTxx_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTILxx_A_
+#undef IMPL_SEQFOR_UNTILxx_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_UNTILxx_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_UNTILxx_B_1_1
+#undef IMPL_SEQFOR_ZIPxx_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_ZIPxx_A_IMPL_SEQFOR_TO_GUIDE_B
+#undef IMPL_SEQFOR_ZIPxx_B_1_0
+#undef IMPL_SEQFOR_ZIPxx_B_1_1
+#undef IMPL_SEQFOR_SIMPLExx_A_
+#undef IMPL_SEQFOR_SIMPLExx_A_IMPL_SEQFOR_TO_GUIDE_A
+#undef IMPL_SEQFOR_SIMPLExx_A_IMPL_SEQFOR_TO_GUIDE_B
+#define IMPL_SEQFOR_FOR_GUIDExx_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FOR_GUIDExx_B
+#define IMPL_SEQFOR_FOR_GUIDExx_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINALxx
+#define IMPL_SEQFOR_FOR_GUIDExx_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINALxx
+#define IMPL_SEQFOR_FASTxx_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_FASTxx_B
+#define IMPL_SEQFOR_FASTxx_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINALxx
+#define IMPL_SEQFOR_FASTxx_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINALxx
+#define IMPL_SEQFOR_UNTILxx_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_UNTILxx_B
+#define IMPL_SEQFOR_UNTILxx_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINALxx
+#define IMPL_SEQFOR_UNTILxx_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINALxx
+#define IMPL_SEQFOR_UNTILxx_B_1_1 IMPL_SEQFOR_TRACE_STOPxx
+#define IMPL_SEQFOR_ZIPxx_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_FINALxx
+#define IMPL_SEQFOR_ZIPxx_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_FINALxx
+#define IMPL_SEQFOR_ZIPxx_B_1_0 IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_ZIPxx_C
+#define IMPL_SEQFOR_ZIPxx_B_1_1(m, s, f, d, ...) IMPL_SEQFOR_TRACE_FINALxx(m, s, f, d) IMPL_SEQFOR_SKIP_A(
+#define IMPL_SEQFOR_SIMPLExx_A_ IMPL_SEQFOR_TRACE_ITER IMPL_SEQFOR_SIMPLExx_B
+#define IMPL_SEQFOR_SIMPLExx_A_IMPL_SEQFOR_TO_GUIDE_A IMPL_SEQFOR_TRACE_SIMPLE_END
+#define IMPL_SEQFOR_SIMPLExx_A_IMPL_SEQFOR_TO_GUIDE_B IMPL_SEQFOR_TRACE_SIMPLE_END
+#else
+#define IMPL_SEQFOR_TRACE_BEGIN(name, n)
+#endif // SF_TRACE
+
 
-// Generated boilerplate for nested loops:
+// Generated boilerplate for nested loops, see `SF_MAX_DEPTH`:
 #endif
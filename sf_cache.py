@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+
+# Pre-expands marked loops in a header, to avoid expanding them in every TU that includes it.
+# Usage: `./sf_cache.py <input> <output> [<compiler> <flags>...]`, e.g. `./sf_cache.py tables.sf.h tables.h g++ -std=c++20 -Iinclude`.
+# The compiler defaults to `c++ -std=c++20`. It must accept the GCC-style `-E -P -dM -x c++ -` flags (GCC and Clang do).
+#
+# In the input, mark the regions to expand with the `// sf_cache begin` and `// sf_cache end` comments, each on its own line:
+#     #include "macro_sequence_for.h"
+#     #define BODY(n, d, x) x = d,
+#     // sf_cache begin
+#     enum E {SF_FOR_EACH(BODY, SF_STATE_INC, SF_NULL, (0), (a)(b)(c))};
+#     // sf_cache end
+# Since those are comments, the input itself is still a valid header, with the same meaning.
+# The output is a copy of the input, where every region is replaced with `#include "sf_cache/<key>.h"`, which contains its expansion.
+# The `sf_cache` directory is placed next to the output. If the output is in a different directory, the `#include "..."` paths
+#   relative to the input are adjusted to point to the same files. The key is a hash of the compiler command, the region text, and every macro
+#   definition in effect at the start of the region (as reported by `-dM`), so editing any of those expands the region again.
+# Listing the macros doesn't expand anything, so re-running this on an up-to-date input is cheap. Stale cache files are never removed,
+#   delete the directory to clean them up.
+# The regions are expanded in isolation from the code around them (but with all the macros defined above them),
+#   so they must be self-contained, and shouldn't contain preprocessor directives.
+# The regions can be inside of conditionals (e.g. in an include guard), but only in the ones that are enabled when running this tool,
+#   since the expansion of the disabled ones can't be seen in the preprocessor output.
+
+import hashlib
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+BEGIN = re.compile(r'\s*//\s*sf_cache\s+begin\s*$')
+END = re.compile(r'\s*//\s*sf_cache\s+end\s*$')
+# The directives opening and closing conditionals, to close the ones that are still open at the start of a region.
+COND_BEGIN = re.compile(r'\s*#\s*if(n?def)?\b')
+COND_END = re.compile(r'\s*#\s*endif\b')
+# The `#include "..."` directives, to fix the paths relative to the input when the output is in a different directory.
+INCLUDE = re.compile(r'(\s*#\s*include\s*")([^"]+)(".*)', re.DOTALL)
+# Separates the regions in the combined file we pass to the preprocessor. This shouldn't be a macro, and must survive the expansion intact.
+SEPARATOR = 'IMPL_SEQFOR_CACHE_SEPARATOR'
+CACHE_DIR = 'sf_cache'
+
+# Runs the preprocessor on `text` with extra `flags`, returns the output.
+# The text is written to a temporary header next to the input, so that `#include "..."` works the same way as in the input itself.
+# It's included from the standard input rather than compiled directly, to avoid warnings about `#pragma once` in the main file.
+# On failure, exits with an error message. The compiler prints its own errors to stderr.
+def preprocess(compiler, input_dir, text, flags):
+    fd, path = tempfile.mkstemp(suffix = '.h', prefix = '.sf_cache_', dir = input_dir)
+    try:
+        with os.fdopen(fd, 'w') as f:
+            f.write(text)
+        return subprocess.run(compiler + flags + ['-x', 'c++', '-'], input = f'#include "{path}"\n', check = True, stdout = subprocess.PIPE, text = True).stdout
+    except (OSError, subprocess.CalledProcessError) as e:
+        sys.exit(f'sf_cache: failed to run the preprocessor `{" ".join(compiler + flags)}`: {e}')
+    finally:
+        os.remove(path)
+
+# If `line` includes a file relative to `input_dir`, returns it with the path adjusted to be relative to `output_dir`. Otherwise returns it unchanged.
+# The files that aren't next to the input are left alone, since they are found via the include paths.
+def fix_include(line, input_dir, output_dir):
+    m = INCLUDE.match(line)
+    if not m or os.path.isabs(m[2]) or not os.path.exists(os.path.join(input_dir, m[2])):
+        return line
+    return m[1] + os.path.relpath(os.path.join(input_dir, m[2]), output_dir).replace(os.sep, '/') + m[3]
+
+# Returns `lines` followed by an `#endif` for every conditional that is still open at the end of them.
+def close_conditionals(lines):
+    depth = 0
+    for line in lines:
+        if COND_BEGIN.match(line):
+            depth += 1
+        elif COND_END.match(line) and depth > 0:
+            depth -= 1
+    return ''.join(lines) + '#endif\n' * depth
+
+def main():
+    if len(sys.argv) < 3:
+        print(f'Usage: {sys.argv[0]} <input> <output> [<compiler> <flags>...]', file=sys.stderr)
+        sys.exit(1)
+    input_path, output_path = sys.argv[1:3]
+    compiler = sys.argv[3:] or ['c++', '-std=c++20']
+    # GCC's `-E` is quadratic on long expansions without this flag (see `README.md`), and Clang doesn't have it.
+    try:
+        version = subprocess.run(compiler[:1] + ['--version'], check = True, stdout = subprocess.PIPE, text = True).stdout
+    except (OSError, subprocess.CalledProcessError) as e:
+        sys.exit(f'sf_cache: failed to run the compiler `{compiler[0]}`: {e}')
+    if 'clang' not in version:
+        expand_compiler = compiler + ['-ftrack-macro-expansion=0']
+    else:
+        expand_compiler = compiler
+    input_dir = os.path.dirname(os.path.abspath(input_path))
+    output_dir = os.path.dirname(os.path.abspath(output_path))
+    cache_dir = os.path.join(output_dir, CACHE_DIR)
+
+    with open(input_path) as f:
+        lines = f.read().splitlines(keepends = True)
+
+    # Find the regions, as `(begin, end)` line indices of the markers.
+    regions = []
+    begin = None
+    for i, line in enumerate(lines):
+        if BEGIN.match(line):
+            if begin is not None:
+                sys.exit(f'{input_path}:{i+1}: nested `sf_cache begin`')
+            begin = i
+        elif END.match(line):
+            if begin is None:
+                sys.exit(f'{input_path}:{i+1}: `sf_cache end` without `sf_cache begin`')
+            regions.append((begin, i))
+            begin = None
+    if begin is not None:
+        sys.exit(f'{input_path}:{begin+1}: `sf_cache begin` without `sf_cache end`')
+
+    # Compute the keys, and find out which regions need expanding.
+    keys = []
+    missing = set()
+    for begin, end in regions:
+        macros = preprocess(compiler, input_dir, close_conditionals(lines[:begin]), ['-E', '-dM'])
+        text = ''.join(lines[begin+1:end])
+        key = hashlib.sha256('\0'.join([' '.join(compiler), text, '\n'.join(sorted(macros.splitlines()))]).encode()).hexdigest()[:32]
+        keys.append(key)
+        if not os.path.exists(os.path.join(cache_dir, key + '.h')):
+            missing.add(begin)
+
+    # Expand all missing regions in a single run, by surrounding them with separators. The cached regions are removed.
+    if missing:
+        combined = []
+        pos = 0
+        for begin, end in regions:
+            combined += lines[pos:begin]
+            if begin in missing:
+                combined += [f'\n{SEPARATOR}\n'] + lines[begin+1:end] + [f'\n{SEPARATOR}\n']
+            pos = end + 1
+        combined += lines[pos:]
+        chunks = preprocess(expand_compiler, input_dir, ''.join(combined), ['-E', '-P']).split(SEPARATOR)
+        if len(chunks) != len(missing) * 2 + 1:
+            sys.exit(f'{input_path}: failed to find the expanded regions in the preprocessor output, are some of them in disabled conditionals?')
+        os.makedirs(cache_dir, exist_ok = True)
+        expanded = iter(chunks[1::2])
+        for (begin, _), key in zip(regions, keys):
+            if begin in missing:
+                with open(os.path.join(cache_dir, key + '.h'), 'w') as f:
+                    f.write(f'// Generated by `sf_cache.py` from `{input_path}`, don\'t edit.\n' + next(expanded).strip('\n') + '\n')
+
+    # Write the output, replacing the regions with the includes. Only touch the file if it changed, to avoid needless rebuilds.
+    if output_dir != input_dir:
+        lines = [fix_include(line, input_dir, output_dir) for line in lines]
+    result = [f'// Generated by `sf_cache.py` from `{input_path}`, don\'t edit.\n']
+    pos = 0
+    for (begin, end), key in zip(regions, keys):
+        result += lines[pos:begin] + [f'#include "{CACHE_DIR}/{key}.h"\n']
+        pos = end + 1
+    result = ''.join(result + lines[pos:])
+    if not os.path.exists(output_path) or open(output_path).read() != result:
+        with open(output_path, 'w') as f:
+            f.write(result)
+
+    print(f'sf_cache: {len(regions)} region(s), {len(missing)} expanded, {len(regions) - len(missing)} cached')
+
+if __name__ == '__main__':
+    main()
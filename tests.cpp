@@ -49,6 +49,9 @@ static_assert(same(STR(SF_FOR_EACH(BODY, STEP, FINAL, s0, ()(0)(1,2))), R"(
     (final:n=0;     d=(step:n=0;x=1,2;d=(step:n=0;x=0;d=(step:n=0;x= ;d=s0))))
 )"), "Test: 3 iteration.");
 
+// An element that looks like the old guide terminator.
+static_assert(same(STR(SF_FOR_EACH(BODY, SF_STATE, FINAL, s0, (0))), "(body:n=0;x=0;d=s0) (final:n=0;d=s0)"), "Test: Element `0`.");
+
 // Operating with a non-zero nesting level:
 static_assert(same(STR(SF_FOR_EACH2(BODY, STEP, FINAL, s0, (1)(2)(3))), R"(
     (body:n=3;x=1;d=s0)
@@ -76,6 +79,144 @@ static_assert(same(STR(SF_FOR_EACH(NESTED_BODY, SF_NULL, SF_NULL,, (0,)(1,(10,))
     )
 )"), "Test: True nested loops.");
 
+// Nesting levels are loaded up to `SF_MAX_DEPTH`. `make tests` runs this with the default depth and with `SF_MAX_DEPTH_LIMIT`.
+#if defined(SF_FOR_EACH7) != (SF_MAX_DEPTH > 7) || defined(SF_FOR_EACH8) != (SF_MAX_DEPTH > 8) || defined(SF_FOR_EACH_SIMPLE63) != (SF_MAX_DEPTH > 63)
+#error Test: Nesting levels up to `SF_MAX_DEPTH`.
+#endif
+#if SF_MAX_DEPTH > 63
+static_assert(same(STR(SF_FOR_EACH63(BODY, STEP, FINAL, s0, (1)(2))), "(body:n=64;x=1;d=s0) (body:n=64;x=2;d=(step:n=64;x=1;d=s0)) (final:n=64;d=(step:n=64;x=2;d=(step:n=64;x=1;d=s0)))"), "Test: The last nesting level.");
+#endif
+
+// Stateless loops:
+#define SIMPLE_BODY(n_, ...) (body:n=n_;x=__VA_ARGS__)
+static_assert(same(STR(SF_FOR_EACH_SIMPLE(SIMPLE_BODY,)), ""), "Test: Stateless, 0 iterations.");
+static_assert(same(STR(SF_FOR_EACH_SIMPLE(SIMPLE_BODY, (1))), "(body:n=0;x=1)"), "Test: Stateless, 1 iteration.");
+static_assert(same(STR(SF_FOR_EACH_SIMPLE(SIMPLE_BODY, ()(0)(1,2))), "(body:n=0;x=) (body:n=0;x=0) (body:n=0;x=1,2)"), "Test: Stateless, unusual elements.");
+static_assert(same(STR(SF_FOR_EACH_SIMPLE2(SIMPLE_BODY, (1)(2))), "(body:n=3;x=1) (body:n=3;x=2)"), "Test: Stateless, non-zero nesting level argument.");
+
+#define NESTED_SIMPLE_BODY(n_, x_, ...)  (n=n_,x=x_,SF_CAT(SF_FOR_EACH_SIMPLE,n_)(SF_CAT(NESTED_SIMPLE_BODY,n_), __VA_ARGS__))
+#define NESTED_SIMPLE_BODY0(n_, x_, ...) (n=n_,x=x_,SF_CAT(SF_FOR_EACH_SIMPLE,n_)(SF_CAT(NESTED_SIMPLE_BODY,n_), __VA_ARGS__))
+static_assert(same(STR(SF_FOR_EACH_SIMPLE(NESTED_SIMPLE_BODY, (0,)(1,(10,)(11,)))), "(n=0,x=0,) (n=0,x=1, (n=1,x=10,) (n=1,x=11,))"), "Test: Stateless, nested loops.");
+
+// Loops where the step function can't emit text:
+static_assert(same(STR(SF_FOR_EACH_FAST(BODY, STEP, FINAL, s0,)), "(final:n=0;d=s0)"), "Test: Fast, 0 iterations.");
+static_assert(same(STR(SF_FOR_EACH_FAST(BODY, STEP, FINAL, s0, (1)(2,3))), R"(
+    (body:n=0;x=1;d=s0)
+    (body:n=0;x=2,3;d=(step:n=0;x=1;d=s0))
+    (final:n=0;     d=(step:n=0;x=2,3;d=(step:n=0;x=1;d=s0)))
+)"), "Test: Fast, 2 iterations.");
+static_assert(same(STR(SF_FOR_EACH_FAST2(BODY, SF_STATE, FINAL, s0, (1))), "(body:n=3;x=1;d=s0) (final:n=3;d=s0)"), "Test: Fast, non-zero nesting level argument.");
+#define FAST_SUM_STEP(n, d, x) d+x
+static_assert(SF_FOR_EACH_FAST(SF_NULL, FAST_SUM_STEP, SF_STATE, 0, (1)(2)(3)) == 6, "Test: Fast, integer sum.");
+
+// Stopping early:
+#define UNTIL_STEP(n_, d_, ...) UNTIL_STOP_##__VA_ARGS__, (step:n=n_;x=__VA_ARGS__;d=d_)
+#define UNTIL_STOP_a 0
+#define UNTIL_STOP_b 0
+#define UNTIL_STOP_c 1
+#define UNTIL_STOP_d 0
+static_assert(same(STR(SF_FOR_EACH_UNTIL(BODY, UNTIL_STEP, FINAL, s0,)), "(final:n=0;d=s0)"), "Test: Stopping early, 0 iterations.");
+static_assert(same(STR(SF_FOR_EACH_UNTIL(BODY, UNTIL_STEP, FINAL, s0, (a)(b))), R"(
+    (body:n=0;x=a;d=s0)
+    (body:n=0;x=b;d=(step:n=0;x=a;d=s0))
+    (final:n=0;   d=(step:n=0;x=b;d=(step:n=0;x=a;d=s0)))
+)"), "Test: Stopping early, never stopping.");
+static_assert(same(STR(SF_FOR_EACH_UNTIL(BODY, UNTIL_STEP, FINAL, s0, (a)(c)(d)(a,b))), R"(
+    (body:n=0;x=a;d=s0)
+    (body:n=0;x=c;d=(step:n=0;x=a;d=s0))
+    (final:n=0;   d=(step:n=0;x=c;d=(step:n=0;x=a;d=s0)))
+)"), "Test: Stopping early.");
+static_assert(same(STR(SF_FOR_EACH_UNTIL1(BODY, UNTIL_STEP, FINAL, s0, (c))), "(body:n=2;x=c;d=s0) (final:n=2;d=(step:n=2;x=c;d=s0))"), "Test: Stopping early on the last element.");
+
+#define UNTIL_STEP2(n_, d_, ...) UNTIL_STOP_##__VA_ARGS__, d_, [__VA_ARGS__]
+static_assert(same(STR(SF_FOR_EACH_UNTIL(SF_NULL, UNTIL_STEP2, SF_STATE, s0, (a)(b)(c)(d))), "[a] [b] [c] s0"), "Test: Stopping early, emitting text from step.");
+
+// Zipping sequences:
+static_assert(same(STR(SF_FOR_EACH_ZIP(BODY, STEP, FINAL, s0,, (x))), "(final:n=0;d=s0)"), "Test: Zip, first sequence is empty.");
+static_assert(same(STR(SF_FOR_EACH_ZIP(BODY, STEP, FINAL, s0, (1),)), "(final:n=0;d=s0)"), "Test: Zip, second sequence is empty.");
+static_assert(same(STR(SF_FOR_EACH_ZIP(BODY, STEP, FINAL, s0, (1)(2), (a)(b,c))), R"(
+    (body:n=0;x=1,a;d=s0)
+    (body:n=0;x=2,b,c;d=(step:n=0;x=1,a;d=s0))
+    (final:n=0;       d=(step:n=0;x=2,b,c;d=(step:n=0;x=1,a;d=s0)))
+)"), "Test: Zip, 2 sequences.");
+static_assert(same(STR(SF_FOR_EACH_ZIP(BODY, SF_STATE, FINAL, s0, (1)(2)(3), (a)(b), (x)(y)(z))), "(body:n=0;x=1,a,x;d=s0) (body:n=0;x=2,b,y;d=s0) (final:n=0;d=s0)"), "Test: Zip, stopping at the shortest sequence.");
+static_assert(same(STR(SF_FOR_EACH_ZIP(BODY, SF_STATE, FINAL, s0, ()(1), ()(a))), "(body:n=0;x=,;d=s0) (body:n=0;x=1,a;d=s0) (final:n=0;d=s0)"), "Test: Zip, empty elements.");
+static_assert(same(STR(SF_FOR_EACH_ZIP2(BODY, SF_STATE, FINAL, s0, (1), (a))), "(body:n=3;x=1,a;d=s0) (final:n=3;d=s0)"), "Test: Zip, non-zero nesting level argument.");
+static_assert(same(STR(SF_FOR_EACH_ZIP(BODY, SF_STATE, SF_NULL, s0, (0), (1), (2), (3), (4), (5), (6), (7), (8), (9), (10))), "(body:n=0;x=0,1,2,3,4,5,6,7,8,9,10;d=s0)"), "Test: Zip, max number of sequences.");
+static_assert(same(STR(SF_FOR_EACH_ZIP(BODY, SF_STATE, SF_NULL, s0, (0), (1), (2), (3), (4), (5), (6), (7), (8), (9), (10), (11))), "SF_FOR_EACH_ZIP_too_many_sequences_increase_SF_MAX_ZIP"), "Test: Zip, too many sequences.");
+#define ZIP_NESTED_BODY(n, d, x, y) (x: SF_CAT(SF_FOR_EACH_ZIP, n)(ZIP_NESTED_BODY0, SF_STATE, SF_NULL,, x, y))
+#define ZIP_NESTED_BODY0(n, d, x, y) [n:x=y]
+static_assert(same(STR(SF_FOR_EACH_ZIP(ZIP_NESTED_BODY, SF_STATE, SF_NULL,, ((1)(2))((3)), ((a)(b))((c)(d)))), "((1)(2): [1:1=a] [1:2=b]) ((3): [1:3=c])"), "Test: Zip, nested loops.");
+
+// Comma-separated lists:
+static_assert(same(STR(SF_FOR_EACH_ARGS(BODY, STEP, FINAL, s0)), "(final:n=0;d=s0)"), "Test: Args, 0 iterations.");
+static_assert(same(STR(SF_FOR_EACH_ARGS(BODY, STEP, FINAL, s0,)), "(final:n=0;d=s0)"), "Test: Args, 0 iterations, with a comma.");
+static_assert(same(STR(SF_FOR_EACH_ARGS(BODY, STEP, FINAL, s0, 1, (2,3))), R"(
+    (body:n=0;x=1;d=s0)
+    (body:n=0;x=(2,3);d=(step:n=0;x=1;d=s0))
+    (final:n=0;       d=(step:n=0;x=(2,3);d=(step:n=0;x=1;d=s0)))
+)"), "Test: Args, 2 iterations.");
+static_assert(same(STR(SF_FOR_EACH_ARGS(BODY, SF_STATE, FINAL, s0, ,1,)), "(body:n=0;x=;d=s0) (body:n=0;x=1;d=s0) (body:n=0;x=;d=s0) (final:n=0;d=s0)"), "Test: Args, empty elements.");
+static_assert(same(STR(SF_FOR_EACH_ARGS2(BODY, SF_STATE, FINAL, s0, 1)), "(body:n=3;x=1;d=s0) (final:n=3;d=s0)"), "Test: Args, non-zero nesting level argument.");
+static_assert(same(STR(SF_FOR_EACH_ARGS(SF_NULL, SF_STATE, SF_STATE,, 1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16)), ""), "Test: Args, 16 elements (one step).");
+static_assert(same(STR(SF_SEQ_TO_ARGS_G(SF_GUIDE_ARGS(1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16))), "1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16"), "Test: Args, 16 elements (one step).");
+static_assert(same(STR(SF_SEQ_TO_ARGS_G(SF_GUIDE_ARGS(1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17))), "1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17"), "Test: Args, 17 elements (two steps).");
+static_assert(same(STR(SF_SEQ_TO_ARGS_G(SF_GUIDE_ARGS(1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,))), "1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,"), "Test: Args, 17 elements with an empty one at the end.");
+static_assert(same(STR(SF_SEQ_SIZE_G(SF_GUIDE_ARGS(1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,36,37,38,39,40))), "40"), "Test: Args, 40 elements (three steps).");
+#define ARGS_NESTED_BODY(n, d, x) (x: SF_CAT(SF_FOR_EACH_ARGS, n)(ARGS_NESTED_BODY0, SF_STATE, SF_NULL,, SF_STATE_EXPAND(,x)))
+#define ARGS_NESTED_BODY0(n, d, x) [n:x]
+static_assert(same(STR(SF_FOR_EACH_ARGS(ARGS_NESTED_BODY, SF_STATE, SF_NULL,, (1,2), (3))), "((1,2): [1:1] [1:2]) ((3): [1:3])"), "Test: Args, nested loops.");
+
+// File iteration. Every call emits a string literal, and they get concatenated.
+#define ITERATE_BODY(n, d, ...) STR(BODY(n, SF_COUNTER(d), __VA_ARGS__))
+#define ITERATE_FINAL(n, d) STR(FINAL(n, SF_COUNTER(d)))
+#define SF_ITERATE_SEQ
+#define SF_ITERATE_M ITERATE_BODY
+#define SF_ITERATE_F ITERATE_FINAL
+#define SF_ITERATE_D (0)
+constexpr const char *iterate_empty =
+#include SF_ITERATE
+;
+static_assert(same(iterate_empty, "(final:n=0;d=0)"), "Test: Iterate, 0 iterations.");
+#define SF_ITERATE_SEQ (1)(2)(3)
+#define SF_ITERATE_M ITERATE_BODY
+#define SF_ITERATE_S SF_STATE_INC
+#define SF_ITERATE_F ITERATE_FINAL
+#define SF_ITERATE_D (0)
+#define SF_ITERATE_CHUNK 1
+constexpr const char *iterate_chunk_1 =
+#include SF_ITERATE
+;
+static_assert(same(iterate_chunk_1, "(body:n=0;x=1;d=0) (body:n=0;x=2;d=1) (body:n=0;x=3;d=2) (final:n=0;d=3)"), "Test: Iterate, chunk size 1.");
+#define SF_ITERATE_SEQ (a)(b,c)()(d)(e)(f)(g)(h)(i)(j)(k)(l)
+#define SF_ITERATE_M ITERATE_BODY
+#define SF_ITERATE_S SF_STATE_INC
+#define SF_ITERATE_F ITERATE_FINAL
+#define SF_ITERATE_D (0)
+#define SF_ITERATE_CHUNK 10
+constexpr const char *iterate_chunk_10 =
+#include SF_ITERATE
+;
+static_assert(same(iterate_chunk_10, "(body:n=0;x=a;d=0) (body:n=0;x=b,c;d=1) (body:n=0;x=;d=2) (body:n=0;x=d;d=3) (body:n=0;x=e;d=4) (body:n=0;x=f;d=5) (body:n=0;x=g;d=6) (body:n=0;x=h;d=7) (body:n=0;x=i;d=8) (body:n=0;x=j;d=9) (body:n=0;x=k;d=10) (body:n=0;x=l;d=11) (final:n=0;d=12)"), "Test: Iterate, several chunks.");
+#define SF_ITERATE_SEQ (a)(b)(c)(d)(e)(f)(g)(h)(i)(j)
+#define SF_ITERATE_M ITERATE_BODY
+#define SF_ITERATE_S SF_STATE_INC
+#define SF_ITERATE_F ITERATE_FINAL
+#define SF_ITERATE_D (0)
+#define SF_ITERATE_CHUNK 10
+constexpr const char *iterate_exact =
+#include SF_ITERATE
+;
+static_assert(same(iterate_exact, "(body:n=0;x=a;d=0) (body:n=0;x=b;d=1) (body:n=0;x=c;d=2) (body:n=0;x=d;d=3) (body:n=0;x=e;d=4) (body:n=0;x=f;d=5) (body:n=0;x=g;d=6) (body:n=0;x=h;d=7) (body:n=0;x=i;d=8) (body:n=0;x=j;d=9) (final:n=0;d=10)"), "Test: Iterate, the sequence ends with the chunk.");
+#define ITERATE_NESTED_BODY(n, d, x) STR(SF_CAT(SF_FOR_EACH_SIMPLE, n)(ITERATE_NESTED_BODY0, x))
+#define ITERATE_NESTED_BODY0(n, x) [n:x]
+#define SF_ITERATE_SEQ ((1)(2))((3))
+#define SF_ITERATE_M ITERATE_NESTED_BODY
+constexpr const char *iterate_nested =
+#include SF_ITERATE
+;
+static_assert(same(iterate_nested, "[1:1] [1:2] [1:3]"), "Test: Iterate, nested loops, default state and final function.");
+
 // Predefined macro arguments:
 // SF_STATE
 static_assert(same(STR(SF_FOR_EACH(BODY, SF_STATE, SF_NULL, s0, (1)(2)(3))), "(body:n=0;x=1;d=s0) (body:n=0;x=2;d=s0) (body:n=0;x=3;d=s0)"), "Test: SF_STATE as the step function.");
@@ -83,6 +224,58 @@ static_assert(same(STR(SF_FOR_EACH(BODY, SF_STATE, SF_NULL, s0, (1)(2)(3))), "(b
 static_assert(same(STR(SF_FOR_EACH(SF_NULL, SF_STATE, SF_STATE, s0, (1)(2)(3))), "s0"), "Test: SF_STATE as the final function.");
 
 
+// SF_STATE_INC and SF_COUNTER
+#define COUNTER_BODY(n_, d_, ...) (x=__VA_ARGS__;i=SF_COUNTER(d_))
+#define COUNTER_FINAL(n_, d_) (final:i=SF_COUNTER(d_))
+static_assert(same(STR(SF_FOR_EACH(COUNTER_BODY, SF_STATE_INC, COUNTER_FINAL, (0), (a)(b)(c))), "(x=a;i=0) (x=b;i=1) (x=c;i=2) (final:i=3)"), "Test: Counter.");
+static_assert(same(STR(SF_FOR_EACH(COUNTER_BODY, SF_STATE_INC, COUNTER_FINAL, (8,9), (a)(b)(c))), "(x=a;i=98) (x=b;i=99) (x=c;i=100) (final:i=101)"), "Test: Counter, carry.");
+static_assert(same(STR(SF_COUNTER((9,9,9,9,9,9,9,9,9))), "999999999"), "Test: Counter, many digits.");
+static_assert(same(STR(SF_FOR_EACH(SF_NULL, SF_STATE_INC, COUNTER_FINAL, (9,9,9,9,9,9,9,9,9), (a))), "(final:i=1000000000)"), "Test: Counter, max digits.");
+
+// Sequence algorithms:
+static_assert(same(STR(SF_SEQ_SIZE()), "0"), "Test: Size, empty.");
+static_assert(same(STR(SF_SEQ_SIZE(()(a)(b,c))), "3"), "Test: Size.");
+static_assert(same(STR(SF_SEQ_SIZE((0)(1)(2)(3)(4)(5)(6)(7)(8)(9)(10)(11))), "12"), "Test: Size, carry.");
+static_assert(same(STR(SF_SEQ_ELEM((0), (a)(b,c)(d))), "a"), "Test: Element, first.");
+static_assert(same(STR(SF_SEQ_ELEM((1), (a)(b,c)(d))), "b,c"), "Test: Element, with commas.");
+static_assert(same(STR(SF_SEQ_ELEM((2), (a)(b,c)(d))), "d"), "Test: Element, last.");
+static_assert(same(STR(SF_SEQ_ELEM((3), (a)(b,c)(d))), ""), "Test: Element, out of range.");
+static_assert(same(STR(SF_SEQ_ELEM((0,1), (0)(1)(2)(3)(4)(5)(6)(7)(8)(9)(10)(11))), "10"), "Test: Element, borrow.");
+static_assert(same(STR(SF_SEQ_TO_ARGS()), ""), "Test: To args, empty.");
+static_assert(same(STR(SF_SEQ_TO_ARGS((a)(b,c)(d))), "a, b,c, d"), "Test: To args.");
+static_assert(same(STR(SF_SEQ_REVERSE()), ""), "Test: Reverse, empty.");
+static_assert(same(STR(SF_SEQ_REVERSE((a)(b,c)(d))), "(d)(b,c)(a)"), "Test: Reverse.");
+#define SEQ_MAP_BODY(n_, ...) [n=n_;x=__VA_ARGS__]
+static_assert(same(STR(SF_SEQ_MAP(SEQ_MAP_BODY,)), ""), "Test: Map, empty.");
+static_assert(same(STR(SF_SEQ_MAP(SEQ_MAP_BODY, (a)(b,c))), "([n=0;x=a]) ([n=0;x=b,c])"), "Test: Map.");
+static_assert(same(STR(SF_SEQ_MAP2(SEQ_MAP_BODY, (a))), "([n=3;x=a])"), "Test: Map, non-zero nesting level argument.");
+#define SEQ_FILTER_PRED(n, x) SEQ_FILTER_PRED_##x
+#define SEQ_FILTER_PRED_a 1
+#define SEQ_FILTER_PRED_b 0
+#define SEQ_FILTER_PRED_c 1
+static_assert(same(STR(SF_SEQ_FILTER(SEQ_FILTER_PRED,)), ""), "Test: Filter, empty.");
+static_assert(same(STR(SF_SEQ_FILTER(SEQ_FILTER_PRED, (a)(b)(c)(b))), "(a) (c)"), "Test: Filter.");
+#define SEQ_NESTED_BODY(n, d, ...) [SF_SEQ_SIZE(__VA_ARGS__) SF_CAT(SF_SEQ_FILTER, n)(SEQ_FILTER_PRED, SF_SEQ_REVERSE(__VA_ARGS__))]
+static_assert(same(STR(SF_FOR_EACH(SEQ_NESTED_BODY, SF_NULL, SF_NULL,, ((a)(b)(c))())), "[3 (c) (a)] [0]"), "Test: Sequence algorithms in a loop body.");
+
+// Pipelines:
+static_assert(same(STR(SF_FOR_EACH_G(BODY, STEP, FINAL, s0, SF_GUIDE())), "(final:n=0;d=s0)"), "Test: Guide, 0 iterations.");
+static_assert(same(STR(SF_FOR_EACH_G(BODY, STEP, FINAL, s0, SF_GUIDE((1)(2,3)))), R"(
+    (body:n=0;x=1;d=s0)
+    (body:n=0;x=2,3;d=(step:n=0;x=1;d=s0))
+    (final:n=0;     d=(step:n=0;x=2,3;d=(step:n=0;x=1;d=s0)))
+)"), "Test: Guide, 2 iterations.");
+static_assert(same(STR(SF_FOR_EACH_SIMPLE_G2(SIMPLE_BODY, SF_GUIDE((1)))), "(body:n=3;x=1)"), "Test: Guide, stateless.");
+static_assert(same(STR(SF_FOR_EACH_FAST_G(BODY, SF_STATE, FINAL, s0, SF_GUIDE((1)))), "(body:n=0;x=1;d=s0) (final:n=0;d=s0)"), "Test: Guide, fast.");
+static_assert(same(STR(SF_FOR_EACH_UNTIL_G(SF_NULL, UNTIL_STEP2, SF_STATE, s0, SF_GUIDE((a)(c)(d)))), "[a] [c] s0"), "Test: Guide, stopping early.");
+static_assert(same(STR(SF_SEQ_TO_ARGS_G(SF_SEQ_MAP_G(SEQ_MAP_BODY, SF_SEQ_FILTER_G(SEQ_FILTER_PRED, SF_GUIDE((a)(b)(c)))))), "[n=0;x=a], [n=0;x=c]"), "Test: Guide, map and filter.");
+static_assert(same(STR(SF_SEQ_TO_ARGS_G(SF_GUIDE())), ""), "Test: Guide, to args, empty.");
+static_assert(same(STR(SF_SEQ_SIZE_G(SF_GUIDE((a)(b,c)))), "2"), "Test: Guide, size.");
+static_assert(same(STR(SF_SEQ_ELEM_G((1), SF_GUIDE((a)(b,c)))), "b,c"), "Test: Guide, element.");
+static_assert(same(STR(SF_SEQ_REVERSE_G(SF_SEQ_FILTER_G(SEQ_FILTER_PRED, SF_GUIDE((a)(b)(c))))), "(c)(a)"), "Test: Guide, reverse.");
+#define GUIDE_EMIT_BODY(n, d, ...) SF_GUIDE_ELEM(__VA_ARGS__, d)
+#define GUIDE_EMIT_FINAL(n, d) SF_GUIDE_END
+static_assert(same(STR(SF_FOR_EACH_SIMPLE_G(SIMPLE_BODY, SF_FOR_EACH(GUIDE_EMIT_BODY, SF_STATE, GUIDE_EMIT_FINAL, s0, (1)(2)))), "(body:n=0;x=1, s0) (body:n=0;x=2, s0)"), "Test: Guide, emitted by a loop.");
 
 // Emitting text directly from step:
 #define BODY2(n_, d_, ...) (body:n=n_;x=__VA_ARGS__;d=d_),b,b
@@ -109,6 +302,14 @@ static_assert(E::b == 2, "Test: Generating enum flags.");
 static_assert(E::c == 4, "Test: Generating enum flags.");
 static_assert(E::_mask == 7, "Test: Generating enum flags.");
 
+// Example: generating flags with a counter.
+#define MAKE_FLAGS2(name, seq) enum name {SF_FOR_EACH(FLAGS2_BODY, SF_STATE_INC, FLAGS2_FINAL, (0), seq)};
+#define FLAGS2_BODY(n, d, x) x = 1 << SF_COUNTER(d),
+#define FLAGS2_FINAL(n, d) _mask = (1 << SF_COUNTER(d)) - 1
+
+namespace Flags2 { MAKE_FLAGS2(E, (a)(b)(c)) }
+static_assert(Flags2::a == 1 && Flags2::b == 2 && Flags2::c == 4 && Flags2::_mask == 7, "Test: Generating enum flags with a counter.");
+
 // Example: sum.
 #define SUM(seq) SF_FOR_EACH(SF_NULL, SUM_STEP, SF_STATE, 0, seq)
 #define SUM_STEP(n, d, x) d+x
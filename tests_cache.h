@@ -0,0 +1,14 @@
+// A sample for testing `sf_cache.py`, see `make tests`. The regions are expanded into a different directory,
+//   to check that the relative `#include` is adjusted.
+#ifndef TESTS_CACHE_H_
+#define TESTS_CACHE_H_
+#include "include/macro_sequence_for.h"
+#define BODY(n, d, x) x = SF_COUNTER(d),
+// sf_cache begin
+enum E {SF_FOR_EACH(BODY, SF_STATE_INC, SF_NULL, (0), (a)(b)(c))};
+// sf_cache end
+#define BODY2(n, d, x) int x;
+// sf_cache begin
+SF_FOR_EACH(BODY2, SF_STATE, SF_NULL,, (i)(j))
+// sf_cache end
+#endif
@@ -0,0 +1,25 @@
+// Checks the `SF_TRACE` mode, see `make tests`. This is preprocessed with `-DSF_TRACE -E`, and the output of `trace_report.py`
+//   must match `tests_trace.txt`. Every loop kind is called on its own line, so the report has one row per loop.
+
+#include "macro_sequence_for.h"
+
+#define BODY(n, d, x) x = SF_COUNTER(d),
+#define FINAL(n, d) _count = SF_COUNTER(d)
+#define NESTED_BODY(n, d, name, values) int name[] = {SF_CAT(SF_FOR_EACH_SIMPLE, n)(NESTED_BODY0, values)};
+#define NESTED_BODY0(n, x) x,
+#define UNTIL_STEP(n, d, x) UNTIL_STOP_##x, d
+#define UNTIL_STOP_a 0
+#define UNTIL_STOP_b 1
+#define ZIP_BODY(n, d, x, y) int x = y;
+#define STATE_BODY(n, d, x) int x = d;
+
+enum A {SF_FOR_EACH(BODY, SF_STATE_INC, FINAL, (0), (a)(b)(c))};
+SF_FOR_EACH(NESTED_BODY, SF_NULL, SF_NULL,, (f,(1)(2)(3))(g,(4)(5)))
+SF_FOR_EACH_FAST(STATE_BODY, SF_STATE, SF_NULL, 1, (h)(i))
+SF_FOR_EACH_UNTIL(STATE_BODY, UNTIL_STEP, SF_NULL, 2, (a)(b)(c))
+SF_FOR_EACH_ZIP(ZIP_BODY, SF_STATE, SF_NULL,, (j)(k), (1)(2)(3))
+SF_FOR_EACH_ARGS(STATE_BODY, SF_STATE, SF_NULL, 3, l, m, n, o)
+SF_FOR_EACH_G(STATE_BODY, SF_STATE, SF_NULL, 4, SF_SEQ_MAP_G(SF_STATE, SF_GUIDE((p)(q))))
+SF_FOR_EACH_SIMPLE_G(NESTED_BODY0, SF_GUIDE((5)(6)))
+SF_FOR_EACH_FAST_G(STATE_BODY, SF_STATE, SF_NULL, 5, SF_GUIDE((r)))
+SF_FOR_EACH_UNTIL_G(STATE_BODY, UNTIL_STEP, SF_NULL, 6, SF_GUIDE((b)(a)))
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+
+# Per-call-site cost report for the `SF_TRACE` mode, see the header and `README.md`.
+# Usage: `g++ -std=c++20 -DSF_TRACE -E foo.cpp | ./trace_report.py`, or `./trace_report.py <file>...` with saved `-E` outputs.
+# Reads the `#pragma sf_trace ...` markers emitted by the loops, and for every call site (file, line and macro) prints:
+#   the number of calls, the total number of iterations, the size of the final state (the max over all calls, in tokens),
+#   the size of the output (including the output of nested loops, in tokens), and the estimated cost, which the rows are sorted by.
+# The estimated cost is `iterations * (final state size + 1) + output size`, summed over all calls. This follows from the fact that
+#   every iteration passes the whole state through a few macros, so for most loops the state size dominates the preprocessing time.
+#   If the state grows during the loop, this overestimates the cost, since the final state is the largest one.
+# Clang's `-ftime-trace` doesn't break down the preprocessing time below the file level, so we rely on the markers instead.
+
+import re
+import sys
+
+# Approximate tokenization: string and character literals, identifiers and numbers, and single punctuation characters.
+TOKEN = re.compile(r'"(?:\\.|[^"\\])*"|\'(?:\\.|[^\'\\])*\'|\w+|\S')
+# Line markers, e.g. `# 12 "foo.cpp"` (GCC, Clang) or `#line 12 "foo.cpp"` (MSVC).
+LINE_MARKER = re.compile(r'\s*#\s*(line\s+)?\d+')
+MARKER = re.compile(r'\s*#\s*pragma\s+sf_trace\s+(\w+)\s*(.*)')
+
+def count_tokens(text):
+    return len(TOKEN.findall(text))
+
+def main():
+    # Maps `(file, line, macro)` to `[calls, iterations, max state size, output size, estimated cost]`.
+    sites = {}
+    # The loops that are currently running, as `[site, level, iterations, output size]`.
+    stack = []
+
+    files = sys.argv[1:] or ['-']
+    for name in files:
+        with (sys.stdin if name == '-' else open(name, errors='replace')) as f:
+            for line in f:
+                match = MARKER.match(line)
+                if not match:
+                    if LINE_MARKER.match(line) or line.lstrip().startswith('#'):
+                        continue
+                    tokens = count_tokens(line)
+                    for frame in stack:
+                        frame[3] += tokens
+                    continue
+
+                kind, rest = match.groups()
+                if kind == 'begin':
+                    # `begin <macro> <n> <file> <line>`. The file name can contain spaces, so split from both ends.
+                    macro, level, rest = rest.split(maxsplit=2)
+                    file, line_number = rest.rsplit(maxsplit=1)
+                    stack.append([(file.strip('"'), int(line_number), macro), int(level), 0, 0])
+                elif not stack:
+                    print(f'trace_report: `{kind}` marker without a matching `begin`, ignoring it', file=sys.stderr)
+                elif kind == 'iter':
+                    stack[-1][2] += 1
+                elif kind == 'end':
+                    site, _, iterations, output = stack.pop()
+                    state = count_tokens(rest)
+                    entry = sites.setdefault(site, [0, 0, 0, 0, 0])
+                    entry[0] += 1
+                    entry[1] += iterations
+                    entry[2] = max(entry[2], state)
+                    entry[3] += output
+                    entry[4] += iterations * (state + 1) + output
+
+    if stack:
+        print(f'trace_report: {len(stack)} loop(s) without a matching `end`, was the output passed to another macro?', file=sys.stderr)
+
+    print(f'{"file:line":<40} {"macro":<24} {"calls":>8} {"iterations":>12} {"state":>8} {"output":>12} {"est_cost":>14}')
+    for (file, line_number, macro), (calls, iterations, state, output, cost) in sorted(sites.items(), key = lambda x: -x[1][4]):
+        print(f'{f"{file}:{line_number}":<40} {macro:<24} {calls:>8} {iterations:>12} {state:>8} {output:>12} {cost:>14}')
+
+if __name__ == '__main__':
+    main()